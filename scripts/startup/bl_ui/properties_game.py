@@ -564,6 +564,7 @@ class SCENE_PT_game_physics(SceneButtonsPanel, Panel):
         layout.prop(gs, "physics_engine", text="Engine")
         if gs.physics_engine != 'NONE':
             layout.prop(gs, "physics_solver")
+            layout.prop(gs, "physics_world")
             layout.prop(gs, "physics_gravity", text="Gravity")
 
             split = layout.split()
@@ -601,6 +602,8 @@ class SCENE_PT_game_physics(SceneButtonsPanel, Panel):
             row.label(text="Object Activity:")
             row.prop(gs, "use_activity_culling")
 
+            layout.prop(gs, "use_parallel_scenes")
+
         else:
             split = layout.split()
 
@@ -89,6 +89,7 @@ typedef struct bController {
 
 /* pyctrl->flag */
 #define CONT_PY_DEBUG 1
+#define CONT_PY_PERSISTENT_NAMESPACE 2
 
 /* pyctrl->mode */
 #define CONT_PY_SCRIPT 0
@@ -798,6 +798,7 @@ typedef struct RecastData {
 #define GAME_PYTHON_CONSOLE (1 << 22)
 #define GAME_USE_INTERACTIVE_DYNAPAINT (1 << 23)
 #define GAME_USE_INTERACTIVE_RIGIDBODY (1 << 24)
+#define GAME_USE_PARALLEL_SCENES (1 << 25)
 /* Note: GameData.flag is now an int (max 32 flags). A short could only take 16 flags */
 
 /* GameData.playerflag */
@@ -853,7 +854,7 @@ typedef struct GameData {
   short matmode = 0;
   short occlusionRes = 128; /* resolution of occlusion Z buffer in pixel */
   short physicsEngine = WOPHY_BULLET;
-  short solverType = 0, _pad[3] = {};
+  short solverType = 0, physicsWorld = 0, _pad[2] = {};
   short exitkey = 218;
   short pythonkeys[4] = {212, 217, 213, 116};
   short vsync = 0; /* Controls vsync: off, on, or adaptive (if supported) */
@@ -879,6 +880,12 @@ enum {
   GAME_SOLVER_NNCG,
 };
 
+/* GameData.physicsWorld */
+enum {
+  GAME_PHYSICS_WORLD_SERIAL = 0,
+  GAME_PHYSICS_WORLD_MULTITHREAD,
+};
+
 /** #RenderData::flag. */
 enum eRender_Flag : short {
   /** Use preview range. */
@@ -6642,6 +6642,20 @@ static void rna_def_scene_game_data(BlenderRNA *brna)
       {GAME_SOLVER_NNCG, "SOLVER_NNGC", 0, "NNGC", "NNGC physics solver"},
       {0, NULL, 0, NULL, NULL}};
 
+  static EnumPropertyItem physics_world_items[] = {
+      {GAME_PHYSICS_WORLD_SERIAL,
+       "SERIAL",
+       0,
+       "Serial",
+       "Single threaded physics world, supports soft bodies"},
+      {GAME_PHYSICS_WORLD_MULTITHREAD,
+       "MULTITHREAD",
+       0,
+       "Multithreaded",
+       "Physics world stepping collisions and islands on all threads, falls back to the serial "
+       "world when soft bodies are used"},
+      {0, NULL, 0, NULL, NULL}};
+
   static const EnumPropertyItem framing_types_items[] = {
       {SCE_GAMEFRAMING_BARS,
        "LETTERBOX",
@@ -6846,6 +6860,12 @@ static void rna_def_scene_game_data(BlenderRNA *brna)
   RNA_def_property_ui_text(prop, "Physics Solver", "Physics constraint solver");
   RNA_def_property_update(prop, NC_SCENE, NULL);
 
+  prop = RNA_def_property(srna, "physics_world", PROP_ENUM, PROP_NONE);
+  RNA_def_property_enum_sdna(prop, NULL, "physicsWorld");
+  RNA_def_property_enum_items(prop, physics_world_items);
+  RNA_def_property_ui_text(prop, "Physics World", "Physics simulation world");
+  RNA_def_property_update(prop, NC_SCENE, NULL);
+
   prop = RNA_def_property(srna, "occlusion_culling_resolution", PROP_INT, PROP_PIXEL);
   RNA_def_property_int_sdna(prop, NULL, "occlusionRes");
   RNA_def_property_range(prop, 128.0, 1024.0);
@@ -7049,6 +7069,14 @@ static void rna_def_scene_game_data(BlenderRNA *brna)
       "Restrict the number of animation updates to the animation FPS (this is "
       "better for performance, but can cause issues with smooth playback)");
 
+  prop = RNA_def_property(srna, "use_parallel_scenes", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "flag", GAME_USE_PARALLEL_SCENES);
+  RNA_def_property_ui_text(
+      prop,
+      "Parallel Scenes",
+      "Update physics and scene graph of scenes that don't share objects at the same time "
+      "on several threads, logic is still updated serially");
+
   /* game python console */
   prop = RNA_def_property(srna, "use_python_console", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", GAME_PYTHON_CONSOLE);
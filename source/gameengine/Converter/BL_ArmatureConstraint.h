@@ -71,6 +71,11 @@ class BL_ArmatureConstraint : public EXP_Value {
   bool UnlinkObject(SCA_IObject *clientobj);
 
   void UpdateTarget();
+  /// Return true if the constraint reads another object, UpdateTarget then modifies it.
+  bool HasExternalTarget() const
+  {
+    return (m_blendtarget && m_target) || (m_blendsubtarget && m_subtarget);
+  }
 
   bool Match(const std::string &posechannel, const std::string &constraint);
   virtual std::string GetName()
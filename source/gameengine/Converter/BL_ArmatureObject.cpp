@@ -407,6 +407,14 @@ bool BL_ArmatureObject::UnlinkObject(SCA_IObject *clientobj)
 }
 
 void BL_ArmatureObject::ApplyPose()
+{
+  if (m_lastapplyframe != m_lastframe) {
+    blender::bContext *C = KX_GetActiveEngine()->GetContext();
+    ApplyPose(CTX_data_depsgraph_pointer(C));
+  }
+}
+
+void BL_ArmatureObject::ApplyPose(blender::Depsgraph *depsgraph)
 {
   if (m_lastapplyframe != m_lastframe) {
     // update the constraint if any, first put them all off so that only the active ones will be
@@ -414,8 +422,6 @@ void BL_ArmatureObject::ApplyPose()
     for (BL_ArmatureConstraint *constraint : m_controlledConstraints) {
       constraint->UpdateTarget();
     }
-    blender::bContext *C = KX_GetActiveEngine()->GetContext();
-    blender::Depsgraph *depsgraph = CTX_data_depsgraph_pointer(C);
     BKE_pose_where_is(depsgraph, GetScene()->GetBlenderScene(), m_objArma);
 
     m_lastapplyframe = m_lastframe;
@@ -472,6 +478,64 @@ bool BL_ArmatureObject::UpdateTimestep(double curtime)
   return false;
 }
 
+void BL_ArmatureObject::AddPendingAction(BL_Action *action, float curtime, bool gpu_skinning)
+{
+  m_pendingActions.push_back({action, curtime, gpu_skinning});
+}
+
+bool BL_ArmatureObject::HasPendingActions() const
+{
+  return !m_pendingActions.empty();
+}
+
+void BL_ArmatureObject::EvaluatePendingActions(blender::Depsgraph *depsgraph)
+{
+  for (const PendingAction &pending : m_pendingActions) {
+    pending.m_action->EvaluateArmaturePose(
+        this, pending.m_curtime, pending.m_gpuSkinning, depsgraph);
+  }
+  m_pendingActions.clear();
+}
+
+bool BL_ArmatureObject::HasExternalPoseDependencies() const
+{
+  if (m_objArma->gameflag & OB_DUPLI_UPBGE) {
+    return true;
+  }
+
+  for (BL_ArmatureConstraint *constraint : m_controlledConstraints) {
+    if (constraint->HasExternalTarget()) {
+      return true;
+    }
+  }
+
+  /* The controlled constraints are only the supported types, any constraint can read or write
+   * another object, even if disabled now as it can be enabled by the logic. */
+  bool external = false;
+  for (blender::bPoseChannel &pchan : m_objArma->pose->chanbase) {
+    for (blender::bConstraint &con : pchan.constraints) {
+      blender::ListBaseT<blender::bConstraintTarget> targets = {nullptr, nullptr};
+      if (!BKE_constraint_targets_get(&con, &targets)) {
+        continue;
+      }
+
+      for (blender::bConstraintTarget &ct : targets) {
+        if (ct.tar && ct.tar != m_objArma) {
+          external = true;
+          break;
+        }
+      }
+      BKE_constraint_targets_flush(&con, &targets, true);
+
+      if (external) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
 blender::Object *BL_ArmatureObject::GetArmatureObject()
 {
   return m_objArma;
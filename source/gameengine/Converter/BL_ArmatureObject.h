@@ -45,8 +45,10 @@ class Shader;
 class StorageBuf;
 }  // namespace blender::gpu
 namespace blender { struct AnimationEvalContext; }
+namespace blender { struct Depsgraph; }
 namespace blender { struct ID; } /* forward declare blender::ID for storing original data pointers */
 class MT_Matrix4x4;
+class BL_Action;
 class BL_SceneConverter;
 class RAS_DebugDraw;
 
@@ -79,6 +81,15 @@ class BL_ArmatureObject : public KX_GameObject {
 
   double m_lastapplyframe;
 
+  /// Action layer whose pose evaluation is deferred to EvaluatePendingActions.
+  struct PendingAction {
+    BL_Action *m_action;
+    float m_curtime;
+    bool m_gpuSkinning;
+  };
+  /// Pending action layers in update order.
+  std::vector<PendingAction> m_pendingActions;
+
  public:
   BL_ArmatureObject();
   virtual ~BL_ArmatureObject();
@@ -96,6 +107,7 @@ class BL_ArmatureObject : public KX_GameObject {
   /// Never edit this, only for accessing names.
   blender::bPose *GetPose() const;
   void ApplyPose();
+  void ApplyPose(blender::Depsgraph *depsgraph);
   void GameBlendPose(blender::bPose *dst, blender::bPose *src, float srcweight, short mode);
   void RemapParentChildren();
   void ApplyAction(blender::bAction *action, const blender::AnimationEvalContext &evalCtx, bool gpu_skinning);
@@ -103,6 +115,18 @@ class BL_ArmatureObject : public KX_GameObject {
 
   bool UpdateTimestep(double curtime);
 
+  /// Defer the pose evaluation of an action layer updated this frame.
+  void AddPendingAction(BL_Action *action, float curtime, bool gpu_skinning);
+  bool HasPendingActions() const;
+  /** Evaluate the pose of the pending action layers in order. Without external pose
+   * dependencies this only modifies the armature and can run with other armatures in parallel.
+   */
+  void EvaluatePendingActions(blender::Depsgraph *depsgraph);
+  /** Return true if the pose evaluation reads or writes other objects: the constraints with
+   * an external target update the target object, and the dupli instances share their pose.
+   */
+  bool HasExternalPoseDependencies() const;
+
   blender::Object *GetArmatureObject();
   blender::Object *GetOrigArmatureObject();
   bool GetDrawDebug() const;
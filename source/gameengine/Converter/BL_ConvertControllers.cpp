@@ -140,6 +140,7 @@ void BL_ConvertControllers(blender::Object *blenderobject,
               MEM_delete(buf);
             }
           }
+          pyctrl->SetPersistentNamespace((pycont->flag & CONT_PY_PERSISTENT_NAMESPACE) != 0);
         }
         else {
           /* let the controller print any warnings here when importing */
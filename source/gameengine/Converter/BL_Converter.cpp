@@ -45,6 +45,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_string.hh"
 #include "BLI_task_c.hh"
+#include "BLI_time.hh"
 #include "BLO_readfile.hh"
 #include "DNA_material_types.h"
 #include "DNA_mesh_types.h"
@@ -105,7 +106,10 @@ void BL_Converter::SceneSlot::Merge(const BL_SceneConverter *converter)
 }
 
 BL_Converter::BL_Converter(blender::Main *maggie, KX_KetsjiEngine *engine)
-    : m_maggie(maggie), m_ketsjiEngine(engine), m_alwaysUseExpandFraming(false)
+    : m_mergeBudget(0.0),
+      m_maggie(maggie),
+      m_ketsjiEngine(engine),
+      m_alwaysUseExpandFraming(false)
 {
   BKE_main_id_tag_all(maggie, ID_TAG_DOIT, false);  // avoid re-tagging later on
   m_threadinfo.m_pool = BLI_task_pool_create(nullptr, TASK_PRIORITY_LOW);
@@ -296,30 +300,82 @@ blender::Main *BL_Converter::GetMainDynamicPath(const std::string &path) const
   return nullptr;
 }
 
-void BL_Converter::MergeAsyncLoads()
+/// Scenes converted by an asynchronous libload, waiting to be merged.
+struct AsyncMergeData {
+  std::vector<KX_Scene *> scenes;
+  /// Number of objects in the converted scenes, used to compute the merge progress.
+  unsigned int objectCount;
+};
+
+static unsigned int merge_scene_object_count(KX_Scene *scene)
+{
+  return scene->GetObjectList()->GetCount() + scene->GetInactiveList()->GetCount();
+}
+
+void BL_Converter::SetMergeBudget(double budget)
+{
+  m_mergeBudget = budget;
+}
+
+double BL_Converter::GetMergeBudget() const
 {
-  std::vector<KX_Scene *> *merge_scenes;
+  return m_mergeBudget;
+}
 
-  std::vector<KX_LibLoadStatus *>::iterator mit;
-  std::vector<KX_Scene *>::iterator sit;
+void BL_Converter::MergeAsyncLoads()
+{
+  MergeAsyncLoads(m_mergeBudget);
+}
 
+void BL_Converter::MergeAsyncLoads(double budget)
+{
   m_threadinfo.m_mutex.Lock();
 
-  for (mit = m_mergequeue.begin(); mit != m_mergequeue.end(); ++mit) {
-    merge_scenes = (std::vector<KX_Scene *> *)(*mit)->GetData();
+  const double endtime = BLI_time_now_seconds() + budget;
+  bool exhausted = false;
+
+  unsigned int merged = 0;
+  for (const unsigned int size = m_mergequeue.size(); merged < size && !exhausted; ++merged) {
+    KX_LibLoadStatus *status = m_mergequeue[merged];
+    AsyncMergeData *data = (AsyncMergeData *)status->GetData();
+    KX_Scene *mergeScene = status->GetMergeScene();
+
+    unsigned int done = 0;
+    for (const unsigned int numScenes = data->scenes.size(); done < numScenes; ++done) {
+      KX_Scene *scene = data->scenes[done];
+      if (budget > 0.0) {
+        const double remaining = endtime - BLI_time_now_seconds();
+        // Merge the objects over several frames, the scene is finished once all are merged.
+        if (remaining <= 0.0 || !mergeScene->MergeSceneObjects(scene, remaining)) {
+          exhausted = true;
+          break;
+        }
+      }
 
-    for (sit = merge_scenes->begin(); sit != merge_scenes->end(); ++sit) {
-      (*mit)->GetMergeScene()->MergeScene(*sit);
-      delete (*sit);
+      mergeScene->MergeScene(scene);
+      delete scene;
     }
+    data->scenes.erase(data->scenes.begin(), data->scenes.begin() + done);
 
-    delete merge_scenes;
-    (*mit)->SetData(nullptr);
+    if (exhausted) {
+      unsigned int remainingObjects = 0;
+      for (KX_Scene *scene : data->scenes) {
+        remainingObjects += merge_scene_object_count(scene);
+      }
+      status->SetMergeProgress(
+          (data->objectCount > 0) ?
+              1.0f - float(remainingObjects) / float(data->objectCount) :
+              0.0f);
+      break;
+    }
 
-    (*mit)->Finish();
+    delete data;
+    status->SetData(nullptr);
+
+    status->Finish();
   }
 
-  m_mergequeue.clear();
+  m_mergequeue.erase(m_mergequeue.begin(), m_mergequeue.begin() + merged);
 
   m_threadinfo.m_mutex.Unlock();
 }
@@ -329,7 +385,7 @@ void BL_Converter::FinalizeAsyncLoads()
   // Finish all loading libraries.
   BLI_task_pool_work_and_wait(m_threadinfo.m_pool);
   // Merge all libraries data in the current scene, to avoid memory leak of unmerged scenes.
-  MergeAsyncLoads();
+  MergeAsyncLoads(0.0);
 }
 
 void BL_Converter::AddScenesToMergeQueue(KX_LibLoadStatus *status)
@@ -344,22 +400,22 @@ static void async_convert(TaskPool *pool, void *ptr, int /*threadid*/)
   KX_Scene *new_scene = nullptr;
   KX_LibLoadStatus *status = (KX_LibLoadStatus *)ptr;
   std::vector<blender::Scene *> *scenes = (std::vector<blender::Scene *> *)status->GetData();
-  std::vector<KX_Scene *> *merge_scenes =
-      new std::vector<KX_Scene *>();  // Deleted in MergeAsyncLoads
+  AsyncMergeData *merge_data = new AsyncMergeData();  // Deleted in MergeAsyncLoads
+  merge_data->objectCount = 0;
 
   for (unsigned int i = 0; i < scenes->size(); ++i) {
     new_scene = status->GetEngine()->CreateScene((*scenes)[i], true);
 
     if (new_scene) {
-      merge_scenes->push_back(new_scene);
+      merge_data->scenes.push_back(new_scene);
+      merge_data->objectCount += merge_scene_object_count(new_scene);
     }
 
-    status->AddProgress((1.0f / scenes->size()) *
-                        0.9f);  // We'll call conversion 90% and merging 10% for now
+    status->AddConversionProgress(1.0f / scenes->size());
   }
 
   delete scenes;
-  status->SetData(merge_scenes);
+  status->SetData(merge_data);
 
   status->GetConverter()->AddScenesToMergeQueue(status);
 }
@@ -892,7 +948,14 @@ void BL_Converter::PrintStats()
 
     CM_Message("\tscene: " << scene->GetName())
         CM_Message("\t\t materials: " << sceneSlot.m_materials.size());
-    CM_Message("\t\t meshes: " << sceneSlot.m_meshobjects.size());
+    unsigned int numbuilt = 0;
+    for (const std::unique_ptr<RAS_MeshObject> &meshobj : sceneSlot.m_meshobjects) {
+      if (meshobj->HasDisplayArrays()) {
+        ++numbuilt;
+      }
+    }
+    CM_Message("\t\t meshes: " << sceneSlot.m_meshobjects.size() << " (" << numbuilt
+                                << " with display arrays)");
     CM_Message("\t\t interpolators: " << sceneSlot.m_interpolators.size());
   }
 
@@ -901,4 +964,14 @@ void BL_Converter::PrintStats()
   CM_Message("\t materials: " << nummat);
   CM_Message("\t meshes: " << nummesh);
   CM_Message("\t interpolators: " << numinter);
+
+  const BL_MeshConversionStats meshStats = BL_GetMeshConversionStats();
+  CM_Message(std::endl << "Mesh conversion:");
+  CM_Message("\t converted meshes: " << meshStats.meshes << " in "
+                                      << meshStats.conversionTime * 1000.0 << " ms");
+  CM_Message("\t built display arrays: " << meshStats.builtMeshes << " ("
+                                          << meshStats.builtVertices << " vertices) in "
+                                          << meshStats.buildTime * 1000.0 << " ms");
+  CM_Message("\t built tangents: " << meshStats.tangentMeshes << " in "
+                                    << meshStats.tangentTime * 1000.0 << " ms");
 }
@@ -85,6 +85,8 @@ class BL_Converter {
   // Saved KX_LibLoadStatus objects
   std::map<std::string, KX_LibLoadStatus *> m_status_map;
   std::vector<KX_LibLoadStatus *> m_mergequeue;
+  /// Time budget in seconds to merge the asynchronous libloads per frame, 0 to merge at once.
+  double m_mergeBudget;
 
   blender::Main *m_maggie;
   std::vector<blender::Main *> m_DynamicMaggie;
@@ -92,6 +94,9 @@ class BL_Converter {
   KX_KetsjiEngine *m_ketsjiEngine;
   bool m_alwaysUseExpandFraming;
 
+  /// Merge the converted asynchronous libloads in the time budget, all if the budget is 0.
+  void MergeAsyncLoads(double budget);
+
  public:
   BL_Converter(blender::Main *maggie, KX_KetsjiEngine *engine);
   virtual ~BL_Converter();
@@ -144,6 +149,9 @@ class BL_Converter {
 
   void MergeScene(KX_Scene *to, KX_Scene *from);
 
+  void SetMergeBudget(double budget);
+  double GetMergeBudget() const;
+
   void MergeAsyncLoads();
   void FinalizeAsyncLoads();
   void AddScenesToMergeQueue(KX_LibLoadStatus *status);
@@ -52,6 +52,7 @@
 #include "BL_DataConversion.h"
 
 #include <fmt/format.h>
+#include <mutex>
 
 /* This little block needed for linking to Blender... */
 #ifdef WIN32
@@ -62,6 +63,7 @@
 #include "BKE_armature.hh"
 #include "BKE_context.hh"
 #include "BKE_layer.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.hh" /* give_current_material */
 #include "BKE_mesh.hh"
@@ -70,6 +72,7 @@
 #include "BKE_object.hh"
 #include "BKE_scene.hh"
 #include "BLI_listbase.hh"
+#include "BLI_time.hh"
 #include "DEG_depsgraph_query.hh"
 #include "DNA_actuator_types.h"
 #include "DNA_meshdata_types.h"
@@ -98,6 +101,7 @@
 #include "KX_ObstacleSimulation.h"
 #include "KX_PythonComponent.h"
 #include "RAS_ICanvas.h"
+#include "RAS_IDisplayArray.h"
 #include "RAS_Vertex.h"
 #ifdef WITH_BULLET
 #  include "CcdPhysicsEnvironment.h"
@@ -343,6 +347,233 @@ static int GetPolygonMaterialIndex(const VArray<int> mat_indices, const blender:
   return r;
 }
 
+static std::mutex meshConversionStatsMutex;
+static BL_MeshConversionStats meshConversionStats = {0, 0.0, 0, 0, 0.0, 0, 0.0};
+
+BL_MeshConversionStats BL_GetMeshConversionStats()
+{
+  std::lock_guard<std::mutex> lock(meshConversionStatsMutex);
+  return meshConversionStats;
+}
+
+/** Build the display arrays of a converted mesh from a copy of the evaluated mesh.
+ * The copy shares its data with the evaluated mesh and keeps it alive when the depsgraph
+ * frees or re-evaluates the object, it is freed once the display arrays are built.
+ */
+class BL_MeshBuilder : public RAS_MeshObject::Builder {
+ private:
+  blender::Mesh *m_mesh;
+  /// The uv and color layers pointing to the data of the copied mesh.
+  RAS_MeshObject::LayerList m_layers;
+
+  void FreeMesh()
+  {
+    if (m_mesh) {
+      BKE_id_free(nullptr, m_mesh);
+      m_mesh = nullptr;
+    }
+    m_layers.clear();
+  }
+
+  /** Return the mesh to compute the tangents from: the evaluated mesh of the object, or the
+   * original mesh when the object is not evaluated. Return nullptr if its vertices don't
+   * match the converted vertices anymore.
+   */
+  static const blender::Mesh *GetTangentsMesh(RAS_MeshObject *meshobj)
+  {
+    const blender::Mesh *mesh = meshobj->GetOrigMesh();
+    blender::Object *blenderobj = meshobj->GetOriginalObject();
+    if (blenderobj) {
+      blender::bContext *C = KX_GetActiveEngine()->GetContext();
+      blender::Depsgraph *depsgraph = CTX_data_depsgraph_on_load(C);
+      blender::Object *ob_eval = depsgraph ? DEG_get_evaluated(depsgraph, blenderobj) : nullptr;
+      if (ob_eval && ob_eval->type == OB_MESH && ob_eval->data) {
+        mesh = (blender::Mesh *)ob_eval->data;
+      }
+    }
+
+    if (!mesh || mesh->verts_num != meshobj->GetConversionTotVerts()) {
+      return nullptr;
+    }
+    return mesh;
+  }
+
+ public:
+  BL_MeshBuilder(const blender::Mesh *mesh) : m_mesh(BKE_mesh_copy_for_eval(*mesh))
+  {
+    const unsigned short uvLayers = CustomData_number_of_layers(&m_mesh->corner_data,
+                                                                CD_PROP_FLOAT2);
+    const unsigned short colorLayers = CustomData_number_of_layers(&m_mesh->corner_data,
+                                                                   CD_PROP_BYTE_COLOR);
+
+    // Extract UV loops.
+    for (unsigned short i = 0; i < uvLayers; ++i) {
+      const std::string name = CustomData_get_layer_name(
+          &m_mesh->corner_data, CD_PROP_FLOAT2, i);
+      const float(*uv)[2] = (const float(*)[2])CustomData_get_layer_n(
+          &m_mesh->corner_data, CD_PROP_FLOAT2, i);
+      m_layers.push_back({uv, nullptr, i, name});
+    }
+    // Extract color loops.
+    for (unsigned short i = 0; i < colorLayers; ++i) {
+      const std::string name = CustomData_get_layer_name(
+          &m_mesh->corner_data, CD_PROP_BYTE_COLOR, i);
+      blender::MLoopCol *col = (blender::MLoopCol *)CustomData_get_layer_n(
+          &m_mesh->corner_data, CD_PROP_BYTE_COLOR, i);
+      m_layers.push_back({nullptr, col, i, name});
+    }
+  }
+
+  virtual ~BL_MeshBuilder()
+  {
+    FreeMesh();
+  }
+
+  const blender::Mesh *GetMesh() const
+  {
+    return m_mesh;
+  }
+
+  /// Return the layers without their data, the mesh object only uses their names and indices.
+  RAS_MeshObject::LayerList GetLayerNames() const
+  {
+    RAS_MeshObject::LayerList layers;
+    for (const RAS_MeshObject::Layer &layer : m_layers) {
+      layers.push_back({nullptr, nullptr, layer.index, layer.name});
+    }
+    return layers;
+  }
+
+  virtual void BuildDisplayArrays(RAS_MeshObject *meshobj)
+  {
+    const double starttime = BLI_time_now_seconds();
+
+    const unsigned short uvLayers = CustomData_number_of_layers(&m_mesh->corner_data,
+                                                                CD_PROP_FLOAT2);
+    const unsigned short colorLayers = CustomData_number_of_layers(&m_mesh->corner_data,
+                                                                   CD_PROP_BYTE_COLOR);
+
+    const unsigned short totmat = max_ii(m_mesh->totcol, 1);
+    std::vector<RAS_MeshMaterial *> meshmats(totmat);
+    for (unsigned short i = 0; i < totmat; ++i) {
+      meshmats[i] = meshobj->GetMeshMaterialBlenderIndex(i);
+    }
+
+    const bke::AttributeAccessor attributes = m_mesh->attributes();
+    const VArray<int> material_indices = *attributes.lookup_or_default<int>(
+        "material_index", bke::AttrDomain::Face, 0);
+
+    const bool *sharp_faces = static_cast<const bool *>(
+        CustomData_get_layer_named(&m_mesh->face_data, CD_PROP_BOOL, "sharp_face"));
+
+    const Span<float3> positions = m_mesh->vert_positions();
+    const Span<float3> vertex_normals = m_mesh->vert_normals();
+    const Span<float3> face_normals = m_mesh->face_normals();
+
+    // --- New version using modern triangulation ---
+    const blender::Span<blender::int3> tris = m_mesh->corner_tris();
+    const blender::Span<int> tri_faces = m_mesh->corner_tri_faces();
+    const blender::Span<int> corner_verts = m_mesh->corner_verts();
+
+    // Prepare an array to store the indices of already added vertices (for each Blender vertex)
+    std::vector<unsigned int> vertices(m_mesh->verts_num, -1);
+
+    // The tangents are set on demand by BuildTangents.
+    const MT_Vector4 tan(0.0f, 0.0f, 0.0f, 0.0f);
+
+    for (int tri_i = 0; tri_i < tris.size(); ++tri_i) {
+      int face_i = tri_faces[tri_i];
+      int mat_nr = GetPolygonMaterialIndex(material_indices, m_mesh, face_i);
+      RAS_MeshMaterial *meshmat = meshmats[mat_nr];
+
+      // For each vertex of the triangle
+      unsigned int tri_indices[3];
+      for (int j = 0; j < 3; ++j) {
+        int corner = tris[tri_i][j];
+        int vert_i = corner_verts[corner];
+
+        // If the vertex has not been added yet, add it
+        if (vertices[vert_i] == -1) {
+          const float *vp = &positions[vert_i][0];
+          const MT_Vector3 pt(vp);
+
+          // Normal: flat or smooth
+          const bool flat = (sharp_faces && sharp_faces[face_i]);
+          const float3 normal = flat ? face_normals[face_i] : vertex_normals[vert_i];
+          const MT_Vector3 no(normal.x, normal.y, normal.z);
+
+          MT_Vector2 uvs[BL_Texture::MaxUnits];
+          unsigned int rgba[BL_Texture::MaxUnits];
+
+          BL_GetUvRgba(m_layers, vert_i, uvs, rgba, uvLayers, colorLayers);
+
+          vertices[vert_i] = meshobj->AddVertex(meshmat, pt, uvs, tan, rgba, no, flat, vert_i);
+        }
+        tri_indices[j] = vertices[vert_i];
+      }
+
+      // Add the triangle
+      meshobj->AddPolygon(meshmat, 3, tri_indices);
+    }
+
+    const int totverts = m_mesh->verts_num;
+    // The tangents are computed from the evaluated or original mesh, the copy is not needed.
+    FreeMesh();
+
+    std::lock_guard<std::mutex> lock(meshConversionStatsMutex);
+    ++meshConversionStats.builtMeshes;
+    meshConversionStats.builtVertices += totverts;
+    meshConversionStats.buildTime += BLI_time_now_seconds() - starttime;
+  }
+
+  virtual void BuildTangents(RAS_MeshObject *meshobj)
+  {
+    const blender::Mesh *mesh = GetTangentsMesh(meshobj);
+    if (!mesh || CustomData_number_of_layers(&mesh->corner_data, CD_PROP_FLOAT2) == 0) {
+      return;
+    }
+
+    const double starttime = BLI_time_now_seconds();
+
+    const bke::AttributeAccessor attributes = mesh->attributes();
+    const StringRef active_uv_map = CustomData_get_active_layer_name(&mesh->corner_data,
+                                                                     CD_PROP_FLOAT2);
+    const VArraySpan uv_map = *attributes.lookup<float2>(active_uv_map, bke::AttrDomain::Corner);
+    const VArray<bool> sharp_faces =
+        attributes.lookup_or_default<bool>("sharp_face", bke::AttrDomain::Face, false).varray;
+    const Array<Array<float4>> tangent = bke::mesh::calc_uv_tangents(mesh->vert_positions(),
+                                                                     mesh->faces(),
+                                                                     mesh->corner_verts(),
+                                                                     mesh->corner_tris(),
+                                                                     mesh->corner_tri_faces(),
+                                                                     VArraySpan(sharp_faces),
+                                                                     mesh->vert_normals(),
+                                                                     mesh->face_normals(),
+                                                                     mesh->corner_normals(),
+                                                                     {uv_map});
+
+    // Only the active uv map is passed, its tangents are the first layer.
+    if (!tangent.is_empty()) {
+      const Span<float4> layer = tangent[0];
+      for (unsigned short i = 0, num = meshobj->NumMaterials(); i < num; ++i) {
+        RAS_IDisplayArray *array = meshobj->GetMeshMaterial(i)->GetDisplayArray();
+        for (unsigned int j = 0, size = array->GetVertexCount(); j < size; ++j) {
+          const unsigned int vert_i = array->GetVertexInfo(j).getOrigIndex();
+          if (vert_i < layer.size()) {
+            const float4 &t = layer[vert_i];
+            array->GetVertex(j)->SetTangent(MT_Vector4(t.x, t.y, t.z, t.w));
+          }
+        }
+        array->AppendModifiedFlag(RAS_IDisplayArray::TANGENT_MODIFIED);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(meshConversionStatsMutex);
+    ++meshConversionStats.tangentMeshes;
+    meshConversionStats.tangentTime += BLI_time_now_seconds() - starttime;
+  }
+};
+
 /* blenderobj can be nullptr, make sure its checked for */
 RAS_MeshObject *BL_ConvertMesh(Mesh *mesh,
                                Object *blenderobj,
@@ -365,81 +596,43 @@ RAS_MeshObject *BL_ConvertMesh(Mesh *mesh,
     }
   }
 
+  const double starttime = BLI_time_now_seconds();
+
   // Get blender::Mesh data
   blender::bContext *C = KX_GetActiveEngine()->GetContext();
   blender::Depsgraph *depsgraph = CTX_data_depsgraph_on_load(C);
   blender::Object *ob_eval = DEG_get_evaluated(depsgraph, blenderobj);
   blender::Mesh *final_me = (blender::Mesh *)ob_eval->data;
 
-  const blender::Span<blender::float3> positions = final_me->vert_positions();
-  const int totverts = final_me->verts_num;
+  /* The vertices and polygons are converted on first use from a copy of the evaluated mesh
+   * owned by the builder. */
+  BL_MeshBuilder *builder = new BL_MeshBuilder(final_me);
+  const blender::Mesh *me = builder->GetMesh();
 
   /* Extract available layers.
    * Get the active color and uv layer. */
-  const short activeUv = CustomData_get_active_layer(&final_me->corner_data, CD_PROP_FLOAT2);
-  const short activeColor = CustomData_get_active_layer(&final_me->corner_data,
-                                                        CD_PROP_BYTE_COLOR);
+  const short activeUv = CustomData_get_active_layer(&me->corner_data, CD_PROP_FLOAT2);
+  const short activeColor = CustomData_get_active_layer(&me->corner_data, CD_PROP_BYTE_COLOR);
 
   RAS_MeshObject::LayersInfo layersInfo;
   layersInfo.activeUv = (activeUv == -1) ? 0 : activeUv;
   layersInfo.activeColor = (activeColor == -1) ? 0 : activeColor;
 
-  const unsigned short uvLayers = CustomData_number_of_layers(&final_me->corner_data,
-                                                              CD_PROP_FLOAT2);
-  const unsigned short colorLayers = CustomData_number_of_layers(&final_me->corner_data,
+  const unsigned short uvLayers = CustomData_number_of_layers(&me->corner_data, CD_PROP_FLOAT2);
+  const unsigned short colorLayers = CustomData_number_of_layers(&me->corner_data,
                                                                  CD_PROP_BYTE_COLOR);
 
-  // Extract UV loops.
-  for (unsigned short i = 0; i < uvLayers; ++i) {
-    const std::string name = CustomData_get_layer_name(&final_me->corner_data, CD_PROP_FLOAT2, i);
-    const float(*uv)[2] = (const float(*)[2])CustomData_get_layer_n(
-        &final_me->corner_data, CD_PROP_FLOAT2, i);
-    layersInfo.layers.push_back({uv, nullptr, i, name});
-  }
-  // Extract color loops.
-  for (unsigned short i = 0; i < colorLayers; ++i) {
-    const std::string name = CustomData_get_layer_name(
-        &final_me->corner_data, CD_PROP_BYTE_COLOR, i);
-    blender::MLoopCol *col = (blender::MLoopCol *)CustomData_get_layer_n(
-        &final_me->corner_data, CD_PROP_BYTE_COLOR, i);
-    layersInfo.layers.push_back({nullptr, col, i, name});
-  }
+  layersInfo.layers = builder->GetLayerNames();
 
-  const bke::AttributeAccessor attributes = final_me->attributes();
-
-  Array<Array<float4>> tangent = {};
-  if (uvLayers > 0) {
-    const StringRef active_uv_map = CustomData_get_active_layer_name(&final_me->corner_data, CD_PROP_FLOAT2);
-    const VArraySpan uv_map = *attributes.lookup<float2>(active_uv_map, bke::AttrDomain::Corner);
-    const VArray<bool> sharp_faces =
-        attributes.lookup_or_default<bool>("sharp_face", bke::AttrDomain::Face, false).varray;
-    tangent = bke::mesh::calc_uv_tangents(positions,
-                                          final_me->faces(),
-                                          final_me->corner_verts(),
-                                          final_me->corner_tris(),
-                                          final_me->corner_tri_faces(),
-                                          VArraySpan(sharp_faces),
-                                          final_me->vert_normals(),
-                                          final_me->face_normals(),
-                                          final_me->corner_normals(),
-                                          {uv_map});
-  }
-
-  meshobj = new RAS_MeshObject(mesh, final_me->verts_num, blenderobj, layersInfo);
-  meshobj->m_sharedvertex_map.resize(totverts);
+  meshobj = new RAS_MeshObject(mesh, me->verts_num, blenderobj, layersInfo);
+  meshobj->SetBuilder(builder);
 
   // Initialize vertex format with used uv and color layers.
   RAS_VertexFormat vertformat;
   vertformat.uvSize = max_ii(1, uvLayers);
   vertformat.colorSize = max_ii(1, colorLayers);
 
-  struct ConvertedMaterial {
-    blender::Material *ma;
-    RAS_MeshMaterial *meshmat;
-  };
-
-  const unsigned short totmat = max_ii(final_me->totcol, 1);
-  std::vector<ConvertedMaterial> convertedMats(totmat);
+  const unsigned short totmat = max_ii(me->totcol, 1);
 
   // Convert all the materials contained in the mesh.
   for (unsigned short i = 0; i < totmat; ++i) {
@@ -448,7 +641,7 @@ RAS_MeshObject *BL_ConvertMesh(Mesh *mesh,
       ma = BKE_object_material_get(ob_eval, i + 1);
     }
     else {
-      ma = final_me->mat ? final_me->mat[i] : nullptr;
+      ma = me->mat ? me->mat[i] : nullptr;
     }
     // Check for blender material
     if (!ma) {
@@ -457,78 +650,9 @@ RAS_MeshObject *BL_ConvertMesh(Mesh *mesh,
 
     RAS_MaterialBucket *bucket = BL_material_from_mesh(
         ma, lightlayer, scene, rasty, converter, converting_during_runtime);
-    RAS_MeshMaterial *meshmat = meshobj->AddMaterial(bucket, i, vertformat);
-
-    convertedMats[i] = {ma,
-                        meshmat};
-  }
-
-  const VArray<int> material_indices = *attributes.lookup_or_default<int>(
-      "material_index", bke::AttrDomain::Face, 0);
-
-  const bool *sharp_faces = static_cast<const bool *>(
-      CustomData_get_layer_named(&final_me->face_data, CD_PROP_BOOL, "sharp_face"));
-
-  const Span<float3> vertex_normals = final_me->vert_normals();
-  const Span<float3> face_normals = final_me->face_normals();
-
-  // --- New version using modern triangulation ---
-  const blender::Span<blender::int3> tris = final_me->corner_tris();
-  const blender::Span<int> tri_faces = final_me->corner_tri_faces();
-  const blender::Span<int> corner_verts = final_me->corner_verts();
-
-  // Prepare an array to store the indices of already added vertices (for each Blender vertex)
-  std::vector<unsigned int> vertices(totverts, -1);
-
-  for (int tri_i = 0; tri_i < tris.size(); ++tri_i) {
-    int face_i = tri_faces[tri_i];
-    int mat_nr = GetPolygonMaterialIndex(material_indices, final_me, face_i);
-    const ConvertedMaterial &mat = convertedMats[mat_nr];
-    RAS_MeshMaterial *meshmat = mat.meshmat;
-
-    // For each vertex of the triangle
-    unsigned int tri_indices[3];
-    for (int j = 0; j < 3; ++j) {
-      int corner = tris[tri_i][j];
-      int vert_i = corner_verts[corner];
-
-      // If the vertex has not been added yet, add it
-      if (vertices[vert_i] == -1) {
-        const float *vp = &positions[vert_i][0];
-        const MT_Vector3 pt(vp);
-
-        // Normal: flat or smooth
-        const bool flat = (sharp_faces && sharp_faces[face_i]);
-        const float3 normal = flat ? face_normals[face_i] : vertex_normals[vert_i];
-        const MT_Vector3 no(normal.x, normal.y, normal.z);
-
-        int tangent_layer = layersInfo.activeUv;
-        MT_Vector4 tan(0.0f, 0.0f, 0.0f, 0.0f);
-        if (!tangent.is_empty() && tangent_layer < tangent.size() &&
-            vert_i < tangent[tangent_layer].size())
-        {
-          const float4 &t = tangent[tangent_layer][vert_i];
-          tan = MT_Vector4(t.x, t.y, t.z, t.w);
-        }
-        MT_Vector2 uvs[BL_Texture::MaxUnits];
-        unsigned int rgba[BL_Texture::MaxUnits];
-
-        BL_GetUvRgba(layersInfo.layers, vert_i, uvs, rgba, uvLayers, colorLayers);
-
-        vertices[vert_i] = meshobj->AddVertex(meshmat, pt, uvs, tan, rgba, no, flat, vert_i);
-      }
-      tri_indices[j] = vertices[vert_i];
-    }
-
-    // Add the triangle
-    meshobj->AddPolygon(meshmat, 3, tri_indices);
+    meshobj->AddMaterial(bucket, i, vertformat);
   }
 
-  // keep meshobj->m_sharedvertex_map for reinstance phys mesh.
-  // 2.49a and before it did: meshobj->m_sharedvertex_map.clear();
-  // but this didnt save much ram. - Campbell
-  meshobj->EndConversion();
-
   // Finalize materials.
   // However, we want to delay this if we're libloading so we can make sure we have the right
   // scene.
@@ -540,6 +664,13 @@ RAS_MeshObject *BL_ConvertMesh(Mesh *mesh,
   }
 
   converter->RegisterGameMesh(meshobj, mesh);
+
+  {
+    std::lock_guard<std::mutex> lock(meshConversionStatsMutex);
+    ++meshConversionStats.meshes;
+    meshConversionStats.conversionTime += BLI_time_now_seconds() - starttime;
+  }
+
   return meshobj;
 }
 
@@ -1087,7 +1218,8 @@ static void bl_ConvertBlenderObject_Single(BL_SceneConverter *converter,
                           nullptr,
                           nullptr,
                           KX_Scene::KX_ScenegraphUpdateFunc,
-                          KX_Scene::KX_ScenegraphRescheduleFunc);
+                          KX_Scene::KX_ScenegraphRescheduleFunc,
+                          nullptr);
     SG_Node *parentinversenode = new SG_Node(nullptr, kxscene, callback);
 
     // Define a normal parent relationship for this node.
@@ -1145,6 +1277,7 @@ static void bl_ConvertBlenderObject_Single(BL_SceneConverter *converter,
 
   if (isInActiveLayer) {
     objectlist->Add(CM_AddRef(gameobj));
+    kxscene->RegisterNetworkObject(gameobj);
     // tf.Add(gameobj->GetSGNode());
 
     gameobj->NodeUpdateGS(0);
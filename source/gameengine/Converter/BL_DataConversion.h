@@ -45,6 +45,21 @@ struct Main;
 }  // namespace blender
 
 
+/// Statistics of the converted meshes, their display arrays are built on first use.
+struct BL_MeshConversionStats {
+  unsigned int meshes;
+  /// Time spent converting the meshes and their materials in seconds.
+  double conversionTime;
+  unsigned int builtMeshes;
+  unsigned long long builtVertices;
+  /// Time spent building the display arrays in seconds.
+  double buildTime;
+  unsigned int tangentMeshes;
+  double tangentTime;
+};
+
+BL_MeshConversionStats BL_GetMeshConversionStats();
+
 class RAS_MeshObject *BL_ConvertMesh(blender::Mesh *mesh,
                                      blender::Object *lightobj,
                                      class KX_Scene *scene,
@@ -0,0 +1,101 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file EXP_Bytecode.h
+ *  \ingroup expressions
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "EXP_IntValue.h"
+
+class EXP_Expression;
+
+/** Stack program compiled once from an expression tree.
+ * Only integers, floats and booleans are supported: an expression using another kind of
+ * constant is not compiled, and an evaluation reaching an operation the values would report
+ * as an error fails, the caller then falls back to the expression tree which reports it.
+ * The identifiers are not resolved by the program, their values are read from an input array
+ * filled by the caller before each evaluation. The evaluation doesn't allocate memory.
+ */
+class EXP_Bytecode {
+ public:
+  enum ValueType : unsigned char { TYPE_INT, TYPE_FLOAT, TYPE_BOOL };
+
+  struct Value {
+    ValueType m_type;
+    union {
+      cInt m_int;
+      float m_float;
+      bool m_bool;
+    };
+
+    /// Copy an expression value, return false if its type is not supported.
+    bool Set(EXP_Value *value);
+    void SetBool(bool value);
+    double GetNumber() const;
+  };
+
+ private:
+  enum Opcode : unsigned char {
+    /// Push the constant m_index.
+    OP_CONSTANT,
+    /// Push the input of the identifier m_index.
+    OP_IDENTIFIER,
+    /// Replace the top value by the result of the unary operator.
+    OP_UNARY,
+    /// Pop two values and push the result of the binary operator.
+    OP_BINARY,
+    /// Pop a boolean guard and jump to the instruction m_index if false.
+    OP_JUMP_FALSE,
+    /// Jump to the instruction m_index.
+    OP_JUMP
+  };
+
+  struct Instruction {
+    Opcode m_opcode;
+    VALUE_OPERATOR m_operator;
+    unsigned int m_index;
+  };
+
+  std::vector<Instruction> m_instructions;
+  std::vector<Value> m_constants;
+  std::vector<std::string> m_identifiers;
+  /// Evaluation stack, sized during the compilation.
+  std::vector<Value> m_stack;
+  /// Stack depth reached by the instructions added so far.
+  unsigned int m_depth;
+
+  void AddInstruction(Opcode opcode, VALUE_OPERATOR op, unsigned int index, int depthDelta);
+
+ public:
+  EXP_Bytecode();
+
+  /// Compile an expression tree, return false and leave the program empty if not supported.
+  bool Compile(EXP_Expression *expr);
+  void Clear();
+  bool IsValid() const;
+
+  /// Names of the identifiers, the evaluation inputs follow the same order.
+  const std::vector<std::string> &GetIdentifiers() const;
+
+  /** Run the program with the identifier values in inputs.
+   * \return False if an operation is not supported, result is then undefined.
+   */
+  bool Evaluate(const Value *inputs, Value &result);
+
+  /// Functions used by the expressions to emit their instructions.
+  bool AddConstant(EXP_Value *value);
+  void AddIdentifier(const std::string &name);
+  void AddUnary(VALUE_OPERATOR op);
+  void AddBinary(VALUE_OPERATOR op);
+  /** Add a jump with an unset target, returning its position for PatchJump.
+   * An unconditional jump ends the first branch of a condition, the second branch starts
+   * back at the stack depth preceding the first.
+   */
+  unsigned int AddJump(bool conditional);
+  /// Make a jump target the next added instruction.
+  void PatchJump(unsigned int position);
+};
@@ -20,6 +20,8 @@
 
 #include "EXP_Value.h"
 
+class EXP_Bytecode;
+
 class EXP_Expression : public CM_RefCount<EXP_Expression> {
  public:
   enum {
@@ -39,4 +41,6 @@ class EXP_Expression : public CM_RefCount<EXP_Expression> {
 
   virtual EXP_Value *Calculate() = 0;
   virtual unsigned char GetExpressionID() = 0;
+  /// Emit the instructions of the expression, return false if not supported by the bytecode.
+  virtual bool Compile(EXP_Bytecode &bytecode);
 };
@@ -101,6 +101,22 @@ template<class ItemType> class EXP_ListValue : public EXP_BaseListValue {
     return nullptr;
   }
 
+  /// Move the items matching a function at the end of an other list, keeping their references.
+  void MoveIf(EXP_ListValue<ItemType> *otherlist, std::function<bool(ItemType *)> function)
+  {
+    unsigned int size = 0;
+    for (EXP_Value *val : m_pValueArray) {
+      ItemType *item = static_cast<ItemType *>(val);
+      if (function(item)) {
+        otherlist->Add(item);
+      }
+      else {
+        m_pValueArray[size++] = val;
+      }
+    }
+    m_pValueArray.resize(size);
+  }
+
   void MergeList(EXP_ListValue<ItemType> *otherlist)
   {
     const unsigned int numelements = GetCount();
@@ -28,6 +28,7 @@ class EXP_Operator1Expr : public EXP_Expression {
 
   virtual unsigned char GetExpressionID();
   virtual EXP_Value *Calculate();
+  virtual bool Compile(EXP_Bytecode &bytecode);
 
  private:
   VALUE_OPERATOR m_op;
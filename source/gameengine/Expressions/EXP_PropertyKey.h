@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file EXP_PropertyKey.h
+ *  \ingroup expressions
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+/** Interned property name.
+ * All the keys created from the same name share the same string, comparing two keys
+ * is then a pointer comparison. An interned name is freed with the last key using it.
+ * A key can be constructed once by a caller looking up the same property every frame
+ * to avoid comparing the names at each lookup.
+ */
+class EXP_PropertyKey {
+ public:
+  /// Interned name shared by the keys.
+  struct Name {
+    std::string name;
+    /// Number of keys sharing the name.
+    std::atomic<unsigned int> users;
+  };
+
+ private:
+  /// The interned name, nullptr for an invalid key.
+  Name *m_name;
+
+  void Release();
+
+ public:
+  /// Construct an invalid key, matching no property.
+  EXP_PropertyKey();
+  /// Construct the key of a name, interning the name if needed.
+  explicit EXP_PropertyKey(const std::string &name);
+  EXP_PropertyKey(const EXP_PropertyKey &other);
+  EXP_PropertyKey(EXP_PropertyKey &&other) noexcept;
+  ~EXP_PropertyKey();
+
+  EXP_PropertyKey &operator=(const EXP_PropertyKey &other);
+  EXP_PropertyKey &operator=(EXP_PropertyKey &&other) noexcept;
+
+  bool IsValid() const
+  {
+    return m_name != nullptr;
+  }
+
+  const std::string &GetName() const
+  {
+    return m_name->name;
+  }
+
+  bool operator==(const EXP_PropertyKey &other) const
+  {
+    return m_name == other.m_name;
+  }
+
+  bool operator!=(const EXP_PropertyKey &other) const
+  {
+    return m_name != other.m_name;
+  }
+};
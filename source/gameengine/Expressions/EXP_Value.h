@@ -22,11 +22,15 @@
 #  pragma warning(disable : 4786)
 #endif
 
-#include <map>     // Array functionality for the property list.
+#include <map>
 #include <string>  // std::string class.
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "CM_RefCount.h"
+#include "EXP_PropertyKey.h"
 
 #ifndef GEN_NO_TRACE
 #  undef trace
@@ -128,6 +132,9 @@ class EXP_Value : public EXP_PyObjectPlus, public CM_RefCount<EXP_Value> {
   /// needed.
   virtual void SetProperty(const std::string &name, EXP_Value *ioProperty);
   virtual EXP_Value *GetProperty(const std::string &inName);
+  /// Same as above but using a precomputed key, avoid to compare the names for frequent lookups.
+  void SetProperty(const EXP_PropertyKey &key, EXP_Value *ioProperty);
+  EXP_Value *GetProperty(const EXP_PropertyKey &key);
   /// Get text description of property with name <inName>, returns an empty string if there is no
   /// property named <inName>.
   const std::string GetPropertyText(const std::string &inName);
@@ -138,6 +145,8 @@ class EXP_Value : public EXP_PyObjectPlus, public CM_RefCount<EXP_Value> {
   virtual std::vector<std::string> GetPropertyNames();
   /// Clear all properties.
   virtual void ClearProperties();
+  /// Replace all properties by replicas of the properties of <other>.
+  void ReplicateProperties(EXP_Value *other);
 
   /// Get property number <inIndex>.
   virtual EXP_Value *GetProperty(int inIndex);
@@ -170,8 +179,16 @@ class EXP_Value : public EXP_PyObjectPlus, public CM_RefCount<EXP_Value> {
   virtual void DestructFromPython();
 
  private:
-  /// Properties for user/game etc.
-  std::map<std::string, EXP_Value *> m_properties;
+  /** Properties for user/game etc, in insertion order.
+   * The lookups by key compare the interned keys linearly, objects own few properties and
+   * the replication copies a single array.
+   */
+  std::vector<std::pair<EXP_PropertyKey, EXP_Value *>> m_properties;
+  /// Properties indexed by their name for the lookups by string, the views use the key names.
+  std::unordered_map<std::string_view, EXP_Value *> m_propertyIndex;
+
+  /// Rebuild the name index after the property values were replaced.
+  void RebuildPropertyIndex();
 };
 
 /** EXP_PropValue is a EXP_Value derived class, that implements the identification (String name)
@@ -0,0 +1,419 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file gameengine/Expressions/intern/Bytecode.cpp
+ *  \ingroup expressions
+ */
+
+#include "EXP_Bytecode.h"
+
+#include <cmath>
+
+#include "EXP_BoolValue.h"
+#include "EXP_Expression.h"
+#include "EXP_FloatValue.h"
+
+using namespace blender;
+
+bool EXP_Bytecode::Value::Set(EXP_Value *value)
+{
+  switch (value->GetValueType()) {
+    case VALUE_INT_TYPE: {
+      m_type = TYPE_INT;
+      m_int = static_cast<EXP_IntValue *>(value)->GetInt();
+      return true;
+    }
+    case VALUE_FLOAT_TYPE: {
+      m_type = TYPE_FLOAT;
+      m_float = static_cast<EXP_FloatValue *>(value)->GetFloat();
+      return true;
+    }
+    case VALUE_BOOL_TYPE: {
+      m_type = TYPE_BOOL;
+      m_bool = static_cast<EXP_BoolValue *>(value)->GetBool();
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+void EXP_Bytecode::Value::SetBool(bool value)
+{
+  m_type = TYPE_BOOL;
+  m_bool = value;
+}
+
+double EXP_Bytecode::Value::GetNumber() const
+{
+  switch (m_type) {
+    case TYPE_INT: {
+      return (double)m_int;
+    }
+    case TYPE_FLOAT: {
+      return (double)m_float;
+    }
+    case TYPE_BOOL: {
+      return m_bool ? 1.0 : 0.0;
+    }
+  }
+
+  return 0.0;
+}
+
+/// Unary operators, matching EXP_EmptyValue::Calc applied on the operand.
+static bool calc_unary(VALUE_OPERATOR op, EXP_Bytecode::Value &value)
+{
+  switch (value.m_type) {
+    case EXP_Bytecode::TYPE_INT: {
+      switch (op) {
+        case VALUE_NEG_OPERATOR: {
+          value.m_int = -value.m_int;
+          return true;
+        }
+        case VALUE_POS_OPERATOR: {
+          return true;
+        }
+        case VALUE_NOT_OPERATOR: {
+          value.SetBool(value.m_int == 0);
+          return true;
+        }
+        default: {
+          return false;
+        }
+      }
+    }
+    case EXP_Bytecode::TYPE_FLOAT: {
+      switch (op) {
+        case VALUE_NEG_OPERATOR: {
+          value.m_float = -value.m_float;
+          return true;
+        }
+        case VALUE_POS_OPERATOR: {
+          return true;
+        }
+        case VALUE_NOT_OPERATOR: {
+          value.SetBool(value.m_float == 0.0f);
+          return true;
+        }
+        default: {
+          return false;
+        }
+      }
+    }
+    case EXP_Bytecode::TYPE_BOOL: {
+      if (op == VALUE_NOT_OPERATOR) {
+        value.m_bool = !value.m_bool;
+        return true;
+      }
+      return false;
+    }
+  }
+
+  return false;
+}
+
+/** Binary operators, matching EXP_Value::Calc and the CalcFinal of the int, float and bool
+ * values: integers are converted to float when mixed with a float, divisions by zero and
+ * operations between a boolean and a number are errors. */
+static bool calc_binary(VALUE_OPERATOR op,
+                        const EXP_Bytecode::Value &lhs,
+                        const EXP_Bytecode::Value &rhs,
+                        EXP_Bytecode::Value &result)
+{
+  if (lhs.m_type == EXP_Bytecode::TYPE_BOOL || rhs.m_type == EXP_Bytecode::TYPE_BOOL) {
+    if (lhs.m_type != rhs.m_type) {
+      return false;
+    }
+    switch (op) {
+      case VALUE_AND_OPERATOR: {
+        result.SetBool(lhs.m_bool && rhs.m_bool);
+        return true;
+      }
+      case VALUE_OR_OPERATOR: {
+        result.SetBool(lhs.m_bool || rhs.m_bool);
+        return true;
+      }
+      case VALUE_EQL_OPERATOR: {
+        result.SetBool(lhs.m_bool == rhs.m_bool);
+        return true;
+      }
+      case VALUE_NEQ_OPERATOR: {
+        result.SetBool(lhs.m_bool != rhs.m_bool);
+        return true;
+      }
+      default: {
+        return false;
+      }
+    }
+  }
+
+  if (lhs.m_type == EXP_Bytecode::TYPE_INT && rhs.m_type == EXP_Bytecode::TYPE_INT) {
+    const cInt a = lhs.m_int;
+    const cInt b = rhs.m_int;
+    result.m_type = EXP_Bytecode::TYPE_INT;
+    switch (op) {
+      case VALUE_MOD_OPERATOR: {
+        if (b == 0) {
+          return false;
+        }
+        result.m_int = a % b;
+        return true;
+      }
+      case VALUE_ADD_OPERATOR: {
+        result.m_int = a + b;
+        return true;
+      }
+      case VALUE_SUB_OPERATOR: {
+        result.m_int = a - b;
+        return true;
+      }
+      case VALUE_MUL_OPERATOR: {
+        result.m_int = a * b;
+        return true;
+      }
+      case VALUE_DIV_OPERATOR: {
+        if (b == 0) {
+          return false;
+        }
+        result.m_int = a / b;
+        return true;
+      }
+      case VALUE_EQL_OPERATOR: {
+        result.SetBool(a == b);
+        return true;
+      }
+      case VALUE_NEQ_OPERATOR: {
+        result.SetBool(a != b);
+        return true;
+      }
+      case VALUE_GRE_OPERATOR: {
+        result.SetBool(a > b);
+        return true;
+      }
+      case VALUE_LES_OPERATOR: {
+        result.SetBool(a < b);
+        return true;
+      }
+      case VALUE_GEQ_OPERATOR: {
+        result.SetBool(a >= b);
+        return true;
+      }
+      case VALUE_LEQ_OPERATOR: {
+        result.SetBool(a <= b);
+        return true;
+      }
+      default: {
+        return false;
+      }
+    }
+  }
+
+  const float a = (lhs.m_type == EXP_Bytecode::TYPE_INT) ? (float)lhs.m_int : lhs.m_float;
+  const float b = (rhs.m_type == EXP_Bytecode::TYPE_INT) ? (float)rhs.m_int : rhs.m_float;
+  // The modulo is computed in double from the unconverted integer.
+  const double da = lhs.GetNumber();
+  const double db = rhs.GetNumber();
+  // result can be lhs, it's only written once the operands are read.
+  result.m_type = EXP_Bytecode::TYPE_FLOAT;
+  switch (op) {
+    case VALUE_MOD_OPERATOR: {
+      result.m_float = (float)std::fmod(da, db);
+      return true;
+    }
+    case VALUE_ADD_OPERATOR: {
+      result.m_float = a + b;
+      return true;
+    }
+    case VALUE_SUB_OPERATOR: {
+      result.m_float = a - b;
+      return true;
+    }
+    case VALUE_MUL_OPERATOR: {
+      result.m_float = a * b;
+      return true;
+    }
+    case VALUE_DIV_OPERATOR: {
+      if (b == 0.0f) {
+        return false;
+      }
+      result.m_float = a / b;
+      return true;
+    }
+    case VALUE_EQL_OPERATOR: {
+      result.SetBool(a == b);
+      return true;
+    }
+    case VALUE_NEQ_OPERATOR: {
+      result.SetBool(a != b);
+      return true;
+    }
+    case VALUE_GRE_OPERATOR: {
+      result.SetBool(a > b);
+      return true;
+    }
+    case VALUE_LES_OPERATOR: {
+      result.SetBool(a < b);
+      return true;
+    }
+    case VALUE_GEQ_OPERATOR: {
+      result.SetBool(a >= b);
+      return true;
+    }
+    case VALUE_LEQ_OPERATOR: {
+      result.SetBool(a <= b);
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+EXP_Bytecode::EXP_Bytecode() : m_depth(0)
+{
+}
+
+bool EXP_Bytecode::Compile(EXP_Expression *expr)
+{
+  Clear();
+
+  if (!expr->Compile(*this)) {
+    Clear();
+    return false;
+  }
+
+  return true;
+}
+
+void EXP_Bytecode::Clear()
+{
+  m_instructions.clear();
+  m_constants.clear();
+  m_identifiers.clear();
+  m_stack.clear();
+  m_depth = 0;
+}
+
+bool EXP_Bytecode::IsValid() const
+{
+  return !m_instructions.empty();
+}
+
+const std::vector<std::string> &EXP_Bytecode::GetIdentifiers() const
+{
+  return m_identifiers;
+}
+
+bool EXP_Bytecode::Evaluate(const Value *inputs, Value &result)
+{
+  Value *stack = m_stack.data();
+  // Index of the next free stack slot.
+  unsigned int top = 0;
+
+  const unsigned int size = m_instructions.size();
+  for (unsigned int i = 0; i < size;) {
+    const Instruction &instruction = m_instructions[i++];
+    switch (instruction.m_opcode) {
+      case OP_CONSTANT: {
+        stack[top++] = m_constants[instruction.m_index];
+        break;
+      }
+      case OP_IDENTIFIER: {
+        stack[top++] = inputs[instruction.m_index];
+        break;
+      }
+      case OP_UNARY: {
+        if (!calc_unary(instruction.m_operator, stack[top - 1])) {
+          return false;
+        }
+        break;
+      }
+      case OP_BINARY: {
+        --top;
+        if (!calc_binary(instruction.m_operator, stack[top - 1], stack[top], stack[top - 1])) {
+          return false;
+        }
+        break;
+      }
+      case OP_JUMP_FALSE: {
+        const Value &guard = stack[--top];
+        // EXP_IfExpr only accepts a boolean guard.
+        if (guard.m_type != TYPE_BOOL) {
+          return false;
+        }
+        if (!guard.m_bool) {
+          i = instruction.m_index;
+        }
+        break;
+      }
+      case OP_JUMP: {
+        i = instruction.m_index;
+        break;
+      }
+    }
+  }
+
+  result = stack[0];
+  return true;
+}
+
+void EXP_Bytecode::AddInstruction(Opcode opcode,
+                                  VALUE_OPERATOR op,
+                                  unsigned int index,
+                                  int depthDelta)
+{
+  m_instructions.push_back({opcode, op, index});
+  m_depth += depthDelta;
+  if (m_depth > m_stack.size()) {
+    m_stack.resize(m_depth);
+  }
+}
+
+bool EXP_Bytecode::AddConstant(EXP_Value *value)
+{
+  Value constant;
+  if (!constant.Set(value)) {
+    return false;
+  }
+
+  m_constants.push_back(constant);
+  AddInstruction(OP_CONSTANT, VALUE_NO_OPERATOR, m_constants.size() - 1, 1);
+  return true;
+}
+
+void EXP_Bytecode::AddIdentifier(const std::string &name)
+{
+  unsigned int index = 0;
+  const unsigned int size = m_identifiers.size();
+  while (index < size && m_identifiers[index] != name) {
+    ++index;
+  }
+  if (index == size) {
+    m_identifiers.push_back(name);
+  }
+
+  AddInstruction(OP_IDENTIFIER, VALUE_NO_OPERATOR, index, 1);
+}
+
+void EXP_Bytecode::AddUnary(VALUE_OPERATOR op)
+{
+  AddInstruction(OP_UNARY, op, 0, 0);
+}
+
+void EXP_Bytecode::AddBinary(VALUE_OPERATOR op)
+{
+  AddInstruction(OP_BINARY, op, 0, -1);
+}
+
+unsigned int EXP_Bytecode::AddJump(bool conditional)
+{
+  // Both jumps remove a value from the tracked depth: the guard, or the first branch result.
+  AddInstruction(conditional ? OP_JUMP_FALSE : OP_JUMP, VALUE_NO_OPERATOR, 0, -1);
+  return m_instructions.size() - 1;
+}
+
+void EXP_Bytecode::PatchJump(unsigned int position)
+{
+  m_instructions[position].m_index = m_instructions.size();
+}
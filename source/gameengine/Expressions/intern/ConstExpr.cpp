@@ -18,6 +18,8 @@
 
 #include "EXP_ConstExpr.h"
 
+#include "EXP_Bytecode.h"
+
 using namespace blender;
 
 EXP_ConstExpr::EXP_ConstExpr()
@@ -36,6 +38,11 @@ EXP_ConstExpr::~EXP_ConstExpr()
   }
 }
 
+bool EXP_ConstExpr::Compile(EXP_Bytecode &bytecode)
+{
+  return bytecode.AddConstant(m_value);
+}
+
 unsigned char EXP_ConstExpr::GetExpressionID()
 {
   return CCONSTEXPRESSIONID;
@@ -25,3 +25,8 @@ EXP_Expression::EXP_Expression()
 EXP_Expression::~EXP_Expression()
 {
 }
+
+bool EXP_Expression::Compile(EXP_Bytecode & /*bytecode*/)
+{
+  return false;
+}
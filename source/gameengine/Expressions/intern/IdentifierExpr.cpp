@@ -31,6 +31,8 @@
 
 #include "EXP_IdentifierExpr.h"
 
+#include "EXP_Bytecode.h"
+
 using namespace blender;
 
 EXP_IdentifierExpr::EXP_IdentifierExpr(const std::string &identifier, EXP_Value *id_context)
@@ -61,6 +63,13 @@ EXP_Value *EXP_IdentifierExpr::Calculate()
   return result;
 }
 
+bool EXP_IdentifierExpr::Compile(EXP_Bytecode &bytecode)
+{
+  // The identifier is resolved by the caller of the evaluation, owner of the context.
+  bytecode.AddIdentifier(m_identifier);
+  return true;
+}
+
 unsigned char EXP_IdentifierExpr::GetExpressionID()
 {
   return CIDENTIFIEREXPRESSIONID;
@@ -17,6 +17,8 @@
 
 #include "EXP_IfExpr.h"
 
+#include "EXP_Bytecode.h"
+
 #include "EXP_BoolValue.h"
 #include "EXP_ErrorValue.h"
 
@@ -63,6 +65,27 @@ EXP_Value *EXP_IfExpr::Calculate()
   }
 }
 
+bool EXP_IfExpr::Compile(EXP_Bytecode &bytecode)
+{
+  if (!m_guard->Compile(bytecode)) {
+    return false;
+  }
+
+  const unsigned int elsejump = bytecode.AddJump(true);
+  if (!m_e1->Compile(bytecode)) {
+    return false;
+  }
+
+  const unsigned int endjump = bytecode.AddJump(false);
+  bytecode.PatchJump(elsejump);
+  if (!m_e2->Compile(bytecode)) {
+    return false;
+  }
+
+  bytecode.PatchJump(endjump);
+  return true;
+}
+
 unsigned char EXP_IfExpr::GetExpressionID()
 {
   return CIFEXPRESSIONID;
@@ -17,6 +17,8 @@
 
 #include "EXP_Operator1Expr.h"
 
+#include "EXP_Bytecode.h"
+
 #include "EXP_EmptyValue.h"
 
 using namespace blender;
@@ -36,6 +38,16 @@ EXP_Operator1Expr::~EXP_Operator1Expr()
   }
 }
 
+bool EXP_Operator1Expr::Compile(EXP_Bytecode &bytecode)
+{
+  if (!m_lhs->Compile(bytecode)) {
+    return false;
+  }
+
+  bytecode.AddUnary(m_op);
+  return true;
+}
+
 unsigned char EXP_Operator1Expr::GetExpressionID()
 {
   return COPERATOR1EXPRESSIONID;
@@ -17,6 +17,8 @@
 
 #include "EXP_Operator2Expr.h"
 
+#include "EXP_Bytecode.h"
+
 using namespace blender;
 
 EXP_Operator2Expr::EXP_Operator2Expr(VALUE_OPERATOR op, EXP_Expression *lhs, EXP_Expression *rhs)
@@ -38,6 +40,16 @@ EXP_Operator2Expr::~EXP_Operator2Expr()
   }
 }
 
+bool EXP_Operator2Expr::Compile(EXP_Bytecode &bytecode)
+{
+  if (!m_lhs->Compile(bytecode) || !m_rhs->Compile(bytecode)) {
+    return false;
+  }
+
+  bytecode.AddBinary(m_op);
+  return true;
+}
+
 unsigned char EXP_Operator2Expr::GetExpressionID()
 {
   return COPERATOR2EXPRESSIONID;
@@ -0,0 +1,107 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file gameengine/Expressions/intern/PropertyKey.cpp
+ *  \ingroup expressions
+ */
+
+#include "EXP_PropertyKey.h"
+
+#include <string_view>
+#include <unordered_map>
+
+#include "CM_Thread.h"
+
+using namespace blender;
+
+/* The names are allocated once and indexed by a view of their string. Keys are created and
+ * released during the conversion in other threads, the table is then protected by a lock.
+ * Copying a key only increments the users of a name already held, without lock. */
+static std::unordered_map<std::string_view, EXP_PropertyKey::Name *> &get_names()
+{
+  static std::unordered_map<std::string_view, EXP_PropertyKey::Name *> names;
+  return names;
+}
+
+static CM_ThreadSpinLock &get_names_lock()
+{
+  static CM_ThreadSpinLock lock;
+  return lock;
+}
+
+EXP_PropertyKey::EXP_PropertyKey() : m_name(nullptr)
+{
+}
+
+EXP_PropertyKey::EXP_PropertyKey(const std::string &name)
+{
+  std::unordered_map<std::string_view, EXP_PropertyKey::Name *> &names = get_names();
+
+  CM_ThreadSpinLock &lock = get_names_lock();
+  lock.Lock();
+  const auto it = names.find(name);
+  if (it != names.end()) {
+    m_name = it->second;
+    ++m_name->users;
+  }
+  else {
+    m_name = new Name{name, {1}};
+    names.emplace(m_name->name, m_name);
+  }
+  lock.Unlock();
+}
+
+EXP_PropertyKey::EXP_PropertyKey(const EXP_PropertyKey &other) : m_name(other.m_name)
+{
+  if (m_name) {
+    ++m_name->users;
+  }
+}
+
+EXP_PropertyKey::EXP_PropertyKey(EXP_PropertyKey &&other) noexcept : m_name(other.m_name)
+{
+  other.m_name = nullptr;
+}
+
+EXP_PropertyKey::~EXP_PropertyKey()
+{
+  Release();
+}
+
+EXP_PropertyKey &EXP_PropertyKey::operator=(const EXP_PropertyKey &other)
+{
+  if (other.m_name) {
+    ++other.m_name->users;
+  }
+  Release();
+  m_name = other.m_name;
+  return *this;
+}
+
+EXP_PropertyKey &EXP_PropertyKey::operator=(EXP_PropertyKey &&other) noexcept
+{
+  if (this != &other) {
+    Release();
+    m_name = other.m_name;
+    other.m_name = nullptr;
+  }
+  return *this;
+}
+
+void EXP_PropertyKey::Release()
+{
+  if (!m_name) {
+    return;
+  }
+
+  /* The last user is decremented under lock, a concurrent construction can't find a name
+   * being freed. */
+  CM_ThreadSpinLock &lock = get_names_lock();
+  lock.Lock();
+  if (--m_name->users == 0) {
+    get_names().erase(m_name->name);
+    delete m_name;
+  }
+  lock.Unlock();
+
+  m_name = nullptr;
+}
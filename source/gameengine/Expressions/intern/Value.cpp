@@ -148,6 +148,11 @@ std::string EXP_Value::op2str(VALUE_OPERATOR op)
 /// Set property <ioProperty>, overwrites and releases a previous property with the same name if
 /// needed.
 void EXP_Value::SetProperty(const std::string &name, EXP_Value *ioProperty)
+{
+  SetProperty(EXP_PropertyKey(name), ioProperty);
+}
+
+void EXP_Value::SetProperty(const EXP_PropertyKey &key, EXP_Value *ioProperty)
 {
   // Check if somebody is setting an empty property.
   if (ioProperty == nullptr) {
@@ -156,26 +161,42 @@ void EXP_Value::SetProperty(const std::string &name, EXP_Value *ioProperty)
   }
 
   // Try to replace property (if so -> exit as soon as we replaced it).
-  EXP_Value *oldval = m_properties[name];
-  if (oldval) {
-    oldval->Release();
+  for (auto &pair : m_properties) {
+    if (pair.first == key) {
+      pair.second->Release();
+      pair.second = ioProperty->AddRef();
+      m_propertyIndex[pair.first.GetName()] = pair.second;
+      return;
+    }
   }
 
   // Add property at end of array.
-  m_properties[name] = ioProperty->AddRef();
+  m_properties.emplace_back(key, ioProperty->AddRef());
+  m_propertyIndex.emplace(key.GetName(), ioProperty);
 }
 
 /// Get pointer to a property with name <inName>, returns nullptr if there is no property named
 /// <inName>.
 EXP_Value *EXP_Value::GetProperty(const std::string &inName)
 {
-  std::map<std::string, EXP_Value *>::iterator it = m_properties.find(inName);
-  if (it != m_properties.end()) {
+  // Look up the name index without interning the name, the lookup is lock free.
+  const auto it = m_propertyIndex.find(inName);
+  if (it != m_propertyIndex.end()) {
     return it->second;
   }
   return nullptr;
 }
 
+EXP_Value *EXP_Value::GetProperty(const EXP_PropertyKey &key)
+{
+  for (const auto &pair : m_properties) {
+    if (pair.first == key) {
+      return pair.second;
+    }
+  }
+  return nullptr;
+}
+
 /// Get text description of property with name <inName>, returns an empty string if there is no
 /// property named <inName>.
 const std::string EXP_Value::GetPropertyText(const std::string &inName)
@@ -204,14 +225,24 @@ float EXP_Value::GetPropertyNumber(const std::string &inName, float defnumber)
 /// if property was not found or could not be removed.
 bool EXP_Value::RemoveProperty(const std::string &inName)
 {
-  std::map<std::string, EXP_Value *>::iterator it = m_properties.find(inName);
-  if (it != m_properties.end()) {
-    (*it).second->Release();
-    m_properties.erase(it);
-    return true;
+  const auto indexit = m_propertyIndex.find(inName);
+  if (indexit == m_propertyIndex.end()) {
+    return false;
   }
 
-  return false;
+  // The index view uses the name of the key, erase it before the key.
+  EXP_Value *property = indexit->second;
+  m_propertyIndex.erase(indexit);
+
+  for (auto it = m_properties.begin(), end = m_properties.end(); it != end; ++it) {
+    if (it->second == property) {
+      it->second->Release();
+      m_properties.erase(it);
+      break;
+    }
+  }
+
+  return true;
 }
 
 /// Get Property Names.
@@ -222,7 +253,7 @@ std::vector<std::string> EXP_Value::GetPropertyNames()
 
   unsigned short i = 0;
   for (const auto &pair : m_properties) {
-    result[i++] = pair.first;
+    result[i++] = pair.first.GetName();
   }
   return result;
 }
@@ -236,20 +267,37 @@ void EXP_Value::ClearProperties()
   }
 
   // Delete property array.
+  m_propertyIndex.clear();
   m_properties.clear();
 }
 
-/// Get property number <inIndex>.
-EXP_Value *EXP_Value::GetProperty(int inIndex)
+/// Replace all properties by replicas of the properties of <other>.
+void EXP_Value::ReplicateProperties(EXP_Value *other)
 {
-  int count = 0;
+  ClearProperties();
 
+  m_properties = other->m_properties;
+  for (auto &pair : m_properties) {
+    pair.second = pair.second->GetReplica();
+  }
+  RebuildPropertyIndex();
+}
+
+void EXP_Value::RebuildPropertyIndex()
+{
+  m_propertyIndex.clear();
   for (const auto &pair : m_properties) {
-    if (count++ == inIndex) {
-      return pair.second;
-    }
+    m_propertyIndex.emplace(pair.first.GetName(), pair.second);
   }
-  return nullptr;
+}
+
+/// Get property number <inIndex>.
+EXP_Value *EXP_Value::GetProperty(int inIndex)
+{
+  if (inIndex < 0 || inIndex >= int(m_properties.size())) {
+    return nullptr;
+  }
+  return m_properties[inIndex].second;
 }
 
 /// Get the amount of properties assiocated with this value.
@@ -275,6 +323,7 @@ void EXP_Value::ProcessReplica()
   for (auto &pair : m_properties) {
     pair.second = pair.second->GetReplica();
   }
+  RebuildPropertyIndex();
 }
 
 int EXP_Value::GetValueType()
@@ -378,7 +427,7 @@ PyObject *EXP_Value::ConvertKeysToPython(void)
 
   Py_ssize_t i = 0;
   for (const auto &pair : m_properties) {
-    PyList_SET_ITEM(pylist, i++, PyUnicode_FromStdString(pair.first));
+    PyList_SET_ITEM(pylist, i++, PyUnicode_FromStdString(pair.first.GetName()));
   }
 
   return pylist;
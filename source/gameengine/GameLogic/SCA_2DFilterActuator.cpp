@@ -29,6 +29,8 @@
 #include "SCA_2DFilterActuator.h"
 
 #include "CM_Message.h"
+#include "KX_Globals.h"
+#include "KX_KetsjiEngine.h"
 #include "RAS_2DFilter.h"
 #include "RAS_2DFilterManager.h"
 
@@ -100,7 +102,13 @@ bool SCA_2DFilterActuator::Update()
       break;
     }
     default: {
-      if (!filter) {
+      if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+        // The filter shader can't be compiled without a GPU context.
+        CM_LogicBrickWarning(this,
+                             "2D Filter for pass index: " << m_int_arg
+                                                          << " not added in headless mode.");
+      }
+      else if (!filter) {
         RAS_2DFilterData info;
         info.filterPassIndex = m_int_arg;
         info.gameObject = m_gameobj;
@@ -31,6 +31,8 @@
 
 #include "SCA_ActuatorEventManager.h"
 
+#include "PRF_profile.hh"
+
 #include "SCA_ActuatorSensor.h"
 
 using namespace blender;
@@ -46,6 +48,7 @@ SCA_ActuatorEventManager::~SCA_ActuatorEventManager()
 
 void SCA_ActuatorEventManager::NextFrame()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   // check for changed actuator
   for (SCA_ISensor *sensor : m_sensors) {
     sensor->Activate(m_logicmgr);
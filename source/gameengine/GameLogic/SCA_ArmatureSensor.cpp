@@ -149,6 +149,12 @@ bool SCA_ArmatureSensor::Evaluate()
   return (reset) ? true : false;
 }
 
+bool SCA_ArmatureSensor::IsThreadSafe()
+{
+  // Only the constraint of the armature is read.
+  return true;
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
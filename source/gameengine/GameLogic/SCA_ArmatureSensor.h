@@ -59,6 +59,7 @@ class SCA_ArmatureSensor : public SCA_ISensor {
   virtual void ReParent(SCA_IObject *parent);
   virtual void Init();
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
 
   // identify the constraint that this actuator controls
@@ -35,6 +35,8 @@
 
 #include "SCA_BasicEventManager.h"
 
+#include "PRF_profile.hh"
+
 #include "SCA_ISensor.h"
 
 using namespace blender;
@@ -50,7 +52,6 @@ SCA_BasicEventManager::~SCA_BasicEventManager()
 
 void SCA_BasicEventManager::NextFrame()
 {
-  for (SCA_ISensor *sensor : m_sensors) {
-    sensor->Activate(m_logicmgr);
-  }
+  PRF_scope(ProfileCategory::GameEngine);
+  ActivateSensors();
 }
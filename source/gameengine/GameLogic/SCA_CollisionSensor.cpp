@@ -102,6 +102,7 @@ SCA_CollisionSensor::SCA_CollisionSensor(SCA_EventManager *eventmgr,
                                          const std::string &touchedpropname)
     : SCA_ISensor(gameobj, eventmgr),
       m_touchedpropname(touchedpropname),
+      m_touchedpropkey(touchedpropname),
       m_bFindMaterial(bFindMaterial),
       m_bCollisionPulse(bCollisionPulse),
       m_hitMaterial("")
@@ -221,7 +222,7 @@ bool SCA_CollisionSensor::BroadPhaseSensorFilterCollision(PHY_IPhysicsController
       }
     }
     else {
-      found = (otherobj->GetProperty(m_touchedpropname) != nullptr);
+      found = (otherobj->GetProperty(m_touchedpropkey) != nullptr);
     }
   }
   return found;
@@ -260,7 +261,7 @@ bool SCA_CollisionSensor::NewHandleCollision(PHY_IPhysicsController *ctrl1,
         }
       }
       else {
-        found = (gameobj->GetProperty(m_touchedpropname) != nullptr);
+        found = (gameobj->GetProperty(m_touchedpropkey) != nullptr);
       }
     }
     if (found) {
@@ -328,8 +329,13 @@ PyMethodDef SCA_CollisionSensor::Methods[] = {
 };
 
 PyAttributeDef SCA_CollisionSensor::Attributes[] = {
-    EXP_PYATTRIBUTE_STRING_RW(
-        "propName", 0, MAX_PROP_NAME, false, SCA_CollisionSensor, m_touchedpropname),
+    EXP_PYATTRIBUTE_STRING_RW_CHECK("propName",
+                                    0,
+                                    MAX_PROP_NAME,
+                                    false,
+                                    SCA_CollisionSensor,
+                                    m_touchedpropname,
+                                    CheckPropertyName),
     EXP_PYATTRIBUTE_BOOL_RW("useMaterial", SCA_CollisionSensor, m_bFindMaterial),
     EXP_PYATTRIBUTE_BOOL_RW("usePulseCollision", SCA_CollisionSensor, m_bCollisionPulse),
     EXP_PYATTRIBUTE_STRING_RO("hitMaterial", SCA_CollisionSensor, m_hitMaterial),
@@ -340,6 +346,13 @@ PyAttributeDef SCA_CollisionSensor::Attributes[] = {
 
 /* Python API */
 
+int SCA_CollisionSensor::CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef)
+{
+  SCA_CollisionSensor *sensor = static_cast<SCA_CollisionSensor *>(self);
+  sensor->m_touchedpropkey = EXP_PropertyKey(sensor->m_touchedpropname);
+  return 0;
+}
+
 PyObject *SCA_CollisionSensor::pyattr_get_object_hit(EXP_PyObjectPlus *self_v,
                                                      const EXP_PYATTRIBUTE_DEF *attrdef)
 {
@@ -54,6 +54,8 @@ class SCA_CollisionSensor : public SCA_ISensor {
        * The sensor should only look for objects with this property.
        */
       std::string m_touchedpropname;
+  /// Key of m_touchedpropname, looked up for every colliding object.
+  EXP_PropertyKey m_touchedpropkey;
   bool m_bFindMaterial;
   bool m_bCollisionPulse; /* changes in the colliding objects trigger pulses */
 
@@ -135,6 +137,8 @@ class SCA_CollisionSensor : public SCA_ISensor {
                                          const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_object_hit_list(EXP_PyObjectPlus *self_v,
                                               const EXP_PYATTRIBUTE_DEF *attrdef);
+  /// Update the key of the property name.
+  static int CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef);
 
 #endif
 };
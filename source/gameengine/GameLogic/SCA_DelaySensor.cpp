@@ -118,6 +118,11 @@ bool SCA_DelaySensor::Evaluate()
   return trigger;
 }
 
+bool SCA_DelaySensor::IsThreadSafe()
+{
+  return true;
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
@@ -52,6 +52,7 @@ class SCA_DelaySensor : public SCA_ISensor {
   virtual ~SCA_DelaySensor();
   virtual EXP_Value *GetReplica();
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
   virtual void Init();
 
@@ -31,11 +31,26 @@
 
 #include "SCA_EventManager.h"
 
+#include "BLI_task_c.hh"
+
 #include "CM_List.h"
 #include "SCA_ISensor.h"
 
 using namespace blender;
 
+struct SensorEvaluationTaskData {
+  SCA_ISensor **sensors;
+  unsigned char *results;
+};
+
+static void sensor_evaluation_task_func(void *__restrict userdata,
+                                        const int iter,
+                                        const TaskParallelTLS *__restrict /*tls*/)
+{
+  SensorEvaluationTaskData *data = static_cast<SensorEvaluationTaskData *>(userdata);
+  data->results[iter] = data->sensors[iter]->Evaluate();
+}
+
 SCA_EventManager::SCA_EventManager(SCA_LogicManager *logicmgr, EVENT_MANAGER_TYPE mgrtype)
     : m_logicmgr(logicmgr), m_mgrtype(mgrtype)
 {
@@ -67,6 +82,38 @@ void SCA_EventManager::NextFrame()
   BLI_assert(false);  // && "Event managers should override a NextFrame method");
 }
 
+void SCA_EventManager::ActivateSensors()
+{
+  m_parallelSensors.clear();
+  for (SCA_ISensor *sensor : m_sensors) {
+    if (sensor->NeedEvaluation() && sensor->IsThreadSafe()) {
+      m_parallelSensors.push_back(sensor);
+    }
+  }
+
+  const unsigned int numParallel = m_parallelSensors.size();
+  if (numParallel > 0) {
+    m_parallelResults.resize(numParallel);
+    SensorEvaluationTaskData data = {m_parallelSensors.data(), m_parallelResults.data()};
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 64;
+    BLI_task_parallel_range(0, numParallel, &data, sensor_evaluation_task_func, &settings);
+  }
+
+  // The pulse and tap states and the triggered controllers are only modified serially.
+  unsigned int index = 0;
+  for (SCA_ISensor *sensor : m_sensors) {
+    if (index < numParallel && m_parallelSensors[index] == sensor) {
+      sensor->Activate(m_logicmgr, m_parallelResults[index++]);
+    }
+    else {
+      sensor->Activate(m_logicmgr);
+    }
+  }
+}
+
 void SCA_EventManager::EndFrame()
 {
 }
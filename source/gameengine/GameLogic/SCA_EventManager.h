@@ -44,6 +44,18 @@ class SCA_EventManager {
 
   std::vector<SCA_ISensor *> m_sensors;
 
+  /// Thread safe sensors evaluated in parallel in ActivateSensors, in m_sensors order.
+  std::vector<SCA_ISensor *> m_parallelSensors;
+  /// Evaluation results of m_parallelSensors, not using vector<bool> to be written concurrently.
+  std::vector<unsigned char> m_parallelResults;
+
+  /** Evaluate and activate all the sensors in two phases. The thread safe sensors are evaluated
+   * first in parallel, then all the sensors are activated serially in their registration order,
+   * evaluating the other sensors at the same time. The triggered controllers are then added in
+   * the same order as with a serial evaluation.
+   */
+  void ActivateSensors();
+
  public:
   enum EVENT_MANAGER_TYPE {
     KEYBOARD_EVENTMGR = 0,
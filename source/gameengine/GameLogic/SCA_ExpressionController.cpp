@@ -47,7 +47,7 @@ using namespace blender;
 
 SCA_ExpressionController::SCA_ExpressionController(SCA_IObject *gameobj,
                                                    const std::string &exprtext)
-    : SCA_IController(gameobj), m_exprText(exprtext), m_exprCache(nullptr)
+    : SCA_IController(gameobj), m_exprText(exprtext), m_exprCache(nullptr), m_bound(false)
 {
 }
 
@@ -62,6 +62,8 @@ EXP_Value *SCA_ExpressionController::GetReplica()
   SCA_ExpressionController *replica = new SCA_ExpressionController(*this);
   replica->m_exprText = m_exprText;
   replica->m_exprCache = nullptr;
+  replica->m_bytecode.Clear();
+  replica->m_bound = false;
   // this will copy properties and so on...
   replica->ProcessReplica();
 
@@ -87,8 +89,17 @@ void SCA_ExpressionController::Trigger(SCA_LogicManager *logicmgr)
     EXP_Parser parser;
     parser.SetContext(this->AddRef());
     m_exprCache = parser.ProcessText(m_exprText);
+    if (m_exprCache) {
+      m_bytecode.Compile(m_exprCache);
+      m_bound = false;
+    }
   }
-  if (m_exprCache) {
+
+  EXP_Bytecode::Value result;
+  if (m_bytecode.IsValid() && EvaluateBytecode(result)) {
+    expressionresult = !MT_fuzzyZero((float)result.GetNumber());
+  }
+  else if (m_exprCache) {
     EXP_Value *value = m_exprCache->Calculate();
     if (value) {
       if (value->IsError()) {
@@ -110,6 +121,54 @@ void SCA_ExpressionController::Trigger(SCA_LogicManager *logicmgr)
   }
 }
 
+void SCA_ExpressionController::BindIdentifiers()
+{
+  const std::vector<std::string> &identifiers = m_bytecode.GetIdentifiers();
+  m_bindings.resize(identifiers.size());
+  m_inputs.resize(identifiers.size());
+
+  // Same lookup order as FindIdentifier.
+  for (unsigned int i = 0, size = identifiers.size(); i < size; ++i) {
+    const std::string &name = identifiers[i];
+    Binding &binding = m_bindings[i];
+    binding.m_sensor = nullptr;
+    for (SCA_ISensor *sensor : m_linkedsensors) {
+      if (sensor->GetName() == name) {
+        binding.m_sensor = sensor;
+        break;
+      }
+    }
+    binding.m_key = EXP_PropertyKey(name);
+  }
+
+  m_boundSensors = m_linkedsensors;
+  m_bound = true;
+}
+
+bool SCA_ExpressionController::EvaluateBytecode(EXP_Bytecode::Value &result)
+{
+  if (!m_bound || m_boundSensors != m_linkedsensors) {
+    BindIdentifiers();
+  }
+
+  EXP_Value *parent = GetParent();
+  for (unsigned int i = 0, size = m_bindings.size(); i < size; ++i) {
+    const Binding &binding = m_bindings[i];
+    if (binding.m_sensor) {
+      m_inputs[i].SetBool(binding.m_sensor->GetState());
+    }
+    else {
+      // Missing properties and unsupported types are reported by the expression tree.
+      EXP_Value *prop = parent->GetProperty(binding.m_key);
+      if (!prop || !m_inputs[i].Set(prop)) {
+        return false;
+      }
+    }
+  }
+
+  return m_bytecode.Evaluate(m_inputs.data(), result);
+}
+
 EXP_Value *SCA_ExpressionController::FindIdentifier(const std::string &identifiername)
 {
 
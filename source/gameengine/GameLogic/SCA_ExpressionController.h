@@ -34,6 +34,7 @@
 
 #pragma once
 
+#include "EXP_Bytecode.h"
 #include "SCA_IController.h"
 
 class EXP_Expression;
@@ -43,6 +44,26 @@ class SCA_ExpressionController : public SCA_IController {
   std::string m_exprText;
   EXP_Expression *m_exprCache;
 
+  /// Identifier of the bytecode, read from a linked sensor or else from a property.
+  struct Binding {
+    SCA_ISensor *m_sensor;
+    EXP_PropertyKey m_key;
+  };
+
+  /// Program compiled from m_exprCache, invalid if the expression isn't supported.
+  EXP_Bytecode m_bytecode;
+  /// Bindings of the bytecode identifiers.
+  std::vector<Binding> m_bindings;
+  /// Linked sensors when the bindings were made, they are made again if the links change.
+  std::vector<SCA_ISensor *> m_boundSensors;
+  bool m_bound;
+  /// Identifier values passed to the bytecode.
+  std::vector<EXP_Bytecode::Value> m_inputs;
+
+  void BindIdentifiers();
+  /// Evaluate the bytecode, return false if the expression tree must be used instead.
+  bool EvaluateBytecode(EXP_Bytecode::Value &result);
+
  public:
   SCA_ExpressionController(SCA_IObject *gameobj, const std::string &exprtext);
 
@@ -50,6 +50,11 @@ SCA_IObject::SCA_IObject()
 }
 
 SCA_IObject::~SCA_IObject()
+{
+  DeleteLogic();
+}
+
+void SCA_IObject::DeleteLogic()
 {
   for (SCA_ISensor *sensor : m_sensors) {
     // Use Delete for sensor to ensure proper cleaning.
@@ -71,6 +76,21 @@ SCA_IObject::~SCA_IObject()
   for (SCA_IObject *object : m_registeredObjects) {
     object->UnlinkObject(this);
   }
+
+  m_sensors.clear();
+  m_controllers.clear();
+  m_actuators.clear();
+  m_registeredActuators.clear();
+  m_registeredObjects.clear();
+}
+
+void SCA_IObject::SetLogicFrom(SCA_IObject *other)
+{
+  BLI_assert(m_sensors.empty() && m_controllers.empty() && m_actuators.empty());
+
+  m_sensors = other->m_sensors;
+  m_controllers = other->m_controllers;
+  m_actuators = other->m_actuators;
 }
 
 SCA_ControllerList &SCA_IObject::GetControllers()
@@ -307,6 +327,11 @@ int SCA_IObject::GetGameObjectType() const
   return -1;
 }
 
+bool SCA_IObject::GetNetworkPosition(float r_position[3]) const
+{
+  return false;
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
@@ -133,6 +133,12 @@ class SCA_IObject : public KX_PythonProxy {
   SCA_IController *FindController(const std::string &controllername);
 
   virtual void ReParentLogic();
+  /// Delete the logic bricks and unlink the actuators and objects referring to this object.
+  void DeleteLogic();
+  /** Use the logic bricks of another object, ReParentLogic() must be called after
+   * to own replicas of these bricks.
+   */
+  void SetLogicFrom(SCA_IObject *other);
 
   /// Suspend all progress.
   void SuspendLogic(void);
@@ -157,6 +163,11 @@ class SCA_IObject : public KX_PythonProxy {
 
   virtual int GetGameObjectType() const;
 
+  /** Get the world position used to send the network messages of this object only to the
+   * interested remote peers, return false if the object has no position.
+   */
+  virtual bool GetNetworkPosition(float r_position[3]) const;
+
   typedef enum ObjectTypes {
     OBJ_ARMATURE = 0,
     OBJ_CAMERA = 1,
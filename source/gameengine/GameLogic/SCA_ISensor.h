@@ -108,7 +108,18 @@ class SCA_ISensor : public SCA_ILogicBrick {
   /* level of individual sensors. Mapping the old activate()s is easy.     */
   /* The IsPosTrig() also has to change, to keep things consistent.        */
   void Activate(SCA_LogicManager *logicmgr);
+  /** Activate the controllers from the result of an Evaluate call made before, used when the
+   * sensors are evaluated in parallel. Must be called only for sensors needing an evaluation.
+   */
+  void Activate(SCA_LogicManager *logicmgr, bool result);
   virtual bool Evaluate() = 0;
+  /** Return true if Evaluate can be called from a worker thread in parallel with the other
+   * thread safe sensors. The sensor must only modify its own data and must not use Python or
+   * reference counted values shared with other sensors.
+   */
+  virtual bool IsThreadSafe();
+  /// Return true if the sensor is linked to a controller and not suspended.
+  bool NeedEvaluation() const;
   virtual bool IsPositiveTrigger();
   virtual void Init();
 
@@ -31,6 +31,8 @@
 
 #include "SCA_JoystickManager.h"
 
+#include "PRF_profile.hh"
+
 #include "SCA_ISensor.h"
 
 using namespace blender;
@@ -46,6 +48,7 @@ SCA_JoystickManager::~SCA_JoystickManager()
 
 void SCA_JoystickManager::NextFrame(double curtime, double deltatime)
 {
+  PRF_scope(ProfileCategory::GameEngine);
   for (SCA_ISensor *sensor : m_sensors) {
     sensor->Activate(m_logicmgr);
   }
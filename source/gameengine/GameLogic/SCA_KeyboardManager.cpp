@@ -34,6 +34,8 @@
 
 #include "SCA_KeyboardManager.h"
 
+#include "PRF_profile.hh"
+
 #include "SCA_KeyboardSensor.h"
 
 using namespace blender;
@@ -54,6 +56,7 @@ SCA_IInputDevice *SCA_KeyboardManager::GetInputDevice()
 
 void SCA_KeyboardManager::NextFrame()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   for (SCA_ISensor *sensor : m_sensors) {
     sensor->Activate(m_logicmgr);
   }
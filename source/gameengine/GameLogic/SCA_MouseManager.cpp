@@ -41,6 +41,8 @@
 
 #include "SCA_MouseManager.h"
 
+#include "PRF_profile.hh"
+
 #include "SCA_MouseSensor.h"
 
 using namespace blender;
@@ -61,6 +63,7 @@ SCA_IInputDevice *SCA_MouseManager::GetInputDevice()
 
 void SCA_MouseManager::NextFrame()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   if (m_mousedevice) {
     for (SCA_ISensor *sensor : m_sensors) {
       SCA_MouseSensor *mousesensor = static_cast<SCA_MouseSensor *>(sensor);
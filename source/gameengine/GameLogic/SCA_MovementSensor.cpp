@@ -172,6 +172,12 @@ bool SCA_MovementSensor::Evaluate()
   return result;
 }
 
+bool SCA_MovementSensor::IsThreadSafe()
+{
+  // Only the owner transform is read.
+  return true;
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
@@ -71,6 +71,7 @@ class SCA_MovementSensor : public SCA_ISensor {
   MT_Vector3 GetOwnerPosition(bool local);
 
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
   virtual void Init();
 
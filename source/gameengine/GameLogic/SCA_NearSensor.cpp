@@ -156,6 +156,12 @@ bool SCA_NearSensor::Evaluate()
   return result;
 }
 
+bool SCA_NearSensor::IsThreadSafe()
+{
+  // The state is set by the collision callbacks and the physics controller is owned by the sensor.
+  return true;
+}
+
 // this function is called at broad phase stage to check if the two controller
 // need to interact at all. It is used for Near/Radar sensor that don't need to
 // check collision with object not included in filter
@@ -172,7 +178,7 @@ bool SCA_NearSensor::BroadPhaseFilterCollision(PHY_IPhysicsController *ctrl1, PH
   if (gameobj && (gameobj != parent)) {
     // only take valid colliders
     if (client_info->m_type == KX_ClientObjectInfo::ACTOR) {
-      if ((m_touchedpropname.empty()) || (gameobj->GetProperty(m_touchedpropname))) {
+      if ((m_touchedpropname.empty()) || (gameobj->GetProperty(m_touchedpropkey))) {
         return true;
       }
     }
@@ -68,6 +68,7 @@ public:
   virtual void ProcessReplica();
   virtual void SetPhysCtrlRadius();
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
 
   virtual void ReParent(SCA_IObject *parent);
   virtual bool NewHandleCollision(PHY_IPhysicsController *ctrl1,
@@ -51,6 +51,7 @@ SCA_NetworkMessageSensor::SCA_NetworkMessageSensor(
       m_NetworkMessageScene(NetworkMessageScene),
       m_subject(subject),
       m_frame_message_count(0),
+      m_messagesFrame(0),
       m_BodyList(nullptr),
       m_SubjectList(nullptr)
 {
@@ -64,30 +65,28 @@ void SCA_NetworkMessageSensor::Init()
 
 SCA_NetworkMessageSensor::~SCA_NetworkMessageSensor()
 {
+  ClearMessageLists();
 }
 
 EXP_Value *SCA_NetworkMessageSensor::GetReplica()
 {
   // This is the standard sensor implementation of GetReplica
   // There may be more network message sensor specific stuff to do here.
-  EXP_Value *replica = new SCA_NetworkMessageSensor(*this);
+  SCA_NetworkMessageSensor *replica = new SCA_NetworkMessageSensor(*this);
 
   if (replica == nullptr) {
     return nullptr;
   }
+  // The message lists belong to the original sensor.
+  replica->m_BodyList = nullptr;
+  replica->m_SubjectList = nullptr;
   replica->ProcessReplica();
 
   return replica;
 }
 
-/// Return true only for flank (UP and DOWN)
-bool SCA_NetworkMessageSensor::Evaluate()
+void SCA_NetworkMessageSensor::ClearMessageLists()
 {
-  bool result = false;
-  bool WasUp = m_IsUp;
-
-  m_IsUp = false;
-
   if (m_BodyList) {
     m_BodyList->Release();
     m_BodyList = nullptr;
@@ -97,38 +96,63 @@ bool SCA_NetworkMessageSensor::Evaluate()
     m_SubjectList->Release();
     m_SubjectList = nullptr;
   }
+}
 
-  std::string toname = GetParent()->GetName();
-  std::string &subject = this->m_subject;
+void SCA_NetworkMessageSensor::CreateMessageLists()
+{
+  if (m_BodyList) {
+    return;
+  }
 
-  const std::vector<KX_NetworkMessageManager::Message> messages = m_NetworkMessageScene->FindMessages(
-      toname, subject);
+  m_BodyList = new EXP_ListValue<EXP_StringValue>();
+  m_SubjectList = new EXP_ListValue<EXP_StringValue>();
 
-  m_frame_message_count = messages.size();
+  const KX_NetworkMessageManager *manager = m_NetworkMessageScene->GetMessageManager();
+  // The messages were cleared since the evaluation.
+  if (m_messagesFrame != manager->GetFrame()) {
+    return;
+  }
 
-  if (!messages.empty()) {
+  for (blender::Span<KX_NetworkMessageManager::Message> messages :
+       {m_messages.noReceiver, m_messages.receiver})
+  {
+    for (const KX_NetworkMessageManager::Message &message : messages) {
+      // save the body
+      const std::string_view body = manager->GetBody(message);
 #ifdef NAN_NET_DEBUG
-    std::cout << "SCA_NetworkMessageSensor found one or more messages" << std::endl;
+      std::cout << "body [" << body << "]\n";
 #endif
-    m_IsUp = true;
-    m_BodyList = new EXP_ListValue<EXP_StringValue>();
-    m_SubjectList = new EXP_ListValue<EXP_StringValue>();
+      m_BodyList->Add(new EXP_StringValue(std::string(body), "body"));
+      // Store Subject
+      m_SubjectList->Add(new EXP_StringValue(manager->GetName(message.subject), "subject"));
+    }
   }
+}
 
-  std::vector<KX_NetworkMessageManager::Message>::const_iterator mesit;
-  for (mesit = messages.begin(); mesit != messages.end(); mesit++) {
-    // save the body
-    const std::string &body = (*mesit).body;
-    // save the subject
-    const std::string &messub = (*mesit).subject;
+/// Return true only for flank (UP and DOWN)
+bool SCA_NetworkMessageSensor::Evaluate()
+{
+  bool result = false;
+  bool WasUp = m_IsUp;
+
+  m_IsUp = false;
+
+  // The lists are only created when accessed from python.
+  ClearMessageLists();
+
+  const std::string toname = GetParent()->GetName();
+
+  // The messages are not copied, only the views in the message manager are kept.
+  m_messages = m_NetworkMessageScene->FindMessages(toname, m_subject);
+  m_messagesFrame = m_NetworkMessageScene->GetMessageManager()->GetFrame();
+
+  m_frame_message_count = m_messages.size();
+
+  if (!m_messages.empty()) {
 #ifdef NAN_NET_DEBUG
-    if (body) {
-      cout << "body [" << body << "]\n";
-    }
+    std::cout << "SCA_NetworkMessageSensor found one or more messages" << std::endl;
 #endif
-    m_BodyList->Add(new EXP_StringValue(body, "body"));
-    // Store Subject
-    m_SubjectList->Add(new EXP_StringValue(messub, "subject"));
+    m_IsUp = true;
   }
 
   result = (WasUp != m_IsUp);
@@ -212,7 +236,8 @@ PyObject *SCA_NetworkMessageSensor::pyattr_get_bodies(EXP_PyObjectPlus *self_v,
                                                       const EXP_PYATTRIBUTE_DEF *attrdef)
 {
   SCA_NetworkMessageSensor *self = static_cast<SCA_NetworkMessageSensor *>(self_v);
-  if (self->m_BodyList) {
+  if (self->m_IsUp) {
+    self->CreateMessageLists();
     return self->m_BodyList->GetProxy();
   }
   else {
@@ -224,7 +249,8 @@ PyObject *SCA_NetworkMessageSensor::pyattr_get_subjects(EXP_PyObjectPlus *self_v
                                                         const EXP_PYATTRIBUTE_DEF *attrdef)
 {
   SCA_NetworkMessageSensor *self = static_cast<SCA_NetworkMessageSensor *>(self_v);
-  if (self->m_SubjectList) {
+  if (self->m_IsUp) {
+    self->CreateMessageLists();
     return self->m_SubjectList->GetProxy();
   }
   else {
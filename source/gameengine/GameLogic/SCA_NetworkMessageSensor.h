@@ -31,6 +31,7 @@
  */
 #pragma once
 
+#include "KX_NetworkMessageManager.h"
 #include "SCA_ISensor.h"
 
 class KX_NetworkMessageScene;
@@ -49,9 +50,20 @@ class SCA_NetworkMessageSensor : public SCA_ISensor {
 
   bool m_IsUp;
 
+  /// Messages found by the last evaluation, views in the message manager lists.
+  KX_NetworkMessageManager::MessageRange m_messages;
+  /// Message manager frame of m_messages, the views are invalid once it changed.
+  unsigned int m_messagesFrame;
+
+  /// Lists of the message bodies and subjects, created on the first python access.
   EXP_ListValue<EXP_StringValue> *m_BodyList;
   EXP_ListValue<EXP_StringValue> *m_SubjectList;
 
+  /// Release the body and subject lists.
+  void ClearMessageLists();
+  /// Create the body and subject lists from the messages if still valid.
+  void CreateMessageLists();
+
  public:
   SCA_NetworkMessageSensor(SCA_EventManager *eventmgr,            // our eventmanager
                            KX_NetworkMessageScene *NetworkMessageScene,  // our scene
@@ -51,7 +51,8 @@ SCA_PropertySensor::SCA_PropertySensor(SCA_EventManager *eventmgr,
       m_checktype(checktype),
       m_checkpropval(propval),
       m_checkpropmaxval(propmaxval),
-      m_checkpropname(propname)
+      m_checkpropname(propname),
+      m_checkpropkey(propname)
 {
   // EXP_Parser pars;
   // pars.SetContext(this->AddRef());
@@ -109,6 +110,13 @@ bool SCA_PropertySensor::Evaluate()
   return (reset) ? true : false;
 }
 
+bool SCA_PropertySensor::IsThreadSafe()
+{
+  /* Properties found by a path in a sub-context are new or reference counted values which could
+   * be shared with other sensors, only direct properties are used without reference. */
+  return (m_checktype == KX_PROPSENSOR_EXPRESSION || GetParent()->GetProperty(m_checkpropkey));
+}
+
 bool SCA_PropertySensor::CheckPropertyCondition()
 {
   m_recentresult = false;
@@ -119,7 +127,8 @@ bool SCA_PropertySensor::CheckPropertyCondition()
       reverse = true;
       ATTR_FALLTHROUGH;
     case KX_PROPSENSOR_EQUAL: {
-      EXP_Value *orgprop = GetParent()->FindIdentifier(m_checkpropname);
+      bool owned;
+      EXP_Value *orgprop = FindCheckedProperty(owned);
       if (!orgprop->IsError()) {
         const std::string &testprop = orgprop->GetText();
         // Force strings to upper case, to avoid confusion in
@@ -144,7 +153,9 @@ bool SCA_PropertySensor::CheckPropertyCondition()
         }
         /* end patch */
       }
-      orgprop->Release();
+      if (owned) {
+        orgprop->Release();
+      }
 
       if (reverse)
         result = !result;
@@ -155,7 +166,8 @@ bool SCA_PropertySensor::CheckPropertyCondition()
       break;
     }
     case KX_PROPSENSOR_INTERVAL: {
-      EXP_Value *orgprop = GetParent()->FindIdentifier(m_checkpropname);
+      bool owned;
+      EXP_Value *orgprop = FindCheckedProperty(owned);
       if (!orgprop->IsError()) {
         float min;
         float max;
@@ -172,12 +184,15 @@ bool SCA_PropertySensor::CheckPropertyCondition()
 
         result = (min <= val) && (val <= max);
       }
-      orgprop->Release();
+      if (owned) {
+        orgprop->Release();
+      }
 
       break;
     }
     case KX_PROPSENSOR_CHANGED: {
-      EXP_Value *orgprop = GetParent()->FindIdentifier(m_checkpropname);
+      bool owned;
+      EXP_Value *orgprop = FindCheckedProperty(owned);
 
       if (!orgprop->IsError()) {
         if (m_previoustext != orgprop->GetText()) {
@@ -185,7 +200,9 @@ bool SCA_PropertySensor::CheckPropertyCondition()
           result = true;
         }
       }
-      orgprop->Release();
+      if (owned) {
+        orgprop->Release();
+      }
 
       break;
     }
@@ -193,7 +210,8 @@ bool SCA_PropertySensor::CheckPropertyCondition()
       reverse = true;
       ATTR_FALLTHROUGH;
     case KX_PROPSENSOR_GREATERTHAN: {
-      EXP_Value *orgprop = GetParent()->FindIdentifier(m_checkpropname);
+      bool owned;
+      EXP_Value *orgprop = FindCheckedProperty(owned);
       if (!orgprop->IsError()) {
         float ref;
         CM_StringTo(m_checkpropval, ref);
@@ -213,7 +231,9 @@ bool SCA_PropertySensor::CheckPropertyCondition()
           result = val > ref;
         }
       }
-      orgprop->Release();
+      if (owned) {
+        orgprop->Release();
+      }
 
       break;
     }
@@ -227,6 +247,21 @@ bool SCA_PropertySensor::CheckPropertyCondition()
   return result;
 }
 
+EXP_Value *SCA_PropertySensor::FindCheckedProperty(bool &owned)
+{
+  /* Direct properties are used without reference, the sensors sharing them can be evaluated in
+   * parallel. */
+  EXP_Value *orgprop = GetParent()->GetProperty(m_checkpropkey);
+  if (orgprop) {
+    owned = false;
+    return orgprop;
+  }
+
+  // The name can be a path to a property of a sub-context.
+  owned = true;
+  return GetParent()->FindIdentifier(m_checkpropname);
+}
+
 EXP_Value *SCA_PropertySensor::FindIdentifier(const std::string &identifiername)
 {
   return GetParent()->FindIdentifier(identifiername);
@@ -248,6 +283,17 @@ int SCA_PropertySensor::validValueForProperty(EXP_PyObjectPlus *self, const PyAt
   return 0;
 }
 
+int SCA_PropertySensor::CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef)
+{
+  if (CheckProperty(self, attrdef) != 0) {
+    return 1;
+  }
+
+  SCA_PropertySensor *sensor = static_cast<SCA_PropertySensor *>(self);
+  sensor->m_checkpropkey = EXP_PropertyKey(sensor->m_checkpropname);
+  return 0;
+}
+
 /* Integration hooks ------------------------------------------------------- */
 PyTypeObject SCA_PropertySensor::Type = {PyVarObject_HEAD_INIT(nullptr, 0) "SCA_PropertySensor",
                                          sizeof(EXP_PyObjectPlus_Proxy),
@@ -298,8 +344,13 @@ PyAttributeDef SCA_PropertySensor::Attributes[] = {
                            false,
                            SCA_PropertySensor,
                            m_checktype),
-    EXP_PYATTRIBUTE_STRING_RW_CHECK(
-        "propName", 0, MAX_PROP_NAME, false, SCA_PropertySensor, m_checkpropname, CheckProperty),
+    EXP_PYATTRIBUTE_STRING_RW_CHECK("propName",
+                                    0,
+                                    MAX_PROP_NAME,
+                                    false,
+                                    SCA_PropertySensor,
+                                    m_checkpropname,
+                                    CheckPropertyName),
     EXP_PYATTRIBUTE_STRING_RW_CHECK(
         "value", 0, 100, false, SCA_PropertySensor, m_checkpropval, validValueForProperty),
     EXP_PYATTRIBUTE_STRING_RW_CHECK(
@@ -41,6 +41,8 @@ class SCA_PropertySensor : public SCA_ISensor {
   std::string m_checkpropval;
   std::string m_checkpropmaxval;
   std::string m_checkpropname;
+  /// Key of m_checkpropname, avoid to hash the name at each evaluation.
+  EXP_PropertyKey m_checkpropkey;
   std::string m_previoustext;
   bool m_lastresult;
   bool m_recentresult;
@@ -72,8 +74,13 @@ class SCA_PropertySensor : public SCA_ISensor {
   virtual EXP_Value *GetReplica();
   virtual void Init();
   bool CheckPropertyCondition();
+  /** Return the checked property or an error value if not found.
+   * \param owned Set to true if the returned value is a new reference to release.
+   */
+  EXP_Value *FindCheckedProperty(bool &owned);
 
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
   virtual EXP_Value *FindIdentifier(const std::string &identifiername);
 
@@ -87,6 +94,8 @@ class SCA_PropertySensor : public SCA_ISensor {
    * Test whether this is a sensible value (type check)
    */
   static int validValueForProperty(EXP_PyObjectPlus *self, const PyAttributeDef *);
+  /// Check the property name and update its key.
+  static int CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef);
 
 #endif
 };
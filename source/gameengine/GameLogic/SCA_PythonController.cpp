@@ -40,6 +40,7 @@
 #endif  // WITH_PYTHON
 
 #include "CM_Message.h"
+#include "PRF_profile.hh"
 
 using namespace blender;
 
@@ -55,10 +56,12 @@ SCA_PythonController::SCA_PythonController(SCA_IObject *gameobj, int mode)
       m_function_argc(0),
       m_bModified(true),
       m_debug(false),
+      m_persistentNamespace(false),
       m_mode(mode)
 #ifdef WITH_PYTHON
       ,
-      m_pythondictionary(nullptr)
+      m_pythondictionary(nullptr),
+      m_persistentdictionary(nullptr)
 #endif
 
 {
@@ -76,6 +79,11 @@ SCA_PythonController::~SCA_PythonController()
     PyDict_Clear(m_pythondictionary);
     Py_DECREF(m_pythondictionary);
   }
+
+  if (m_persistentdictionary) {
+    PyDict_Clear(m_persistentdictionary);
+    Py_DECREF(m_persistentdictionary);
+  }
 #endif
 }
 
@@ -94,6 +102,8 @@ EXP_Value *SCA_PythonController::GetReplica()
   // The replica->m_pythondictionary is stolen - replace with a copy.
   if (m_pythondictionary)
     replica->m_pythondictionary = PyDict_Copy(m_pythondictionary);
+  // The persistent namespace is created at the first run of the replica.
+  replica->m_persistentdictionary = nullptr;
 
 #  if 0
 	// The other option is to incref the replica->m_pythondictionary -
@@ -223,6 +233,7 @@ PyAttributeDef SCA_PythonController::Attributes[] = {
     EXP_PYATTRIBUTE_RW_FUNCTION(
         "script", SCA_PythonController, pyattr_get_script, pyattr_set_script),
     EXP_PYATTRIBUTE_INT_RO("mode", SCA_PythonController, m_mode),
+    EXP_PYATTRIBUTE_BOOL_RW("persistentNamespace", SCA_PythonController, m_persistentNamespace),
     EXP_PYATTRIBUTE_NULL  // Sentinel
 };
 
@@ -348,6 +359,9 @@ bool SCA_PythonController::Import()
 
 void SCA_PythonController::Trigger(SCA_LogicManager *logicmgr)
 {
+  PRF_scope(ProfileCategory::GameEngine);
+  PRF_scope_add_text("%s", m_scriptName.c_str());
+
   m_sCurrentController = this;
 
   PyObject *excdict = nullptr;
@@ -389,9 +403,20 @@ void SCA_PythonController::Trigger(SCA_LogicManager *logicmgr)
         Py_DECREF(value);
       }
 
-      excdict = PyDict_Copy(m_pythondictionary);
-
-      resultobj = PyEval_EvalCode((PyObject *)m_bytecode, excdict, excdict);
+      if (m_persistentNamespace) {
+        /* The namespace is reset after each run instead of being copied, only the names
+         * written by the script are removed, keeping the same guarantee. */
+        if (!m_persistentdictionary) {
+          m_persistentdictionary = PyDict_Copy(m_pythondictionary);
+        }
+        resultobj = PyEval_EvalCode((PyObject *)m_bytecode,
+                                    m_persistentdictionary,
+                                    m_persistentdictionary);
+      }
+      else {
+        excdict = PyDict_Copy(m_pythondictionary);
+        resultobj = PyEval_EvalCode((PyObject *)m_bytecode, excdict, excdict);
+      }
 
       /* PyRun_SimpleString(m_scriptText.Ptr()); */
       break;
@@ -431,11 +456,51 @@ void SCA_PythonController::Trigger(SCA_LogicManager *logicmgr)
     // PyDict_Clear(excdict);
     Py_DECREF(excdict);
   }
+  else if (m_mode == SCA_PYEXEC_SCRIPT && m_persistentdictionary) {
+    ResetPersistentNamespace();
+  }
 
   m_triggeredSensors.clear();
   m_sCurrentController = nullptr;
 }
 
+void SCA_PythonController::ResetPersistentNamespace()
+{
+  PyObject *key;
+  PyObject *value;
+  Py_ssize_t pos = 0;
+
+  // The dictionary can't be modified while iterated, gather the names added or reassigned.
+  while (PyDict_Next(m_persistentdictionary, &pos, &key, &value)) {
+    if (PyDict_GetItem(m_pythondictionary, key) != value) {
+      Py_INCREF(key);
+      m_resetKeys.push_back(key);
+    }
+  }
+
+  for (PyObject *resetkey : m_resetKeys) {
+    PyObject *orig = PyDict_GetItem(m_pythondictionary, resetkey);
+    if (orig) {
+      PyDict_SetItem(m_persistentdictionary, resetkey, orig);
+    }
+    else {
+      PyDict_DelItem(m_persistentdictionary, resetkey);
+    }
+    Py_DECREF(resetkey);
+  }
+  m_resetKeys.clear();
+
+  // Restore the names deleted by the script.
+  if (PyDict_Size(m_persistentdictionary) != PyDict_Size(m_pythondictionary)) {
+    pos = 0;
+    while (PyDict_Next(m_pythondictionary, &pos, &key, &value)) {
+      if (!PyDict_GetItem(m_persistentdictionary, key)) {
+        PyDict_SetItem(m_persistentdictionary, key, value);
+      }
+    }
+  }
+}
+
 PyObject *SCA_PythonController::PyActivate(PyObject *value)
 {
   if (m_sCurrentController != this) {
@@ -48,6 +48,8 @@ class SCA_PythonController : public SCA_IController {
   int m_function_argc;
   bool m_bModified;
   bool m_debug; /* use with SCA_PYEXEC_MODULE for reloading every logic run */
+  /// Use with SCA_PYEXEC_SCRIPT to run in the same namespace, reset after each run.
+  bool m_persistentNamespace;
   int m_mode;
 
  protected:
@@ -55,6 +57,10 @@ class SCA_PythonController : public SCA_IController {
   std::string m_scriptName;
 #ifdef WITH_PYTHON
   PyObject *m_pythondictionary; /* for SCA_PYEXEC_SCRIPT only */
+  /// Namespace reused by the runs when m_persistentNamespace is set, copy of m_pythondictionary.
+  PyObject *m_persistentdictionary;
+  /// Names to reset in m_persistentdictionary, kept to not allocate at each run.
+  std::vector<PyObject *> m_resetKeys;
   PyObject *m_pythonfunction;   /* for SCA_PYEXEC_MODULE only */
 #endif
   std::vector<class SCA_ISensor *> m_triggeredSensors;
@@ -81,6 +87,10 @@ class SCA_PythonController : public SCA_IController {
   {
     m_debug = debug;
   }
+  void SetPersistentNamespace(bool persistent)
+  {
+    m_persistentNamespace = persistent;
+  }
   void AddTriggeredSensor(class SCA_ISensor *sensor)
   {
     m_triggeredSensors.push_back(sensor);
@@ -89,6 +99,10 @@ class SCA_PythonController : public SCA_IController {
   bool Compile();
   bool Import();
   void ErrorPrint(const char *error_msg);
+#ifdef WITH_PYTHON
+  /// Restore m_persistentdictionary to the content of m_pythondictionary.
+  void ResetPersistentNamespace();
+#endif
 
 #ifdef WITH_PYTHON
   static const char *sPyGetCurrentController__doc__;
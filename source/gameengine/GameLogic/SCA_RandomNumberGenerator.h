@@ -70,4 +70,8 @@ class SCA_RandomNumberGenerator {
     if (--m_refcount == 0)
       delete this;
   }
+  int GetRefCount() const
+  {
+    return m_refcount;
+  }
 };
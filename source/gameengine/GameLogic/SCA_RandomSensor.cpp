@@ -114,6 +114,12 @@ bool SCA_RandomSensor::Evaluate()
   return evaluateResult;
 }
 
+bool SCA_RandomSensor::IsThreadSafe()
+{
+  // The replicas share the generator of the original sensor and draw from the same sequence.
+  return (m_basegenerator->GetRefCount() == 1);
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
@@ -51,6 +51,7 @@ class SCA_RandomSensor : public SCA_ISensor {
   virtual EXP_Value *GetReplica();
   virtual void ProcessReplica();
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
   virtual void Init();
 
@@ -57,6 +57,7 @@ SCA_RaySensor::SCA_RaySensor(class SCA_EventManager *eventmgr,
                              KX_Scene *ketsjiScene)
     : SCA_ISensor(gameobj, eventmgr),
       m_propertyname(propname),
+      m_propertykey(propname),
       m_bFindMaterial(bFindMaterial),
       m_bXRay(bXRay),
       m_distance(distance),
@@ -127,7 +128,7 @@ bool SCA_RaySensor::RayHit(KX_ClientObjectInfo *client, KX_RayCast *result, void
       }
     }
     else {
-      bFound = hitKXObj->GetProperty(m_propertyname) != nullptr;
+      bFound = hitKXObj->GetProperty(m_propertykey) != nullptr;
     }
   }
 
@@ -182,7 +183,7 @@ bool SCA_RaySensor::NeedRayCast(KX_ClientObjectInfo *client, void */*data*/)
         return false;
     }
     else {
-      if (hitKXObj->GetProperty(m_propertyname) == nullptr)
+      if (hitKXObj->GetProperty(m_propertykey) == nullptr)
         return false;
     }
   }
@@ -307,6 +308,12 @@ bool SCA_RaySensor::Evaluate()
   return result;
 }
 
+bool SCA_RaySensor::IsThreadSafe()
+{
+  // The physics world is not modified during the logic, ray casts can be done concurrently.
+  return true;
+}
+
 #ifdef WITH_PYTHON
 
 /* ------------------------------------------------------------------------- */
@@ -362,7 +369,13 @@ PyAttributeDef SCA_RaySensor::Attributes[] = {
     EXP_PYATTRIBUTE_BOOL_RW("useMaterial", SCA_RaySensor, m_bFindMaterial),
     EXP_PYATTRIBUTE_BOOL_RW("useXRay", SCA_RaySensor, m_bXRay),
     EXP_PYATTRIBUTE_FLOAT_RW("range", 0, 10000, SCA_RaySensor, m_distance),
-    EXP_PYATTRIBUTE_STRING_RW("propName", 0, MAX_PROP_NAME, false, SCA_RaySensor, m_propertyname),
+    EXP_PYATTRIBUTE_STRING_RW_CHECK("propName",
+                                    0,
+                                    MAX_PROP_NAME,
+                                    false,
+                                    SCA_RaySensor,
+                                    m_propertyname,
+                                    CheckPropertyName),
     EXP_PYATTRIBUTE_INT_RW("axis", 0, 5, true, SCA_RaySensor, m_axis),
     EXP_PYATTRIBUTE_INT_RW("mask", 1, (1 << OB_MAX_COL_MASKS) - 1, true, SCA_RaySensor, m_mask),
     EXP_PYATTRIBUTE_FLOAT_ARRAY_RO("hitPosition", SCA_RaySensor, m_hitPosition, 3),
@@ -383,4 +396,11 @@ PyObject *SCA_RaySensor::pyattr_get_hitobject(EXP_PyObjectPlus *self_v,
   Py_RETURN_NONE;
 }
 
+int SCA_RaySensor::CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef)
+{
+  SCA_RaySensor *sensor = static_cast<SCA_RaySensor *>(self);
+  sensor->m_propertykey = EXP_PropertyKey(sensor->m_propertyname);
+  return 0;
+}
+
 #endif  // WITH_PYTHON
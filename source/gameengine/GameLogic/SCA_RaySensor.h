@@ -44,6 +44,8 @@ class KX_RayCast;
 
 class SCA_RaySensor : public SCA_ISensor {
   Py_Header std::string m_propertyname;
+  /// Key of m_propertyname, looked up for every object hit.
+  EXP_PropertyKey m_propertykey;
   bool m_bFindMaterial;
   bool m_bXRay;
   float m_distance;
@@ -72,6 +74,7 @@ class SCA_RaySensor : public SCA_ISensor {
   virtual EXP_Value *GetReplica();
 
   virtual bool Evaluate();
+  virtual bool IsThreadSafe();
   virtual bool IsPositiveTrigger();
   virtual void Init();
 
@@ -101,6 +104,8 @@ class SCA_RaySensor : public SCA_ISensor {
   /* Attributes */
   static PyObject *pyattr_get_hitobject(EXP_PyObjectPlus *self_v,
                                         const EXP_PYATTRIBUTE_DEF *attrdef);
+  /// Update the key of the property name.
+  static int CheckPropertyName(EXP_PyObjectPlus *self, const PyAttributeDef *attrdef);
 
 #endif /* WITH_PYTHON */
 };
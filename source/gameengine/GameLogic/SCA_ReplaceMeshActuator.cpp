@@ -171,8 +171,12 @@ bool SCA_ReplaceMeshActuator::Update()
   if (bNegativeEvent)
     return false;  // do nothing on negative events
 
-  if (m_mesh || m_use_phys) /* nullptr mesh is ok if were updating physics */
-    m_scene->ReplaceMesh(static_cast<KX_GameObject *>(GetParent()), m_mesh, m_use_gfx, m_use_phys);
+  if (m_mesh || m_use_phys) { /* nullptr mesh is ok if were updating physics */
+    KX_GameObject *gameobj = static_cast<KX_GameObject *>(GetParent());
+    m_scene->ReplaceMesh(gameobj, m_mesh, m_use_gfx, m_use_phys);
+    // The meshes differ from the original object, the replica can't be reused.
+    m_scene->UnpoolReplicaObject(gameobj);
+  }
 
   return false;
 }
@@ -191,8 +195,11 @@ EXP_Value *SCA_ReplaceMeshActuator::GetReplica()
 
 void SCA_ReplaceMeshActuator::InstantReplaceMesh()
 {
-  if (m_mesh)
-    m_scene->ReplaceMesh(static_cast<KX_GameObject *>(GetParent()), m_mesh, m_use_gfx, m_use_phys);
+  if (m_mesh) {
+    KX_GameObject *gameobj = static_cast<KX_GameObject *>(GetParent());
+    m_scene->ReplaceMesh(gameobj, m_mesh, m_use_gfx, m_use_phys);
+    m_scene->UnpoolReplicaObject(gameobj);
+  }
 }
 
 void SCA_ReplaceMeshActuator::Replace_IScene(SCA_IScene *val)
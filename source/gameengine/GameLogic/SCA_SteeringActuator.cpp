@@ -73,6 +73,7 @@ SCA_SteeringActuator::SCA_SteeringActuator(SCA_IObject *gameobj,
       m_simulation(simulation),
       m_updateTime(0),
       m_obstacle(nullptr),
+      m_steerDelta(0.0),
       m_isActive(false),
       m_isSelfTerminated(isSelfTerminated),
       m_enableVisualization(enableVisualization),
@@ -365,32 +366,19 @@ bool SCA_SteeringActuator::Update(double curtime)
     if (m_simulation && m_obstacle /*&& !newvel.fuzzyZero()*/) {
       if (m_enableVisualization)
         KX_RasterizerDrawDebugLine(mypos, mypos + newvel, MT_Vector4(1.0f, 0.0f, 0.0f, 1.0f));
-      m_simulation->AdjustObstacleVelocity(m_obstacle,
-                                           m_mode != KX_STEERING_PATHFOLLOWING ? m_navmesh :
-                                                                                 nullptr,
-                                           newvel,
-                                           m_acceleration * (float)delta,
-                                           m_turnspeed / (180.0f * (float)(M_PI * delta)));
-      if (m_enableVisualization)
-        KX_RasterizerDrawDebugLine(mypos, mypos + newvel, MT_Vector4(0.0f, 1.0f, 0.0f, 1.0f));
-    }
-
-    HandleActorFace(newvel);
-    if (isdyna) {
-      // temporary solution: set 2D steering velocity directly to obj
-      // correct way is to apply physical force
-      MT_Vector3 curvel = obj->GetLinearVelocity();
-
-      if (m_lockzvel)
-        newvel.z() = 0.0f;
-      else
-        newvel.z() = curvel.z();
-
-      obj->setLinearVelocity(newvel, false);
+      /* The velocity is adjusted with the other agents after the update of all the actuators,
+       * it is then applied in ApplyObstacleVelocity. */
+      m_steerDelta = delta;
+      m_simulation->RequestObstacleVelocity(this,
+                                            m_obstacle,
+                                            m_mode != KX_STEERING_PATHFOLLOWING ? m_navmesh :
+                                                                                  nullptr,
+                                            newvel,
+                                            m_acceleration * (float)delta,
+                                            m_turnspeed / (180.0f * (float)(M_PI * delta)));
     }
     else {
-      MT_Vector3 movement = delta * newvel;
-      obj->ApplyMovement(movement, false);
+      ApplySteering(newvel, delta);
     }
   }
   else {
@@ -409,6 +397,39 @@ bool SCA_SteeringActuator::Update(double curtime)
   return true;
 }
 
+void SCA_SteeringActuator::ApplyObstacleVelocity(const MT_Vector3 &velocity)
+{
+  if (m_enableVisualization) {
+    const MT_Vector3 &mypos = ((KX_GameObject *)GetParent())->NodeGetWorldPosition();
+    KX_RasterizerDrawDebugLine(mypos, mypos + velocity, MT_Vector4(0.0f, 1.0f, 0.0f, 1.0f));
+  }
+
+  ApplySteering(velocity, m_steerDelta);
+}
+
+void SCA_SteeringActuator::ApplySteering(MT_Vector3 newvel, double delta)
+{
+  KX_GameObject *obj = (KX_GameObject *)GetParent();
+
+  HandleActorFace(newvel);
+  if (obj->IsDynamic()) {
+    // temporary solution: set 2D steering velocity directly to obj
+    // correct way is to apply physical force
+    MT_Vector3 curvel = obj->GetLinearVelocity();
+
+    if (m_lockzvel)
+      newvel.z() = 0.0f;
+    else
+      newvel.z() = curvel.z();
+
+    obj->setLinearVelocity(newvel, false);
+  }
+  else {
+    MT_Vector3 movement = delta * newvel;
+    obj->ApplyMovement(movement, false);
+  }
+}
+
 const MT_Vector3 &SCA_SteeringActuator::GetSteeringVec()
 {
   static MT_Vector3 ZERO_VECTOR(0, 0, 0);
@@ -51,6 +51,8 @@ class SCA_SteeringActuator : public SCA_IActuator {
 
   double m_updateTime;
   KX_Obstacle *m_obstacle;
+  /// Time step of the steering waiting for the obstacle simulation.
+  double m_steerDelta;
   bool m_isActive;
   bool m_isSelfTerminated;
   bool m_enableVisualization;
@@ -69,6 +71,8 @@ class SCA_SteeringActuator : public SCA_IActuator {
   MT_Vector3 m_oldDir;
   float m_pathBlendTime;  /* Blend left time in seconds */
   void HandleActorFace(MT_Vector3 &velocity);
+  /// Orient and move the object with the steering velocity.
+  void ApplySteering(MT_Vector3 newvel, double delta);
 
  public:
   enum KX_STEERINGACT_MODE {
@@ -104,6 +108,8 @@ class SCA_SteeringActuator : public SCA_IActuator {
   virtual void Relink(std::map<SCA_IObject *, SCA_IObject *> &obj_map);
   virtual bool UnlinkObject(SCA_IObject *clientobj);
   const MT_Vector3 &GetSteeringVec();
+  /// Apply the velocity adjusted by the obstacle simulation.
+  void ApplyObstacleVelocity(const MT_Vector3 &velocity);
   MT_Vector3 CalculateCurrentBlendDirection(const MT_Vector3& newTargetDir);
   void StartNewBlend(const MT_Vector3& newTargetDir);
 
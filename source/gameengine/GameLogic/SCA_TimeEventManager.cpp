@@ -37,6 +37,8 @@
 
 #include "SCA_TimeEventManager.h"
 
+#include "PRF_profile.hh"
+
 #include "CM_List.h"
 #include "EXP_FloatValue.h"
 
@@ -68,6 +70,7 @@ bool SCA_TimeEventManager::RemoveSensor(SCA_ISensor *sensor)
 
 void SCA_TimeEventManager::NextFrame(double curtime, double fixedtime)
 {
+  PRF_scope(ProfileCategory::GameEngine);
   if (m_timevalues.empty() && fixedtime <= 0.0) {
     return;
   }
@@ -95,6 +98,16 @@ void SCA_TimeEventManager::RemoveTimeProperty(EXP_Value *timeval)
   CM_ListRemoveIfFound(m_timevalues, timeval);
 }
 
+bool SCA_TimeEventManager::MoveTimeProperty(EXP_Value *timeval, SCA_TimeEventManager *to)
+{
+  if (!CM_ListRemoveIfFound(m_timevalues, timeval)) {
+    return false;
+  }
+
+  to->m_timevalues.push_back(timeval);
+  return true;
+}
+
 std::vector<EXP_Value *> SCA_TimeEventManager::GetTimeValues()
 {
   return m_timevalues;
@@ -48,6 +48,8 @@ class SCA_TimeEventManager : public SCA_EventManager {
   virtual bool RemoveSensor(class SCA_ISensor *sensor);
   void AddTimeProperty(EXP_Value *timeval);
   void RemoveTimeProperty(EXP_Value *timeval);
+  /// Move a time property and its reference to another manager, false if not found.
+  bool MoveTimeProperty(EXP_Value *timeval, SCA_TimeEventManager *to);
 
   std::vector<EXP_Value *> GetTimeValues();
 };
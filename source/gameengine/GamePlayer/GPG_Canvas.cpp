@@ -96,6 +96,9 @@ void GPG_Canvas::Resize(int width, int height)
   if (m_windowArea.GetWidth() != width || m_windowArea.GetHeight() != height) {
     m_viewportArea = RAS_Rect(width * m_nativePixelSize, height * m_nativePixelSize);
     m_windowArea = RAS_Rect(width, height);
+    if (!m_window) {
+      return;
+    }
     /* Following code needed to properly resize window with VULKAN backend */
     blender::wmWindow *win = CTX_wm_window(m_context);
     win->sizex = width;
@@ -154,6 +157,11 @@ void GPG_Canvas::SetMouseState(RAS_MouseState mousestate)
 {
   m_mousestate = mousestate;
 
+  // No cursor in headless runtime.
+  if (!m_window) {
+    return;
+  }
+
   switch (mousestate) {
     case MOUSE_INVISIBLE: {
       WM_cursor_set(CTX_wm_window(m_context), WM_CURSOR_NONE);
@@ -218,6 +226,10 @@ void GPG_Canvas::GetDisplayDimensions(blender::int2 &scr_size)
 
 void GPG_Canvas::ResizeWindow(int width, int height)
 {
+  if (!m_window) {
+    return;
+  }
+
   /* Get events from ghost, handle window events, add to window queues. */
   m_window->setClientSize(width, height);
 
@@ -226,6 +238,10 @@ void GPG_Canvas::ResizeWindow(int width, int height)
 
 void GPG_Canvas::SetFullScreen(bool enable)
 {
+  if (!m_window) {
+    return;
+  }
+
   if (enable) {
     m_window->setState(GHOST_kWindowStateFullScreen);
   }
@@ -236,7 +252,7 @@ void GPG_Canvas::SetFullScreen(bool enable)
 
 bool GPG_Canvas::GetFullScreen()
 {
-  return (m_window->getState() == GHOST_kWindowStateFullScreen);
+  return (m_window && m_window->getState() == GHOST_kWindowStateFullScreen);
 }
 
 void GPG_Canvas::ConvertMousePosition(int x, int y, int &r_x, int &r_y, bool /*screen*/)
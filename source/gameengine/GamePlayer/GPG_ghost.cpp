@@ -576,7 +576,13 @@ static void usage(const std::string &program, bool isBlenderPlayer)
   CM_Message("       show_camera_frustum            0         Show debug camera frustum volume");
   CM_Message(
       "       show_shadow_frustum            0         Show debug light shadow frustum volume");
-  CM_Message("       ignore_deprecation_warnings    1         Ignore deprecation warnings"
+  CM_Message("       ignore_deprecation_warnings    1         Ignore deprecation warnings");
+  CM_Message("       headless                       0         Run without window nor rendering,");
+  CM_Message("                                                1: logic paced to the tic rate,");
+  CM_Message("                                                2: logic as fast as possible");
+  CM_Message("       physics_cache                  0         Cache the triangle mesh BVHs,");
+  CM_Message("                                                1: next to the blend file,");
+  CM_Message("                                                2: in the user cache directory"
              << std::endl);
   CM_Message("  -p: override python main loop script");
   CM_Message(std::endl);
@@ -589,6 +595,8 @@ static void usage(const std::string &program, bool isBlenderPlayer)
                          << example_filename);
   CM_Message("example: " << program << " -i 232421 -m 16 " << example_pathname
                          << example_filename);
+  CM_Message("example: " << program << " -g headless = 2 " << example_pathname
+                         << example_filename);
 }
 
 static void get_filename(int argc, char **argv, char *filename)
@@ -1395,21 +1403,34 @@ int main(int argc,
     usage(argv[0], isBlenderPlayer);
     return 0;
   }
+
+  /* Headless runtime: no window nor GPU context are created, Blender runs as in background mode
+   * and the game engine only proceeds the logic, physics and animations. */
+  const LA_Launcher::HeadlessMode headlessMode = LA_Launcher::GetHeadlessMode();
+  const bool headless = (headlessMode != LA_Launcher::HEADLESS_NONE);
+  if (headless) {
+    G.background = true;
+  }
+
   GHOST_ISystem *system = nullptr;
 #ifdef WIN32
   if (scr_saver_mode != SCREEN_SAVER_MODE_CONFIGURATION)
 #endif
   {
-    // Needed if we want the vulkan backend to be set from user preferences.
-    GPU_backend_type_selection_set_override(GPUBackendType(U.gpu_backend));
-    // Needed to call VKBackend::is_supported() which is required for the vulkan backend
-    // to be initialized properly (in system->createWindow).
-    // Hard to understand because the vulkan backend is not initialized yet,
-    // but we need to call VKBackend::is_supported() (static, using temp vkInstances).
-    WM_init_gpu_backend();
+    if (!headless) {
+      // Needed if we want the vulkan backend to be set from user preferences.
+      GPU_backend_type_selection_set_override(GPUBackendType(U.gpu_backend));
+      // Needed to call VKBackend::is_supported() which is required for the vulkan backend
+      // to be initialized properly (in system->createWindow).
+      // Hard to understand because the vulkan backend is not initialized yet,
+      // but we need to call VKBackend::is_supported() (static, using temp vkInstances).
+      WM_init_gpu_backend();
+    }
 
     // Create the system
-    if (GHOST_ISystem::createSystem(true, false) == GHOST_kSuccess) {
+    const GHOST_TSuccess systemCreated = headless ? GHOST_ISystem::createSystemBackground() :
+                                                    GHOST_ISystem::createSystem(true, false);
+    if (systemCreated == GHOST_kSuccess) {
       system = GHOST_ISystem::getSystem();
       GPU_backend_ghost_system_set(system);
       WM_set_g_system_blenderplayer(system);
@@ -1641,7 +1662,10 @@ int main(int argc,
             if (firstTimeRunning) {
               firstTimeRunning = false;
 
-              if (fullScreen) {
+              if (headless) {
+                // No window in headless runtime.
+              }
+              else if (fullScreen) {
 #ifdef WIN32
                 if (scr_saver_mode == SCREEN_SAVER_MODE_SAVER) {
                   window = startScreenSaverFullScreen(system,
@@ -1727,7 +1751,9 @@ int main(int argc,
             CTX_wm_manager_set(C, wm);
             CTX_wm_window_set(C, win);
             InitBlenderContextVariables(C);
-            wm_window_ghostwindow_blenderplayer_ensure(wm, win, window, first_time_window);
+            if (!headless) {
+              wm_window_ghostwindow_blenderplayer_ensure(wm, win, window, first_time_window);
+            }
             WM_check(C);
             InitBlenderContextVariables(C);
 
@@ -1745,13 +1771,15 @@ int main(int argc,
               BPY_python_start(C, argc, (const char **)argv);
               CTX_py_init_set(C, true);
 #  endif /*WITH_PYTHON*/
-              WM_init_gpu_offscreen();
-              blender::ui::theme::init_default();
-              blender::ui::init();
-              /* To have blf_monofont_render available for generated textures checkerboard */
-              blender::ui::reinit_font();
+              if (!headless) {
+                WM_init_gpu_offscreen();
+                blender::ui::theme::init_default();
+                blender::ui::init();
+                /* To have blf_monofont_render available for generated textures checkerboard */
+                blender::ui::reinit_font();
+              }
               /* Set Viewport render mode and shading type for the whole runtime */
-              useViewportRender = scene->gm.flag & GAME_USE_VIEWPORT_RENDER;
+              useViewportRender = !headless && (scene->gm.flag & GAME_USE_VIEWPORT_RENDER);
               shadingTypeRuntime = GetShadingTypeRuntime(C);
             }
             first_time_window = false;
@@ -1803,7 +1831,8 @@ int main(int argc,
                                        pythonControllerFile,
                                        C,
                                        useViewportRender,
-                                       shadingTypeRuntime);
+                                       shadingTypeRuntime,
+                                       headlessMode);
 #ifdef WITH_PYTHON
             // Acquire Python's GIL (global interpreter lock)
             // so we can safely run Python code and API calls
@@ -1981,13 +2010,15 @@ int main(int argc,
 
   ED_file_exit(); /* for fsmenu */
 
-  DRW_gpu_context_enable_ex(false);
-  blender::ui::exit();
-  GPU_shader_cache_dir_clear_old();
-  BKE_image_free_gpu_fallback();
-  GPU_exit();
-  DRW_gpu_context_disable_ex(false);
-  DRW_gpu_context_destroy();
+  if (!headless) {
+    DRW_gpu_context_enable_ex(false);
+    blender::ui::exit();
+    GPU_shader_cache_dir_clear_old();
+    BKE_image_free_gpu_fallback();
+    GPU_exit();
+    DRW_gpu_context_disable_ex(false);
+    DRW_gpu_context_destroy();
+  }
 
   if (window) {
     system->disposeWindow(window);
@@ -401,7 +401,7 @@ static bool ActionMatchesName(blender::bAction *action, char *name, eActionType
   return false;
 }
 
-void BL_Action::Update(float curtime, bool applyToObject)
+void BL_Action::Update(float curtime, bool applyToObject, bool applyPose)
 {
   /* Don't bother if we're done with the animation and if the animation was already applied to the
    * object. of if the animation made a double update for the same time and that it was applied to
@@ -419,7 +419,10 @@ void BL_Action::Update(float curtime, bool applyToObject)
   // Handle frame wrapping based on play mode
   HandleFrameWrapping(curtime);
 
-  m_appliedToObject = applyToObject;
+  /* A skipped armature pose is still evaluated by the next update applying the pose, even if the
+   * action is done. */
+  m_appliedToObject = applyToObject &&
+                      (applyPose || m_obj->GetGameObjectType() != SCA_IObject::OBJ_ARMATURE);
 
   // In case of culled armatures (doesn't requesting to transform the object) we only manages time.
   if (!applyToObject) {
@@ -427,7 +430,7 @@ void BL_Action::Update(float curtime, bool applyToObject)
   }
 
   // Update controllers and apply animation
-  UpdateControllersAndAnimation(curtime);
+  UpdateControllersAndAnimation(curtime, applyPose);
 
   // If the action is done we can remove its scene graph IPO controller.
   if (m_done) {
@@ -504,7 +507,7 @@ static bool armature_gpu_skinning(BL_ArmatureObject* bl_arm)
   return is_running_gpu_skinning;
 }
 
-void BL_Action::UpdateControllersAndAnimation(float curtime)
+void BL_Action::UpdateControllersAndAnimation(float curtime, bool applyPose)
 {
   // Update spatial controllers
   UpdateSpatialControllers();
@@ -517,7 +520,9 @@ void BL_Action::UpdateControllersAndAnimation(float curtime)
                                                                                m_localframe);
 
   if (m_obj->GetGameObjectType() == SCA_IObject::OBJ_ARMATURE) {
-    UpdateArmatureAnimation(curtime, ob, animEvalContext);
+    if (applyPose) {
+      UpdateArmatureAnimation(curtime, ob, animEvalContext);
+    }
   }
   else {
     UpdateObjectAnimation(ob, animEvalContext);
@@ -545,6 +550,25 @@ void BL_Action::UpdateArmatureAnimation(float curtime,
 
   obj->RemapParentChildren();
 
+  // Allocate the layer pose here, the copy of the constraints changes the targets users.
+  if (m_layer_weight >= 0 && !m_blendpose) {
+    obj->GetPose(&m_blendpose);
+  }
+
+  // The pose is evaluated with the other armatures of the scene in KX_Scene::UpdateAnimations.
+  obj->AddPendingAction(this, curtime, gpu_skinning);
+
+  ProcessPipeline(obj, ob, scene, animEvalContext, gpu_skinning);
+}
+
+void BL_Action::EvaluateArmaturePose(BL_ArmatureObject *obj,
+                                     float curtime,
+                                     bool gpu_skinning,
+                                     blender::Depsgraph *depsgraph)
+{
+  const blender::AnimationEvalContext animEvalContext = BKE_animsys_eval_context_construct_at(
+      &m_animEvalCtx, m_localframe);
+
   if (m_layer_weight >= 0) {
     obj->GetPose(&m_blendpose);
   }
@@ -553,9 +577,7 @@ void BL_Action::UpdateArmatureAnimation(float curtime,
 
   ProcessArmatureBlending(obj, curtime);
 
-  obj->ApplyPose();
-
-  ProcessPipeline(obj, ob, scene, animEvalContext, gpu_skinning);
+  obj->ApplyPose(depsgraph);
 
   obj->UpdateTimestep(curtime);
 }
@@ -102,7 +102,7 @@ class BL_Action {
   bool ShouldSkipUpdate(float curtime, bool applyToObject);
   void UpdateActionTiming(float curtime);
   void HandleFrameWrapping(float curtime);
-  void UpdateControllersAndAnimation(float curtime);
+  void UpdateControllersAndAnimation(float curtime, bool applyPose);
   void UpdateSpatialControllers();
   void UpdateArmatureAnimation(float curtime,
                                blender::Object *ob,
@@ -112,6 +112,14 @@ class BL_Action {
                        KX_Scene *scene,
                        const blender::AnimationEvalContext &animEvalContext, bool gpu_skinning);
   void ProcessArmatureBlending(BL_ArmatureObject *armatureObj, float curtime);
+  /** Evaluate the action F-curves on the armature pose, blend it with the previous layers and
+   * solve it. Called from BL_ArmatureObject::EvaluatePendingActions, possibly from a worker
+   * thread, so it only modifies the armature pose and this action.
+   */
+  void EvaluateArmaturePose(BL_ArmatureObject *armatureObj,
+                            float curtime,
+                            bool gpu_skinning,
+                            blender::Depsgraph *depsgraph);
   void UpdateObjectAnimation(blender::Object *ob, const blender::AnimationEvalContext &animEvalContext);
   bool TryUpdateModifierActions(blender::Object *ob,
                                 KX_Scene *scene,
@@ -154,8 +162,10 @@ class BL_Action {
    * \param curtime The current time used to compute the action's' frame.
    * \param applyToObject Set to true when the action must be applied to the object,
    * else it only manages action's' time/end.
+   * \param applyPose Set to false to skip the pose evaluation of a culled armature, the other
+   * channels are still applied.
    */
-  void Update(float curtime, bool applyToObject);
+  void Update(float curtime, bool applyToObject, bool applyPose);
   /**
    * Sync m_obj and children in SceneGraph if fcurve transform action
    */
@@ -169,10 +169,10 @@ bool BL_ActionManager::IsSuspended() const
   return m_suspended;
 }
 
-void BL_ActionManager::Update(float curtime, bool applyToObject)
+void BL_ActionManager::Update(float curtime, bool applyToObject, bool applyPose)
 {
   for (const auto &pair : m_layers) {
-    pair.second->Update(curtime, applyToObject);
+    pair.second->Update(curtime, applyToObject, applyPose);
   }
   /* It's to sync children with parent SGNode after fcurve update */
   for (const auto &pair : m_layers) {
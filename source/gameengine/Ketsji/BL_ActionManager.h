@@ -120,6 +120,7 @@ class BL_ActionManager {
    * \param curtime The current time used to compute the actions' frame.
    * \param applyToObject Set to true if the actions must transform the object, else it only
    * manages actions' frames.
+   * \param applyPose Set to false to skip the armature pose evaluation of a culled armature.
    */
-  void Update(float curtime, bool applyToObject);
+  void Update(float curtime, bool applyToObject, bool applyPose);
 };
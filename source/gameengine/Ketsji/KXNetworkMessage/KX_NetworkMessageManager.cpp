@@ -31,59 +31,194 @@
  */
 
 #include "KX_NetworkMessageManager.h"
+#include "KX_NetworkTransport.h"
+#include "SCA_IObject.h"
 
-KX_NetworkMessageManager::KX_NetworkMessageManager() : m_currentList(0)
+#include <algorithm>
+#include <tuple>
+
+/// Order of the messages in a frame list: by receiver, subject and sending order.
+static bool message_less(const KX_NetworkMessageManager::Message &a,
+                         const KX_NetworkMessageManager::Message &b)
+{
+  return std::tie(a.to, a.subject, a.index) < std::tie(b.to, b.subject, b.index);
+}
+
+KX_NetworkMessageManager::KX_NetworkMessageManager()
+    : m_currentList(0), m_frame(0), m_transport(nullptr)
 {
+  // The empty name is used for the messages without receiver or subject.
+  GetNameId("");
 }
 
 KX_NetworkMessageManager::~KX_NetworkMessageManager()
 {
   ClearMessages();
+  CloseTransport();
+}
+
+KX_NetworkMessageManager::NameId KX_NetworkMessageManager::GetNameId(const std::string &name)
+{
+  const auto it = m_nameIds.find(name);
+  if (it != m_nameIds.end()) {
+    return it->second;
+  }
+
+  const NameId id = m_names.size();
+  m_names.push_back(name);
+  m_nameIds.emplace(name, id);
+  return id;
 }
 
-void KX_NetworkMessageManager::AddMessage(KX_NetworkMessageManager::Message message)
+KX_NetworkMessageManager::NameId KX_NetworkMessageManager::FindNameId(
+    const std::string &name) const
 {
-  // Put the new message in map for the given receiver and subject.
-  m_messages[m_currentList][message.to][message.subject].push_back(message);
+  const auto it = m_nameIds.find(name);
+  return (it != m_nameIds.end()) ? it->second : INVALID_NAME;
 }
 
-const std::vector<KX_NetworkMessageManager::Message> KX_NetworkMessageManager::GetMessages(
-    std::string to, std::string subject)
+const std::string &KX_NetworkMessageManager::GetName(NameId id) const
 {
-  std::vector<KX_NetworkMessageManager::Message> messages;
+  return m_names[id];
+}
 
-  // look at messages without receiver.
-  std::map<std::string, std::vector<Message>> &messagesNoReceiver =
-      m_messages[1 - m_currentList][""];
-  std::map<std::string, std::vector<Message>> &messagesReceiver =
-      m_messages[1 - m_currentList][to];
-  if (subject.empty()) {
-    // Add all message without receiver and subject.
-    for (const auto &pair : messagesNoReceiver) {
-      messages.insert(messages.end(), pair.second.begin(), pair.second.end());
-    }
-    // Add all message with the given receiver and no subject.
-    for (const auto &pair : messagesReceiver) {
-      messages.insert(messages.end(), pair.second.begin(), pair.second.end());
+void KX_NetworkMessageManager::AddLocalMessage(NameId to,
+                                               SCA_IObject *from,
+                                               NameId subject,
+                                               std::string_view body)
+{
+  FrameMessages &frame = m_frames[m_currentList];
+  const Message message = {to,
+                           subject,
+                           from,
+                           (unsigned int)frame.messages.size(),
+                           (unsigned int)frame.bodies.size(),
+                           (unsigned int)body.size()};
+  frame.messages.push_back(message);
+  frame.bodies.append(body);
+}
+
+void KX_NetworkMessageManager::AddMessage(const std::string &to,
+                                          SCA_IObject *from,
+                                          const std::string &subject,
+                                          std::string_view body)
+{
+  AddLocalMessage(GetNameId(to), from, GetNameId(subject), body);
+
+  if (m_transport) {
+    float position[3];
+    const bool hasPosition = from && from->GetNetworkPosition(position);
+    m_transport->QueueMessage(to, subject, body, hasPosition ? position : nullptr);
+  }
+}
+
+blender::Span<KX_NetworkMessageManager::Message> KX_NetworkMessageManager::FindMessages(
+    NameId to, NameId subject) const
+{
+  const std::vector<Message> &messages = m_frames[1 - m_currentList].messages;
+
+  // Compare the receivers, and the subjects only when filtering on a subject.
+  const auto less = [subject](const Message &a, const Message &b) {
+    if (a.to != b.to) {
+      return a.to < b.to;
     }
+    return subject != 0 && a.subject < b.subject;
+  };
+
+  Message key = {};
+  key.to = to;
+  key.subject = subject;
+  const auto range = std::equal_range(messages.begin(), messages.end(), key, less);
+
+  return blender::Span<Message>(messages.data() + (range.first - messages.begin()),
+                                range.second - range.first);
+}
+
+KX_NetworkMessageManager::MessageRange KX_NetworkMessageManager::GetMessages(
+    const std::string &to, const std::string &subject) const
+{
+  MessageRange range;
+
+  const NameId subjectId = subject.empty() ? 0 : FindNameId(subject);
+  // No message was ever sent with this subject.
+  if (subjectId == INVALID_NAME) {
+    return range;
   }
-  else {
-    std::vector<KX_NetworkMessageManager::Message> &messagesNoReceiverSubject =
-        messagesNoReceiver[subject];
-    messages.insert(
-        messages.end(), messagesNoReceiverSubject.begin(), messagesNoReceiverSubject.end());
-    std::vector<KX_NetworkMessageManager::Message> &messagesReceiverSubject =
-        messagesReceiver[subject];
-    messages.insert(
-        messages.end(), messagesReceiverSubject.begin(), messagesReceiverSubject.end());
+
+  // Look at messages without receiver.
+  range.noReceiver = FindMessages(0, subjectId);
+
+  const NameId toId = FindNameId(to);
+  if (toId != INVALID_NAME) {
+    range.receiver = FindMessages(toId, subjectId);
   }
 
-  return messages;
+  return range;
+}
+
+std::string_view KX_NetworkMessageManager::GetBody(const Message &message) const
+{
+  return std::string_view(m_frames[1 - m_currentList].bodies)
+      .substr(message.bodyOffset, message.bodySize);
+}
+
+unsigned int KX_NetworkMessageManager::GetFrame() const
+{
+  return m_frame;
 }
 
 void KX_NetworkMessageManager::ClearMessages()
 {
-  // Clear previous list.
-  m_messages[1 - m_currentList].clear();
+  // Clear previous list, its memory is reused for the next frame.
+  FrameMessages &previous = m_frames[1 - m_currentList];
+  previous.messages.clear();
+  previous.bodies.clear();
   m_currentList = 1 - m_currentList;
+  ++m_frame;
+
+  // Sort the messages of the frame now read by the sensors.
+  std::vector<Message> &messages = m_frames[1 - m_currentList].messages;
+  std::sort(messages.begin(), messages.end(), message_less);
+}
+
+KX_NetworkTransport *KX_NetworkMessageManager::OpenTransport(unsigned short port, bool server)
+{
+  CloseTransport();
+
+  KX_NetworkTransport *transport = new KX_NetworkTransport();
+  if (!transport->Open(port, server)) {
+    delete transport;
+    return nullptr;
+  }
+
+  m_transport = transport;
+  return m_transport;
+}
+
+void KX_NetworkMessageManager::CloseTransport()
+{
+  if (m_transport) {
+    delete m_transport;
+    m_transport = nullptr;
+  }
+}
+
+KX_NetworkTransport *KX_NetworkMessageManager::GetTransport() const
+{
+  return m_transport;
+}
+
+void KX_NetworkMessageManager::ExchangeMessages()
+{
+  if (!m_transport) {
+    return;
+  }
+
+  m_transport->Send();
+  m_transport->Receive();
+
+  // The remote messages have no local sender and are not sent back to the peers.
+  for (const KX_NetworkTransport::Message &message : m_transport->GetReceivedMessages()) {
+    AddLocalMessage(GetNameId(message.to), nullptr, GetNameId(message.subject), message.body);
+  }
 }
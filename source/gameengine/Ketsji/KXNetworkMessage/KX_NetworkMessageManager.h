@@ -34,51 +34,132 @@ conflicts with KX_NetworkMessageManager::SendMessage */
 #  undef SendMessage
 #endif
 
-#include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include "BLI_span.hh"
+
+class KX_NetworkTransport;
 class SCA_IObject;
 
 class KX_NetworkMessageManager {
  public:
+  /// Interned receiver or subject name, 0 is the empty name.
+  using NameId = unsigned int;
+  /// Identifier of a name never used by a message.
+  static constexpr NameId INVALID_NAME = (NameId)-1;
+
   struct Message {
     /// Receiver object(s) name.
-    std::string to;
+    NameId to;
+    /// Message subject, used as filter.
+    NameId subject;
     /// Sender game object.
     SCA_IObject *from;
-    /// Message subject, used as filter.
-    std::string subject;
-    /// Message body.
-    std::string body;
+    /// Position of the message in the sending order of its frame.
+    unsigned int index;
+    /// Location of the body in the frame body arena.
+    unsigned int bodyOffset;
+    unsigned int bodySize;
+  };
+
+  /// Messages found for a receiver and a subject, the messages without receiver come first.
+  struct MessageRange {
+    blender::Span<Message> noReceiver;
+    blender::Span<Message> receiver;
+
+    unsigned int size() const
+    {
+      return noReceiver.size() + receiver.size();
+    }
+    bool empty() const
+    {
+      return noReceiver.is_empty() && receiver.is_empty();
+    }
   };
 
  private:
-  /** List of all messages, filtered by receiver object(s) name and subject name.
-   * We use two lists, one handle sended message in the current frame and the other
-   * is used for handle message sended in the last frame for sensors.
+  /// Messages sent during a frame, in a flat arena reused from frame to frame.
+  struct FrameMessages {
+    /// Messages, sorted by receiver, subject and sending order once the frame is over.
+    std::vector<Message> messages;
+    /// Bodies of all the messages one after the other.
+    std::string bodies;
+  };
+
+  /** Messages of the current and last frame. We use two lists, one handle sended message in
+   * the current frame and the other is used for handle message sended in the last frame for
+   * sensors.
    */
-  std::map<std::string, std::map<std::string, std::vector<Message>>> m_messages[2];
+  FrameMessages m_frames[2];
 
   /** Since we use two list for the current and last frame we have to switch of
    * current message list each frame. This value is only 0 or 1.
    */
   unsigned short m_currentList;
+  /// Number of message list switches, identifies the messages returned by GetMessages.
+  unsigned int m_frame;
+
+  /// Interned names, the identifier of a name is its index.
+  std::vector<std::string> m_names;
+  std::unordered_map<std::string, NameId> m_nameIds;
+
+  /// Transport to the remote game engines, nullptr while the messages stay local.
+  KX_NetworkTransport *m_transport;
+
+  /// Add a message in the current message list without sending it to the remote peers.
+  void AddLocalMessage(NameId to, SCA_IObject *from, NameId subject, std::string_view body);
+
+  /// Messages of the last frame with the given receiver and subject, all subjects if 0.
+  blender::Span<Message> FindMessages(NameId to, NameId subject) const;
 
  public:
   KX_NetworkMessageManager();
   virtual ~KX_NetworkMessageManager();
 
-  /** Add a message in the next message list.
-   * \param message The given message to add.
+  /// Return the identifier of a name, interning it if needed.
+  NameId GetNameId(const std::string &name);
+  /// Return the identifier of a name or INVALID_NAME if the name was never interned.
+  NameId FindNameId(const std::string &name) const;
+  const std::string &GetName(NameId id) const;
+
+  /** Add a message in the current message list, and queue it for the remote peers when the
+   * transport is open.
+   * \param to The receiver object(s) name, empty for all objects.
+   * \param from The sender game object.
+   * \param subject The message subject.
+   * \param body The message body, copied in the frame arena.
    */
-  void AddMessage(Message message);
-  /** Get all messages for a given receiver object name and message subject.
+  void AddMessage(const std::string &to,
+                  SCA_IObject *from,
+                  const std::string &subject,
+                  std::string_view body);
+  /** Get all messages of the last frame for a given receiver object name and message subject.
+   * The messages are views in the message lists, valid until the next call to ClearMessages.
    * \param to The object(s) name.
-   * \param subject The message subject/filter.
+   * \param subject The message subject/filter, empty for all subjects.
    */
-  const std::vector<Message> GetMessages(std::string to, std::string subject);
+  MessageRange GetMessages(const std::string &to, const std::string &subject) const;
+  /// Return the body of a message returned by GetMessages.
+  std::string_view GetBody(const Message &message) const;
+  /// Return the number of message list switches, the messages found stay valid meanwhile.
+  unsigned int GetFrame() const;
 
-  /// Clear all messages
+  /// Clear all messages of the last frame and switch the message lists.
   void ClearMessages();
+
+  /** Open the transport to the remote game engines on a local UDP port, 0 for any port.
+   * \param server Open as server, see KX_NetworkTransport.
+   * \return The transport or nullptr if the port couldn't be opened.
+   */
+  KX_NetworkTransport *OpenTransport(unsigned short port, bool server);
+  void CloseTransport();
+  /// Return the open transport or nullptr.
+  KX_NetworkTransport *GetTransport() const;
+  /** Send the messages queued during the frame to the remote peers and add the messages
+   * received from them to the current message list, before ClearMessages.
+   */
+  void ExchangeMessages();
 };
@@ -0,0 +1,804 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file gameengine/Ketsji/KXNetworkMessage/KX_NetworkTransport.cpp
+ *  \ingroup ketsjinet
+ */
+
+#include "KX_NetworkTransport.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <iterator>
+
+#ifdef WIN32
+#  include <winsock2.h>
+#  include <ws2tcpip.h>
+#else
+#  include <arpa/inet.h>
+#  include <fcntl.h>
+#  include <netdb.h>
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+#endif
+
+/* Datagram layout, little endian:
+ * - Header: magic (u32), version (u8), flags (u8), record count (u16), sequence (u32),
+ *   send time (u32), echoed send time of the receiver (u32), delay since the echoed datagram
+ *   was received (u32), and if FLAG_INTEREST the interest center (3 f32) and radius (f32).
+ * - Records: type (u8) followed by the record strings, a string is a varint size and its bytes.
+ *   A message is its receiver, subject and body. A property is its scene, object network id (u32),
+ *   name, the value type (u8) and the value. An object is its scene, network id (u32), name and
+ *   flags (u8), a removal is its scene and network id (u32).
+ */
+static constexpr unsigned int DATAGRAM_MAGIC = 0x4D454742;  // "BGEM"
+static constexpr unsigned char DATAGRAM_VERSION = 3;
+static constexpr unsigned char FLAG_INTEREST = 1 << 0;
+/// Datagram size filled with records before being sent, below the usual network MTU.
+static constexpr unsigned int DATAGRAM_SIZE = 1200;
+/// Maximum size of a datagram, records bigger than this are dropped.
+static constexpr unsigned int DATAGRAM_MAX_SIZE = 65000;
+static constexpr unsigned int HEADER_MIN_SIZE = 24;
+static constexpr unsigned int HEADER_MAX_SIZE = HEADER_MIN_SIZE + 16;
+static constexpr unsigned char OBJECT_SPAWNED = 1 << 0;
+
+enum RecordType : unsigned char {
+  RECORD_MESSAGE = 0,
+  RECORD_PROPERTY,
+  RECORD_OBJECT,
+  RECORD_REMOVAL
+};
+
+static void write_u8(std::string &data, unsigned char value)
+{
+  data.push_back((char)value);
+}
+
+static void write_u16(std::string &data, unsigned short value)
+{
+  data.push_back((char)(value & 0xFF));
+  data.push_back((char)(value >> 8));
+}
+
+static void write_u32(std::string &data, unsigned int value)
+{
+  for (unsigned short i = 0; i < 4; ++i) {
+    data.push_back((char)((value >> (i * 8)) & 0xFF));
+  }
+}
+
+static void write_f32(std::string &data, float value)
+{
+  unsigned int bits;
+  memcpy(&bits, &value, sizeof(bits));
+  write_u32(data, bits);
+}
+
+static void write_string(std::string &data, std::string_view str)
+{
+  size_t size = str.size();
+  do {
+    const unsigned char byte = size & 0x7F;
+    size >>= 7;
+    data.push_back((char)(size ? (byte | 0x80) : byte));
+  } while (size);
+  data.append(str);
+}
+
+/// Bounds checked reader of a received datagram, invalid once reading past the end.
+struct DatagramReader {
+  std::string_view data;
+  size_t pos;
+  bool valid;
+
+  DatagramReader(std::string_view datagram) : data(datagram), pos(0), valid(true)
+  {
+  }
+
+  bool Check(size_t size)
+  {
+    valid = valid && (data.size() - pos >= size);
+    return valid;
+  }
+
+  unsigned char ReadU8()
+  {
+    return Check(1) ? (unsigned char)data[pos++] : 0;
+  }
+
+  unsigned short ReadU16()
+  {
+    const unsigned short low = ReadU8();
+    return low | (ReadU8() << 8);
+  }
+
+  unsigned int ReadU32()
+  {
+    unsigned int value = 0;
+    for (unsigned short i = 0; i < 4; ++i) {
+      value |= (unsigned int)ReadU8() << (i * 8);
+    }
+    return value;
+  }
+
+  float ReadF32()
+  {
+    const unsigned int bits = ReadU32();
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string_view ReadString()
+  {
+    size_t size = 0;
+    for (unsigned short shift = 0; valid; shift += 7) {
+      const unsigned char byte = ReadU8();
+      // Sizes are always smaller than a datagram.
+      if (shift > 21) {
+        valid = false;
+        break;
+      }
+      size |= (size_t)(byte & 0x7F) << shift;
+      if (!(byte & 0x80)) {
+        break;
+      }
+    }
+
+    if (!Check(size)) {
+      return std::string_view();
+    }
+    const std::string_view str = data.substr(pos, size);
+    pos += size;
+    return str;
+  }
+};
+
+static void close_socket(unsigned long long sock)
+{
+#ifdef WIN32
+  closesocket((SOCKET)sock);
+  WSACleanup();
+#else
+  close((int)sock);
+#endif
+}
+
+KX_NetworkTransport::KX_NetworkTransport()
+    : m_socket(0),
+      m_open(false),
+      m_server(false),
+      m_interest({false, {0.0f, 0.0f, 0.0f}, 0.0f}),
+      m_sequence(0),
+      m_frame(0),
+      m_startTime(std::chrono::steady_clock::now()),
+      m_stats({0, 0, 0, 0, 0, 0, 0, 0, 0})
+{
+}
+
+KX_NetworkTransport::~KX_NetworkTransport()
+{
+  Close();
+}
+
+bool KX_NetworkTransport::Open(unsigned short port, bool server)
+{
+  Close();
+
+#ifdef WIN32
+  WSADATA wsaData;
+  if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+    return false;
+  }
+  const SOCKET sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock == INVALID_SOCKET) {
+    WSACleanup();
+    return false;
+  }
+#else
+  const int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock < 0) {
+    return false;
+  }
+#endif
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  bool success = (bind(sock, (sockaddr *)&address, sizeof(address)) == 0);
+
+  // Receive reads the pending datagrams without waiting.
+#ifdef WIN32
+  u_long nonBlocking = 1;
+  success = success && (ioctlsocket(sock, FIONBIO, &nonBlocking) == 0);
+#else
+  success = success && (fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK) == 0);
+#endif
+
+  if (!success) {
+    close_socket(sock);
+    return false;
+  }
+
+  m_socket = sock;
+  m_open = true;
+  m_server = server;
+  return true;
+}
+
+void KX_NetworkTransport::Close()
+{
+  if (!m_open) {
+    return;
+  }
+
+  close_socket(m_socket);
+  m_open = false;
+
+  m_peers.clear();
+  m_records.clear();
+  m_messages.clear();
+  m_objects.clear();
+  m_properties.clear();
+  m_removals.clear();
+  m_receivedMessages.clear();
+  m_receivedObjects.clear();
+  m_receivedProperties.clear();
+}
+
+bool KX_NetworkTransport::IsOpen() const
+{
+  return m_open;
+}
+
+bool KX_NetworkTransport::IsServer() const
+{
+  return m_server;
+}
+
+unsigned short KX_NetworkTransport::GetPort() const
+{
+  if (!m_open) {
+    return 0;
+  }
+
+  sockaddr_in address = {};
+#ifdef WIN32
+  int size = sizeof(address);
+#else
+  socklen_t size = sizeof(address);
+#endif
+  if (getsockname(m_socket, (sockaddr *)&address, &size) != 0) {
+    return 0;
+  }
+  return ntohs(address.sin_port);
+}
+
+std::string KX_NetworkTransport::ObjectKey(const std::string &scene, unsigned int object)
+{
+  std::string key = scene;
+  key.push_back('\0');
+  write_u32(key, object);
+  return key;
+}
+
+unsigned int KX_NetworkTransport::GetTime() const
+{
+  const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() + 1;
+}
+
+KX_NetworkTransport::Peer *KX_NetworkTransport::FindPeer(unsigned int address,
+                                                         unsigned short port)
+{
+  for (Peer &peer : m_peers) {
+    if (peer.address == address && peer.port == port) {
+      return &peer;
+    }
+  }
+  return nullptr;
+}
+
+KX_NetworkTransport::Peer &KX_NetworkTransport::AddPeer(unsigned int address,
+                                                        unsigned short port,
+                                                        bool accepted)
+{
+  Peer peer;
+  peer.address = address;
+  peer.port = port;
+  peer.accepted = accepted;
+  peer.interest.enabled = false;
+  peer.lastSendTime = 0;
+  peer.lastReceiveTime = 0;
+  peer.roundTrip = -1.0f;
+  peer.recordCount = 0;
+  peer.lastSendFrame = 0;
+  m_peers.push_back(peer);
+  return m_peers.back();
+}
+
+bool KX_NetworkTransport::AddPeer(const std::string &host, unsigned short port)
+{
+  if (!m_open) {
+    return false;
+  }
+
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  addrinfo *result = nullptr;
+  if (getaddrinfo(host.c_str(), nullptr, &hints, &result) != 0 || !result) {
+    return false;
+  }
+
+  const unsigned int address = ((sockaddr_in *)result->ai_addr)->sin_addr.s_addr;
+  freeaddrinfo(result);
+
+  Peer *peer = FindPeer(address, htons(port));
+  if (!peer) {
+    AddPeer(address, htons(port), false);
+  }
+  else {
+    // An added peer never times out.
+    peer->accepted = false;
+  }
+  return true;
+}
+
+unsigned int KX_NetworkTransport::GetPeerCount() const
+{
+  return m_peers.size();
+}
+
+void KX_NetworkTransport::SetInterest(const float center[3], float radius)
+{
+  m_interest.enabled = true;
+  memcpy(m_interest.center, center, sizeof(m_interest.center));
+  m_interest.radius = radius;
+}
+
+void KX_NetworkTransport::ClearInterest()
+{
+  m_interest.enabled = false;
+}
+
+bool KX_NetworkTransport::IsInterested(const Peer &peer,
+                                       bool hasPosition,
+                                       const float position[3])
+{
+  // Senders without position, as the python messages, are sent to all the peers.
+  if (!peer.interest.enabled || !hasPosition) {
+    return true;
+  }
+
+  float distance2 = 0.0f;
+  for (unsigned short i = 0; i < 3; ++i) {
+    const float delta = position[i] - peer.interest.center[i];
+    distance2 += delta * delta;
+  }
+  return distance2 <= peer.interest.radius * peer.interest.radius;
+}
+
+void KX_NetworkTransport::QueueMessage(const std::string &to,
+                                       const std::string &subject,
+                                       std::string_view body,
+                                       const float *position)
+{
+  if (!m_open || m_peers.empty()) {
+    return;
+  }
+
+  Record record;
+  record.offset = m_records.size();
+  write_u8(m_records, RECORD_MESSAGE);
+  write_string(m_records, to);
+  write_string(m_records, subject);
+  write_string(m_records, body);
+  record.size = m_records.size() - record.offset;
+  record.hasPosition = (position != nullptr);
+  if (position) {
+    memcpy(record.position, position, sizeof(record.position));
+  }
+  m_messages.push_back(record);
+}
+
+void KX_NetworkTransport::QueueObject(const Object &object, const float *position)
+{
+  if (!m_open || m_peers.empty()) {
+    return;
+  }
+
+  PropertyRecord record;
+  record.object = ObjectKey(object.scene, object.object);
+  write_u8(record.record, RECORD_OBJECT);
+  write_string(record.record, object.scene);
+  write_u32(record.record, object.object);
+  write_string(record.record, object.name);
+  write_u8(record.record, object.spawned ? OBJECT_SPAWNED : 0);
+  record.hasPosition = (position != nullptr);
+  if (position) {
+    memcpy(record.position, position, sizeof(record.position));
+  }
+  m_objects.push_back(std::move(record));
+}
+
+void KX_NetworkTransport::QueueProperty(const Property &property, const float *position)
+{
+  if (!m_open || m_peers.empty()) {
+    return;
+  }
+
+  PropertyRecord record;
+  record.object = ObjectKey(property.scene, property.object);
+  record.name = property.name;
+  write_u8(record.record, RECORD_PROPERTY);
+  write_string(record.record, property.scene);
+  write_u32(record.record, property.object);
+  write_string(record.record, property.name);
+  write_u8(record.record, property.type);
+  write_string(record.record, property.value);
+  record.hasPosition = (position != nullptr);
+  if (position) {
+    memcpy(record.position, position, sizeof(record.position));
+  }
+  m_properties.push_back(std::move(record));
+}
+
+void KX_NetworkTransport::RemoveObject(const std::string &scene, unsigned int object)
+{
+  if (!m_open) {
+    return;
+  }
+
+  const std::string key = ObjectKey(scene, object);
+  bool bound = false;
+  for (Peer &peer : m_peers) {
+    peer.sentProperties.erase(key);
+    bound |= (peer.sentObjects.erase(key) > 0);
+  }
+
+  // Only the objects bound on a peer are removed from the peers.
+  if (bound) {
+    RemovalRecord removal;
+    write_u8(removal.record, RECORD_REMOVAL);
+    write_string(removal.record, scene);
+    write_u32(removal.record, object);
+    removal.sends = REMOVAL_SENDS;
+    m_removals.push_back(std::move(removal));
+  }
+}
+
+void KX_NetworkTransport::AppendRecord(Peer &peer, std::string_view record)
+{
+  if (record.size() + HEADER_MAX_SIZE > DATAGRAM_MAX_SIZE) {
+    ++m_stats.dropped;
+    return;
+  }
+
+  if (peer.recordCount > 0 &&
+      (peer.records.size() + record.size() + HEADER_MAX_SIZE > DATAGRAM_SIZE ||
+       peer.recordCount == USHRT_MAX))
+  {
+    SendDatagram(peer);
+  }
+
+  peer.records.append(record);
+  ++peer.recordCount;
+}
+
+void KX_NetworkTransport::SendDatagram(Peer &peer)
+{
+  const unsigned int time = GetTime();
+
+  m_buffer.clear();
+  write_u32(m_buffer, DATAGRAM_MAGIC);
+  write_u8(m_buffer, DATAGRAM_VERSION);
+  write_u8(m_buffer, m_interest.enabled ? FLAG_INTEREST : 0);
+  write_u16(m_buffer, peer.recordCount);
+  write_u32(m_buffer, ++m_sequence);
+  write_u32(m_buffer, time);
+  // Echo the last datagram of the peer for it to measure the round trip time.
+  write_u32(m_buffer, peer.lastSendTime);
+  write_u32(m_buffer, peer.lastSendTime ? time - peer.lastReceiveTime : 0);
+  if (m_interest.enabled) {
+    for (unsigned short i = 0; i < 3; ++i) {
+      write_f32(m_buffer, m_interest.center[i]);
+    }
+    write_f32(m_buffer, m_interest.radius);
+  }
+  m_buffer.append(peer.records);
+
+  sockaddr_in address = {};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = peer.address;
+  address.sin_port = peer.port;
+  const long long sent = sendto(
+      m_socket, m_buffer.data(), (int)m_buffer.size(), 0, (sockaddr *)&address, sizeof(address));
+
+  if (sent == (long long)m_buffer.size()) {
+    m_stats.bytesSent += sent;
+    ++m_stats.datagramsSent;
+  }
+  else {
+    ++m_stats.dropped;
+  }
+
+  peer.records.clear();
+  peer.recordCount = 0;
+  peer.lastSendFrame = m_frame;
+}
+
+void KX_NetworkTransport::Send()
+{
+  if (!m_open) {
+    return;
+  }
+
+  ++m_frame;
+  const bool fullUpdate = (m_frame % FULL_UPDATE_INTERVAL) == 0;
+
+  for (Peer &peer : m_peers) {
+    for (const Record &record : m_messages) {
+      if (IsInterested(peer, record.hasPosition, record.position)) {
+        AppendRecord(peer, std::string_view(m_records).substr(record.offset, record.size));
+        ++m_stats.messagesSent;
+      }
+    }
+
+    // A removal is sent the frame it is queued and at the next full updates.
+    for (const RemovalRecord &removal : m_removals) {
+      if (fullUpdate || removal.sends == REMOVAL_SENDS) {
+        AppendRecord(peer, removal.record);
+      }
+    }
+
+    // The objects are bound before their properties are sent.
+    for (const PropertyRecord &object : m_objects) {
+      if (!IsInterested(peer, object.hasPosition, object.position)) {
+        continue;
+      }
+      if (peer.sentObjects.insert(object.object).second || fullUpdate) {
+        AppendRecord(peer, object.record);
+      }
+    }
+
+    for (const PropertyRecord &property : m_properties) {
+      if (!IsInterested(peer, property.hasPosition, property.position)) {
+        continue;
+      }
+      // Only send the values changed since the last value sent to this peer.
+      std::string &sent = peer.sentProperties[property.object][property.name];
+      if (fullUpdate || sent != property.record) {
+        AppendRecord(peer, property.record);
+        sent = property.record;
+        ++m_stats.propertiesSent;
+      }
+    }
+
+    // Send the last datagram, or a heartbeat keeping the interest and round trip time updated.
+    if (peer.recordCount > 0 || m_frame - peer.lastSendFrame >= HEARTBEAT_INTERVAL) {
+      SendDatagram(peer);
+    }
+  }
+
+  for (RemovalRecord &removal : m_removals) {
+    if (fullUpdate || removal.sends == REMOVAL_SENDS) {
+      --removal.sends;
+    }
+  }
+  m_removals.erase(
+      std::remove_if(m_removals.begin(),
+                     m_removals.end(),
+                     [](const RemovalRecord &removal) { return removal.sends == 0; }),
+      m_removals.end());
+
+  m_records.clear();
+  m_messages.clear();
+  m_objects.clear();
+  m_properties.clear();
+}
+
+bool KX_NetworkTransport::ParseDatagram(Peer &peer, std::string_view datagram)
+{
+  DatagramReader reader(datagram);
+  if (reader.ReadU32() != DATAGRAM_MAGIC || reader.ReadU8() != DATAGRAM_VERSION) {
+    return false;
+  }
+
+  const unsigned char flags = reader.ReadU8();
+  const unsigned short recordCount = reader.ReadU16();
+  // Sequence, unused for now.
+  reader.ReadU32();
+  const unsigned int sendTime = reader.ReadU32();
+  const unsigned int echoTime = reader.ReadU32();
+  const unsigned int echoDelay = reader.ReadU32();
+
+  Interest interest = {false, {0.0f, 0.0f, 0.0f}, 0.0f};
+  if (flags & FLAG_INTEREST) {
+    interest.enabled = true;
+    for (unsigned short i = 0; i < 3; ++i) {
+      interest.center[i] = reader.ReadF32();
+    }
+    interest.radius = reader.ReadF32();
+  }
+
+  m_parsedMessages.clear();
+  m_parsedObjects.clear();
+  m_parsedProperties.clear();
+  for (unsigned short i = 0; i < recordCount && reader.valid; ++i) {
+    switch (reader.ReadU8()) {
+      case RECORD_MESSAGE: {
+        const std::string_view to = reader.ReadString();
+        const std::string_view subject = reader.ReadString();
+        const std::string_view body = reader.ReadString();
+        m_parsedMessages.push_back({std::string(to), std::string(subject), std::string(body)});
+        break;
+      }
+      case RECORD_PROPERTY: {
+        const std::string_view scene = reader.ReadString();
+        const unsigned int object = reader.ReadU32();
+        const std::string_view name = reader.ReadString();
+        const unsigned char type = reader.ReadU8();
+        const std::string_view value = reader.ReadString();
+        m_parsedProperties.push_back(
+            {std::string(scene), object, std::string(name), type, std::string(value)});
+        break;
+      }
+      case RECORD_OBJECT: {
+        const std::string_view scene = reader.ReadString();
+        const unsigned int object = reader.ReadU32();
+        const std::string_view name = reader.ReadString();
+        const bool spawned = (reader.ReadU8() & OBJECT_SPAWNED) != 0;
+        m_parsedObjects.push_back({std::string(scene), object, std::string(name), spawned, false});
+        break;
+      }
+      case RECORD_REMOVAL: {
+        const std::string_view scene = reader.ReadString();
+        const unsigned int object = reader.ReadU32();
+        m_parsedObjects.push_back({std::string(scene), object, std::string(), false, true});
+        break;
+      }
+      default: {
+        reader.valid = false;
+        break;
+      }
+    }
+  }
+
+  if (!reader.valid) {
+    return false;
+  }
+
+  // The datagram is valid, update the peer and receive its records.
+  const unsigned int time = GetTime();
+  peer.interest = interest;
+  peer.lastSendTime = sendTime;
+  peer.lastReceiveTime = time;
+
+  if (echoTime != 0 && time >= echoTime + echoDelay) {
+    const float roundTrip = (float)(time - echoTime - echoDelay);
+    peer.roundTrip = (peer.roundTrip < 0.0f) ? roundTrip :
+                                                peer.roundTrip * 0.875f + roundTrip * 0.125f;
+  }
+
+  m_receivedMessages.insert(m_receivedMessages.end(),
+                            std::make_move_iterator(m_parsedMessages.begin()),
+                            std::make_move_iterator(m_parsedMessages.end()));
+  m_receivedObjects.insert(m_receivedObjects.end(),
+                           std::make_move_iterator(m_parsedObjects.begin()),
+                           std::make_move_iterator(m_parsedObjects.end()));
+  m_receivedProperties.insert(m_receivedProperties.end(),
+                              std::make_move_iterator(m_parsedProperties.begin()),
+                              std::make_move_iterator(m_parsedProperties.end()));
+  m_stats.messagesReceived += m_parsedMessages.size();
+  m_stats.propertiesReceived += m_parsedProperties.size();
+
+  return true;
+}
+
+void KX_NetworkTransport::Receive()
+{
+  m_receivedMessages.clear();
+  m_receivedObjects.clear();
+  m_receivedProperties.clear();
+
+  if (!m_open) {
+    return;
+  }
+
+  m_buffer.resize(DATAGRAM_MAX_SIZE);
+  while (true) {
+    sockaddr_in address = {};
+#ifdef WIN32
+    int addressSize = sizeof(address);
+#else
+    socklen_t addressSize = sizeof(address);
+#endif
+    const long long size = recvfrom(m_socket,
+                                    m_buffer.data(),
+                                    (int)m_buffer.size(),
+                                    0,
+                                    (sockaddr *)&address,
+                                    &addressSize);
+    // No more pending datagram.
+    if (size <= 0) {
+      break;
+    }
+
+    m_stats.bytesReceived += size;
+    ++m_stats.datagramsReceived;
+
+    const std::string_view datagram(m_buffer.data(), size);
+    if (size < HEADER_MIN_SIZE || DatagramReader(datagram).ReadU32() != DATAGRAM_MAGIC) {
+      ++m_stats.dropped;
+      continue;
+    }
+
+    Peer *peer = FindPeer(address.sin_addr.s_addr, address.sin_port);
+    if (!peer) {
+      // Only a server accepts unknown senders, and only up to a maximum number.
+      const unsigned int acceptedCount = std::count_if(
+          m_peers.begin(), m_peers.end(), [](const Peer &other) { return other.accepted; });
+      if (!m_server || acceptedCount >= MAX_ACCEPTED_PEERS) {
+        ++m_stats.dropped;
+        continue;
+      }
+      peer = &AddPeer(address.sin_addr.s_addr, address.sin_port, true);
+    }
+
+    if (!ParseDatagram(*peer, datagram)) {
+      ++m_stats.dropped;
+      // Don't accept a sender before its first valid datagram.
+      if (peer->accepted && peer->lastReceiveTime == 0) {
+        m_peers.pop_back();
+      }
+    }
+  }
+
+  // Forget the accepted peers without valid datagram for too long.
+  const unsigned int time = GetTime();
+  m_peers.erase(std::remove_if(m_peers.begin(),
+                               m_peers.end(),
+                               [time](const Peer &peer) {
+                                 return peer.accepted &&
+                                        time - peer.lastReceiveTime > PEER_TIMEOUT;
+                               }),
+                m_peers.end());
+}
+
+const std::vector<KX_NetworkTransport::Message> &KX_NetworkTransport::GetReceivedMessages() const
+{
+  return m_receivedMessages;
+}
+
+const std::vector<KX_NetworkTransport::Object> &KX_NetworkTransport::GetReceivedObjects() const
+{
+  return m_receivedObjects;
+}
+
+const std::vector<KX_NetworkTransport::Property> &KX_NetworkTransport::GetReceivedProperties()
+    const
+{
+  return m_receivedProperties;
+}
+
+const KX_NetworkTransport::Stats &KX_NetworkTransport::GetStats() const
+{
+  return m_stats;
+}
+
+float KX_NetworkTransport::GetLatency() const
+{
+  float total = 0.0f;
+  unsigned int count = 0;
+  for (const Peer &peer : m_peers) {
+    if (peer.roundTrip >= 0.0f) {
+      total += peer.roundTrip;
+      ++count;
+    }
+  }
+
+  return (count > 0) ? total / count : -1.0f;
+}
@@ -0,0 +1,246 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file KX_NetworkTransport.h
+ *  \ingroup ketsjinet
+ *  \brief Ketsji Logic Extension: UDP transport of the network messages
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/** UDP transport of the network messages and replicated game properties between game engine
+ * instances. The messages sent during a logic frame are packed in datagrams sent at the end of
+ * the frame. A replicated property is only sent to a peer when its value changed since the last
+ * value sent to this peer, and every FULL_UPDATE_INTERVAL frames to recover from lost datagrams.
+ * A peer only receives the records of the senders inside its interest area, a sphere announced
+ * in each of its datagrams.
+ *
+ * A client only exchanges datagrams with the peers it added, and applies the replicated
+ * properties it receives. A server also accepts the datagrams of unknown senders, up to
+ * MAX_ACCEPTED_PEERS peers removed after PEER_TIMEOUT without datagram, and is the only one
+ * sending the replicated properties.
+ *
+ * The server gives the network ids of the objects and sends a record binding each id to an
+ * object before its properties, again at every full update. The removal of a bound object is
+ * sent REMOVAL_SENDS times.
+ */
+class KX_NetworkTransport {
+ public:
+  /// Message received from a peer.
+  struct Message {
+    std::string to;
+    std::string subject;
+    std::string body;
+  };
+
+  /// Object of the server bound to its network id, or removed by the server.
+  struct Object {
+    std::string scene;
+    /// Network id given by the server, see KX_Scene::RegisterNetworkObject.
+    unsigned int object;
+    /// Name of the object, also the name of the original object of a spawned replica.
+    std::string name;
+    /// Replica added during the game, the clients add their own replica of the original.
+    bool spawned;
+    /// The server removed the object, name and spawned are unused.
+    bool removed;
+  };
+
+  /// Replicated game property, the value is packed by the scene depending on the type.
+  struct Property {
+    std::string scene;
+    /// Network id given by the server to the object, see Object.
+    unsigned int object;
+    std::string name;
+    /// VALUE_DATA_TYPE of the property.
+    unsigned char type;
+    std::string value;
+  };
+
+  struct Stats {
+    unsigned long long bytesSent;
+    unsigned long long bytesReceived;
+    unsigned int datagramsSent;
+    unsigned int datagramsReceived;
+    unsigned int messagesSent;
+    unsigned int messagesReceived;
+    unsigned int propertiesSent;
+    unsigned int propertiesReceived;
+    /// Records too big for a datagram, and datagrams failing to be sent or parsed.
+    unsigned int dropped;
+  };
+
+  /// Frames between two full updates of the replicated properties.
+  static constexpr unsigned int FULL_UPDATE_INTERVAL = 60;
+  /// Frames between two datagrams sent to a peer when there is nothing else to send.
+  static constexpr unsigned int HEARTBEAT_INTERVAL = 10;
+  /// Maximum number of peers a server accepts in addition to the peers it added.
+  static constexpr unsigned int MAX_ACCEPTED_PEERS = 64;
+  /// Milliseconds without datagram before an accepted peer is removed.
+  static constexpr unsigned int PEER_TIMEOUT = 10000;
+  /// Times an object removal is sent, at the next frame and at the following full updates.
+  static constexpr unsigned int REMOVAL_SENDS = 3;
+
+ private:
+  struct Interest {
+    bool enabled;
+    float center[3];
+    float radius;
+  };
+
+  struct Peer {
+    /// IPv4 address and port, in network byte order.
+    unsigned int address;
+    unsigned short port;
+    /// Accepted by a server when receiving its datagrams, instead of added by AddPeer.
+    bool accepted;
+    Interest interest;
+    /// Send time of the last datagram received from the peer, 0 if none.
+    unsigned int lastSendTime;
+    /// Local time the last datagram was received.
+    unsigned int lastReceiveTime;
+    /// Smoothed round trip time in milliseconds, negative until measured.
+    float roundTrip;
+    /// Last records sent for each replicated property name of each object key.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> sentProperties;
+    /// Keys of the objects bound to their network id on the peer.
+    std::unordered_set<std::string> sentObjects;
+    /// Records of the datagram being filled.
+    std::string records;
+    unsigned short recordCount;
+    /// Frame of the last datagram sent.
+    unsigned int lastSendFrame;
+  };
+
+  /// Outgoing record, its data is in m_records.
+  struct Record {
+    unsigned int offset;
+    unsigned int size;
+    bool hasPosition;
+    float position[3];
+  };
+
+  /// Outgoing property record, compared to the last record sent to each peer.
+  struct PropertyRecord {
+    /// Scene name and network id of the object, see ObjectKey.
+    std::string object;
+    std::string name;
+    std::string record;
+    bool hasPosition;
+    float position[3];
+  };
+
+  /// Outgoing object removal record, sent to all the peers.
+  struct RemovalRecord {
+    std::string record;
+    /// Times the record is still sent.
+    unsigned int sends;
+  };
+
+#ifdef WIN32
+  using Socket = unsigned long long;
+#else
+  using Socket = int;
+#endif
+
+  Socket m_socket;
+  bool m_open;
+  bool m_server;
+  std::vector<Peer> m_peers;
+  Interest m_interest;
+  unsigned int m_sequence;
+  unsigned int m_frame;
+  std::chrono::steady_clock::time_point m_startTime;
+
+  /// Messages queued during the frame, packed one after the other.
+  std::string m_records;
+  std::vector<Record> m_messages;
+  /// Object records of the frame, the name of the records is unused.
+  std::vector<PropertyRecord> m_objects;
+  std::vector<PropertyRecord> m_properties;
+  std::vector<RemovalRecord> m_removals;
+
+  std::vector<Message> m_receivedMessages;
+  std::vector<Object> m_receivedObjects;
+  std::vector<Property> m_receivedProperties;
+  /// Records of the datagram being parsed, only received if the whole datagram is valid.
+  std::vector<Message> m_parsedMessages;
+  std::vector<Object> m_parsedObjects;
+  std::vector<Property> m_parsedProperties;
+
+  /// Buffer of the datagrams sent and received.
+  std::string m_buffer;
+
+  Stats m_stats;
+
+  /// Key of an object in the properties sent to the peers.
+  static std::string ObjectKey(const std::string &scene, unsigned int object);
+  /// Time in milliseconds since the transport creation, never 0.
+  unsigned int GetTime() const;
+  Peer *FindPeer(unsigned int address, unsigned short port);
+  Peer &AddPeer(unsigned int address, unsigned short port, bool accepted);
+  static bool IsInterested(const Peer &peer, bool hasPosition, const float position[3]);
+
+  /// Append a record to the datagram of a peer, sending the datagram first if full.
+  void AppendRecord(Peer &peer, std::string_view record);
+  /// Send the datagram of a peer, with its header.
+  void SendDatagram(Peer &peer);
+  /// Parse a received datagram, return false and ignore the datagram if invalid.
+  bool ParseDatagram(Peer &peer, std::string_view datagram);
+
+ public:
+  KX_NetworkTransport();
+  ~KX_NetworkTransport();
+
+  /** Open the UDP socket on a local port, 0 for any port.
+   * \param server Accept the datagrams of unknown senders, else only of the added peers.
+   */
+  bool Open(unsigned short port, bool server);
+  void Close();
+  bool IsOpen() const;
+  bool IsServer() const;
+  /// Return the local port, 0 if not open.
+  unsigned short GetPort() const;
+
+  /// Add a remote peer by host name or IPv4 address.
+  bool AddPeer(const std::string &host, unsigned short port);
+  unsigned int GetPeerCount() const;
+
+  /// Set the sphere of the senders the remote peers send us records from.
+  void SetInterest(const float center[3], float radius);
+  void ClearInterest();
+
+  /** Queue a message for the peers interested in the sender position.
+   * \param position The sender world position or nullptr to send to all peers.
+   */
+  void QueueMessage(const std::string &to,
+                    const std::string &subject,
+                    std::string_view body,
+                    const float *position);
+  /// Queue the binding of an object of a server, only sent to the peers not knowing it yet.
+  void QueueObject(const Object &object, const float *position);
+  /// Queue a replicated property, only sent to the peers if changed.
+  void QueueProperty(const Property &property, const float *position);
+  /// Forget the properties sent for a removed object and send its removal to the peers.
+  void RemoveObject(const std::string &scene, unsigned int object);
+
+  /// Send the queued messages and properties, once per logic frame.
+  void Send();
+  /// Receive the datagrams of the peers, replacing the received messages and properties.
+  void Receive();
+
+  const std::vector<Message> &GetReceivedMessages() const;
+  /// Object bindings and removals, received before the properties of the same datagrams.
+  const std::vector<Object> &GetReceivedObjects() const;
+  const std::vector<Property> &GetReceivedProperties() const;
+
+  const Stats &GetStats() const;
+  /// Round trip time to the peers in milliseconds averaged over the peers, negative if unknown.
+  float GetLatency() const;
+};
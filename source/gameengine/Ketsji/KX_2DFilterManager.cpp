@@ -28,6 +28,8 @@
 
 #include "CM_Message.h"
 #include "KX_2DFilter.h"
+#include "KX_Globals.h"
+#include "KX_KetsjiEngine.h"
 
 using namespace blender;
 
@@ -122,6 +124,13 @@ EXP_PYMETHODDEF_DOC(KX_2DFilterManager, addFilter, " addFilter(index, type, frag
     return nullptr;
   }
 
+  if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+    PyErr_SetString(PyExc_RuntimeError,
+                    "filterManager.addFilter(index, type, fragmentProgram): KX_2DFilterManager, "
+                    "2D filters are not available in headless mode");
+    return nullptr;
+  }
+
   if (GetFilterPass(index)) {
     PyErr_Format(PyExc_ValueError,
                  "filterManager.addFilter(index, type, fragmentProgram): KX_2DFilterManager, "
@@ -31,6 +31,10 @@
 
 #include "KX_CollisionEventManager.h"
 
+#include <algorithm>
+
+#include "PRF_profile.hh"
+
 #include "KX_CollisionContactPoints.h"
 #include "PHY_IPhysicsController.h"
 #include "PHY_IPhysicsEnvironment.h"
@@ -64,7 +68,7 @@ bool KX_CollisionEventManager::NewHandleCollision(PHY_IPhysicsController *ctrl1,
                                                   const PHY_ICollData *coll_data,
                                                   bool first)
 {
-  m_newCollisions.insert(NewCollision(ctrl1, ctrl2, coll_data, first));
+  m_newCollisions.emplace_back(ctrl1, ctrl2, coll_data, first);
 
   return false;
 }
@@ -178,10 +182,16 @@ void KX_CollisionEventManager::EndFrame()
 
 void KX_CollisionEventManager::NextFrame()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   for (SCA_ISensor *sensor : m_sensors) {
     static_cast<SCA_CollisionSensor *>(sensor)->SynchronizeTransform();
   }
 
+  // The same collision can be reported several times.
+  std::sort(m_newCollisions.begin(), m_newCollisions.end());
+  m_newCollisions.erase(std::unique(m_newCollisions.begin(), m_newCollisions.end()),
+                        m_newCollisions.end());
+
   for (const NewCollision &collision : m_newCollisions) {
     // Controllers
     PHY_IPhysicsController *ctrl1 = collision.first;
@@ -218,9 +228,7 @@ void KX_CollisionEventManager::NextFrame()
     kxObj2->RunCollisionCallbacks(kxObj1, contactPointList1);
   }
 
-  for (SCA_ISensor *sensor : m_sensors) {
-    sensor->Activate(m_logicmgr);
-  }
+  ActivateSensors();
 
   RemoveNewCollisions();
 }
@@ -262,3 +270,9 @@ bool KX_CollisionEventManager::NewCollision::operator<(const NewCollision &other
   }
   return first < other.first;
 }
+
+bool KX_CollisionEventManager::NewCollision::operator==(const NewCollision &other) const
+{
+  return (first == other.first && second == other.second && colldata == other.colldata &&
+          isFirst == other.isFirst);
+}
@@ -31,7 +31,6 @@
 
 #pragma once
 
-#include <set>
 #include <vector>
 
 #include "KX_GameObject.h"
@@ -53,23 +52,22 @@ class KX_CollisionEventManager : public SCA_EventManager {
     bool isFirst;
 
     /**
-     * Creates a copy of the given PHY_ICollData; freeing that copy should be done by the owner of
-     * the NewCollision object.
-     *
-     * This allows us to efficiently store NewCollision objects in a std::set without creating more
-     * copies of colldata, as the NewCollision copy constructor reuses the pointer and doesn't
-     * clone it again. */
+     * The PHY_ICollData is owned by the physics environment and valid until its next tick,
+     * the NewCollision objects only reference it. */
     NewCollision(PHY_IPhysicsController *first,
                  PHY_IPhysicsController *second,
                  const PHY_ICollData *colldata,
                  bool isFirst);
     NewCollision(const NewCollision &to_copy);
     bool operator<(const NewCollision &other) const;
+    bool operator==(const NewCollision &other) const;
   };
 
   PHY_IPhysicsEnvironment *m_physEnv;
 
-  std::set<NewCollision> m_newCollisions;
+  /** The collisions reported since the last frame, sorted and made unique in NextFrame.
+   * The vector keeps its storage from one frame to the next one. */
+  std::vector<NewCollision> m_newCollisions;
 
   static bool newCollisionResponse(void *client_data,
                                    PHY_IPhysicsController *ctrl1,
@@ -38,6 +38,8 @@
 
 #include "KX_GameObject.h"
 
+#include <algorithm>
+
 #include "BKE_context.hh"
 #include "BKE_layer.hh"
 #include "BKE_lib_id.hh"
@@ -99,6 +101,10 @@ KX_GameObject::KX_GameObject()
       m_objectColor(1.0f, 1.0f, 1.0f, 1.0f),
       m_bVisible(true),
       m_bOccluder(false),
+      m_animationLod(true),
+      m_animationLodRadius(1.0f),
+      m_animationLodPhase(0),
+      m_networkId(0),
       m_pPhysicsController(nullptr),
       m_pSGNode(nullptr),
       m_pInstanceObjects(nullptr),
@@ -235,6 +241,8 @@ void KX_GameObject::SyncTransformWithDepsgraph()
 void KX_GameObject::ForceIgnoreParentTx()
 {
   m_forceIgnoreParentTx = true;
+  // Static objects are not visited by the depsgraph sync unless requested.
+  GetSGNode()->RequestRenderUpdate();
 }
 
 /* Before BKE_scene_graph_update_tagged */
@@ -640,6 +648,79 @@ void KX_GameObject::RestoreLogicAndActions(bool childrenRecursive)
   }
 }
 
+void KX_GameObject::SuspendPooledReplica()
+{
+#ifdef WITH_PYTHON
+  RunOnRemoveCallbacks();
+  Py_CLEAR(m_removeCallbacks);
+
+  if (m_collisionCallbacks) {
+    UnregisterCollisionCallbacks();
+    Py_CLEAR(m_collisionCallbacks);
+  }
+
+  if (m_attr_dict) {
+    PyDict_Clear(m_attr_dict);
+    Py_CLEAR(m_attr_dict);
+  }
+#endif  // WITH_PYTHON
+
+  if (m_actionManager) {
+    delete m_actionManager;
+    m_actionManager = nullptr;
+  }
+
+  KX_Scene *scene = GetScene();
+  if (m_lodManager) {
+    scene->RemoveObjFromLodObjList(this);
+  }
+  scene->GetBlenderSceneConverter()->UnregisterGameObject(this);
+
+  SetVisible(false, false);
+
+  if (m_pPhysicsController && !m_pPhysicsController->IsPhysicsSuspended()) {
+    m_pPhysicsController->SuspendPhysics(true);
+  }
+}
+
+void KX_GameObject::RestorePooledReplica(KX_GameObject *original)
+{
+  ReplicateProperties(original);
+
+#ifdef WITH_PYTHON
+  if (original->m_attr_dict) {
+    m_attr_dict = PyDict_Copy(original->m_attr_dict);
+  }
+#endif  // WITH_PYTHON
+
+  KX_Scene *scene = GetScene();
+  if (m_lodManager) {
+    scene->AddObjToLodObjList(this);
+  }
+  scene->GetBlenderSceneConverter()->RegisterGameObject(this, m_pBlenderObject);
+
+  // The state is set again when the logic is replicated.
+  m_state = 0;
+
+  SetVisible(original->GetVisible(), false);
+  SetObjectColor(original->GetObjectColor());
+  SetCollisionGroup(original->GetCollisionGroup());
+  SetCollisionMask(original->GetCollisionMask());
+
+  if (m_pPhysicsController) {
+    PHY_IPhysicsController *orgctrl = original->GetPhysicsController();
+    if (orgctrl) {
+      m_pPhysicsController->SetMass(orgctrl->GetMass());
+    }
+    if (m_pPhysicsController->IsDynamicsSuspended()) {
+      m_pPhysicsController->RestoreDynamics();
+    }
+    m_pPhysicsController->RestorePhysics();
+    m_pPhysicsController->SetLinearVelocity(MT_Vector3(0.0f, 0.0f, 0.0f), false);
+    m_pPhysicsController->SetAngularVelocity(MT_Vector3(0.0f, 0.0f, 0.0f), false);
+  }
+}
+
 KX_GameObject::ActivityCullingInfo &KX_GameObject::GetActivityCullingInfo()
 {
   return m_activityCullingInfo;
@@ -954,9 +1035,9 @@ bool KX_GameObject::IsActionsSuspended()
   return GetActionManager()->IsSuspended();
 }
 
-void KX_GameObject::UpdateActionManager(float curtime, bool applyToObject)
+void KX_GameObject::UpdateActionManager(float curtime, bool applyToObject, bool applyPose)
 {
-  GetActionManager()->Update(curtime, applyToObject);
+  GetActionManager()->Update(curtime, applyToObject, applyPose);
 }
 
 float KX_GameObject::GetActionFrame(short layer)
@@ -1209,15 +1290,27 @@ KX_LodManager *KX_GameObject::GetLodManager() const
   return m_lodManager;
 }
 
-void KX_GameObject::UpdateLod(const MT_Vector3 &cam_pos, float lodfactor)
+bool KX_GameObject::IsLodUpdateNeeded(bool depsgraphUpdated) const
+{
+  if (m_currentLodLevel != m_previousLodLevel) {
+    return true;
+  }
+
+  if (!depsgraphUpdated) {
+    return false;
+  }
+
+  KX_LodLevel *currentLodLevel = m_lodManager->GetLevel(m_currentLodLevel);
+  return currentLodLevel && currentLodLevel->GetObject() != m_pBlenderObject;
+}
+
+void KX_GameObject::UpdateLod(short level, blender::Depsgraph *depsgraph)
 {
   if (!m_lodManager) {
     return;
   }
 
   KX_Scene *scene = GetScene();
-  const float distance2 = NodeGetWorldPosition().distance2(cam_pos) * (lodfactor * lodfactor);
-  KX_LodLevel *lodLevel = m_lodManager->GetLevel(scene, m_currentLodLevel, distance2);
 
   bool updatePhysicsShape = false;
   bool back_to_level0 = false;
@@ -1237,20 +1330,17 @@ void KX_GameObject::UpdateLod(const MT_Vector3 &cam_pos, float lodfactor)
     m_previousLodLevel = m_currentLodLevel;
   }
 
-  if (lodLevel) {
-    RAS_MeshObject *mesh = lodLevel->GetMesh();
+  if (level != m_currentLodLevel) {
+    RAS_MeshObject *mesh = m_lodManager->GetLevel(level)->GetMesh();
     if (mesh != m_meshes[0]) {
       scene->ReplaceMesh(this, mesh, true, false);
     }
-    m_currentLodLevel = lodLevel->GetLevel();
+    m_currentLodLevel = level;
   }
 
   KX_LodLevel *currentLodLevel = m_lodManager->GetLevel(m_currentLodLevel);
 
   if (currentLodLevel) {
-    blender::bContext *C = KX_GetActiveEngine()->GetContext();
-    blender::Depsgraph *depsgraph = CTX_data_expect_evaluated_depsgraph(C);
-
     /* Here we want to change the object which will be rendered, then the evaluated object by the
      * depsgraph */
     blender::Object *ob_eval = DEG_get_evaluated(depsgraph, GetBlenderObject());
@@ -1816,6 +1906,22 @@ const MT_Vector3 &KX_GameObject::NodeGetWorldPosition() const
   return m_pSGNode->GetWorldPosition();
 }
 
+bool KX_GameObject::GetNetworkPosition(float r_position[3]) const
+{
+  if (!m_pSGNode) {
+    return false;
+  }
+
+  NodeGetWorldPosition().getValue(r_position);
+  return true;
+}
+
+bool KX_GameObject::IsReplicatedProperty(const std::string &name) const
+{
+  return std::find(m_replicatedProperties.begin(), m_replicatedProperties.end(), name) !=
+         m_replicatedProperties.end();
+}
+
 const MT_Vector3 &KX_GameObject::NodeGetLocalPosition() const
 {
   return m_pSGNode->GetLocalPosition();
@@ -2309,6 +2415,7 @@ PyMethodDef KX_GameObject::Methods[] = {
     EXP_PYMETHODTABLE_O(KX_GameObject, getVectTo),
     EXP_PYMETHODTABLE_KEYWORDS(KX_GameObject, sendMessage),
     EXP_PYMETHODTABLE(KX_GameObject, addDebugProperty),
+    EXP_PYMETHODTABLE(KX_GameObject, replicateProperty),
 
     EXP_PYMETHODTABLE_KEYWORDS(KX_GameObject, playAction),
     EXP_PYMETHODTABLE(KX_GameObject, stopAction),
@@ -2333,6 +2440,7 @@ PyAttributeDef KX_GameObject::Attributes[] = {
     EXP_PYATTRIBUTE_RO_FUNCTION("groupObject", KX_GameObject, pyattr_get_group_object),
     EXP_PYATTRIBUTE_RO_FUNCTION("scene", KX_GameObject, pyattr_get_scene),
     EXP_PYATTRIBUTE_RO_FUNCTION("life", KX_GameObject, pyattr_get_life),
+    EXP_PYATTRIBUTE_RO_FUNCTION("networkId", KX_GameObject, pyattr_get_network_id),
     EXP_PYATTRIBUTE_RW_FUNCTION("mass", KX_GameObject, pyattr_get_mass, pyattr_set_mass),
     EXP_PYATTRIBUTE_RW_FUNCTION(
         "friction", KX_GameObject, pyattr_get_friction, pyattr_set_friction),
@@ -2362,6 +2470,9 @@ PyAttributeDef KX_GameObject::Attributes[] = {
         "physicsCulling", KX_GameObject, pyattr_get_physicsCulling, pyattr_set_physicsCulling),
     EXP_PYATTRIBUTE_RW_FUNCTION(
         "logicCulling", KX_GameObject, pyattr_get_logicCulling, pyattr_set_logicCulling),
+    EXP_PYATTRIBUTE_BOOL_RW("useAnimationLod", KX_GameObject, m_animationLod),
+    EXP_PYATTRIBUTE_FLOAT_RW(
+        "animationLodRadius", 0.0f, FLT_MAX, KX_GameObject, m_animationLodRadius),
 
     EXP_PYATTRIBUTE_RW_FUNCTION(
         "position", KX_GameObject, pyattr_get_worldPosition, pyattr_set_localPosition),
@@ -2478,6 +2589,8 @@ PyObject *KX_GameObject::PyReplaceMesh(PyObject *args, PyObject *kwds)
     return nullptr;
 
   GetScene()->ReplaceMesh(this, new_mesh, (bool)use_gfx, (bool)use_phys);
+  // The meshes differ from the original object, the replica can't be reused.
+  GetScene()->UnpoolReplicaObject(this);
   Py_RETURN_NONE;
 }
 
@@ -2528,7 +2641,11 @@ PyObject *KX_GameObject::PyReinstancePhysicsMesh(PyObject *args, PyObject *kwds)
   /* gameobj and mesh can be nullptr */
   if (GetPhysicsController() &&
       GetPhysicsController()->ReinstancePhysicsShape(gameobj, mesh, dupli, evaluated, collapseFactor))
+  {
+    // The shape differs from the original object, the replica can't be reused.
+    GetScene()->UnpoolReplicaObject(this);
     Py_RETURN_TRUE;
+  }
 
   Py_RETURN_FALSE;
 }
@@ -2551,6 +2668,7 @@ PyObject *KX_GameObject::PyReplacePhysicsShape(PyObject *value)
   }
 
   if (GetPhysicsController()->ReplacePhysicsShape(gameobj->GetPhysicsController())) {
+    GetScene()->UnpoolReplicaObject(this);
     Py_RETURN_TRUE;
   }
   Py_RETURN_FALSE;
@@ -3031,6 +3149,13 @@ PyObject *KX_GameObject::pyattr_get_life(EXP_PyObjectPlus *self_v,
     Py_RETURN_NONE;
 }
 
+PyObject *KX_GameObject::pyattr_get_network_id(EXP_PyObjectPlus *self_v,
+                                               const EXP_PYATTRIBUTE_DEF *attrdef)
+{
+  KX_GameObject *self = static_cast<KX_GameObject *>(self_v);
+  return PyLong_FromUnsignedLong(self->GetNetworkId());
+}
+
 PyObject *KX_GameObject::pyattr_get_mass(EXP_PyObjectPlus *self_v,
                                          const EXP_PYATTRIBUTE_DEF *attrdef)
 {
@@ -4989,6 +5114,32 @@ EXP_PYMETHODDEF_DOC(KX_GameObject,
   Py_RETURN_NONE;
 }
 
+EXP_PYMETHODDEF_DOC(KX_GameObject,
+                    replicateProperty,
+                    "replicateProperty(name, [replicate])\n"
+                    "sends the property to the clients of a server network transport when changed,"
+                    " or applies the values received by a client"
+                    "name = Name of the game property (string)"
+                    "replicate = False to stop replicating the property (bool)")
+{
+  char *name;
+  int replicate = 1;
+
+  if (!PyArg_ParseTuple(args, "s|i:replicateProperty", &name, &replicate)) {
+    return nullptr;
+  }
+
+  const auto it = std::find(m_replicatedProperties.begin(), m_replicatedProperties.end(), name);
+  if (replicate && it == m_replicatedProperties.end()) {
+    m_replicatedProperties.push_back(name);
+  }
+  else if (!replicate && it != m_replicatedProperties.end()) {
+    m_replicatedProperties.erase(it);
+  }
+
+  Py_RETURN_NONE;
+}
+
 static void layer_check(short &layer, const char *method_name)
 {
   if (layer < 0 || layer >= MAX_ACTION_LAYERS) {
@@ -130,6 +130,18 @@ class KX_GameObject : public SCA_IObject {
   // blender::Object activity culling settings converted from blender objects.
   ActivityCullingInfo m_activityCullingInfo;
 
+  /// Use the scene animation level of detail for the actions of this object.
+  bool m_animationLod;
+  /// Radius of the sphere tested against the camera frustums by the animation level of detail.
+  float m_animationLodRadius;
+  /// Frame offset spreading the updates of the objects using the same update rate.
+  unsigned short m_animationLodPhase;
+
+  /// Names of the game properties sent to the remote peers of the network transport.
+  std::vector<std::string> m_replicatedProperties;
+  /// Identifier of the object in the replicated properties, unique in its scene, 0 if none.
+  unsigned int m_networkId;
+
   PHY_IPhysicsController *m_pPhysicsController;
   SG_Node *m_pSGNode;
 
@@ -161,6 +173,14 @@ class KX_GameObject : public SCA_IObject {
   void RestorePhysics(bool childrenRecursive);
   void SuspendLogicAndActions(bool childrenRecursive);
   void RestoreLogicAndActions(bool childrenRecursive);
+  /** Put a replica kept by a replica pool of the scene in a dormant state: run the remove
+   * callbacks, clear python data and actions, hide the object and remove its physics.
+   */
+  void SuspendPooledReplica();
+  /** Wake up a dormant replica of a replica pool, properties, python attributes and
+   * visibility are reset from the original object.
+   */
+  void RestorePooledReplica(KX_GameObject *original);
   void AddDummyLodManager(RAS_MeshObject *meshObj, blender::Object *ob);
   bool IsReplica();
   void ForceIgnoreParentTx();
@@ -348,8 +368,26 @@ class KX_GameObject : public SCA_IObject {
    * \param curtime The current time used to compute the actions frame.
    * \param applyObject Set to true if the actions must transform this object, else it only manages
    * actions' frames.
+   * \param applyPose Set to false to skip the armature pose evaluation of a culled armature.
    */
-  void UpdateActionManager(float curtime, bool applyObject);
+  void UpdateActionManager(float curtime, bool applyObject, bool applyPose);
+
+  bool GetAnimationLod() const
+  {
+    return m_animationLod;
+  }
+  float GetAnimationLodRadius() const
+  {
+    return m_animationLodRadius;
+  }
+  unsigned short GetAnimationLodPhase() const
+  {
+    return m_animationLodPhase;
+  }
+  void SetAnimationLodPhase(unsigned short phase)
+  {
+    m_animationLodPhase = phase;
+  }
 
   /*********************************
    * End Animation API
@@ -495,6 +533,23 @@ class KX_GameObject : public SCA_IObject {
   const MT_Vector3 &NodeGetWorldPosition() const;
   MT_Transform NodeGetWorldTransform() const;
 
+  virtual bool GetNetworkPosition(float r_position[3]) const override;
+
+  const std::vector<std::string> &GetReplicatedProperties() const
+  {
+    return m_replicatedProperties;
+  }
+  bool IsReplicatedProperty(const std::string &name) const;
+
+  unsigned int GetNetworkId() const
+  {
+    return m_networkId;
+  }
+  void SetNetworkId(unsigned int id)
+  {
+    m_networkId = id;
+  }
+
   const MT_Matrix3x3 &NodeGetLocalOrientation() const;
   const MT_Vector3 &NodeGetLocalScaling() const;
   const MT_Vector3 &NodeGetLocalPosition() const;
@@ -668,10 +723,23 @@ class KX_GameObject : public SCA_IObject {
   /// Get current lod manager.
   KX_LodManager *GetLodManager() const;
 
-  /**
-   * Updates the current lod level based on distance from camera.
+  short GetCurrentLodLevel() const
+  {
+    return m_currentLodLevel;
+  }
+
+  /** Return true if UpdateLod must be called even if the selected level is unchanged: the
+   * previous level change is not fully applied, or the level replaces the evaluated mesh of the
+   * object which is lost when the depsgraph evaluates the object again.
+   * \param depsgraphUpdated True if the depsgraph was evaluated since the last lod update.
    */
-  void UpdateLod(const MT_Vector3 &cam_pos, float lodfactor);
+  bool IsLodUpdateNeeded(bool depsgraphUpdated) const;
+
+  /** Apply a lod level selected by KX_Scene::UpdateObjectLods.
+   * \param level The level index selected by the lod manager.
+   * \param depsgraph The evaluated depsgraph holding the rendered object.
+   */
+  void UpdateLod(short level, blender::Depsgraph *depsgraph);
 
   /** Update the activity culling of the object.
    * \param distance Squared nearest distance to the cameras of this object.
@@ -840,6 +908,7 @@ class KX_GameObject : public SCA_IObject {
   EXP_PYMETHOD(KX_GameObject, ReinstancePhysicsMesh);
   EXP_PYMETHOD_O(KX_GameObject, ReplacePhysicsShape);
   EXP_PYMETHOD_DOC(KX_GameObject, addDebugProperty);
+  EXP_PYMETHOD_DOC(KX_GameObject, replicateProperty);
 
   EXP_PYMETHOD_DOC(KX_GameObject, playAction);
   EXP_PYMETHOD_DOC(KX_GameObject, stopAction);
@@ -865,6 +934,8 @@ class KX_GameObject : public SCA_IObject {
   static PyObject *pyattr_get_scene(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
 
   static PyObject *pyattr_get_life(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
+  static PyObject *pyattr_get_network_id(EXP_PyObjectPlus *self_v,
+                                         const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_mass(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
   static int pyattr_set_mass(EXP_PyObjectPlus *self_v,
                              const EXP_PYATTRIBUTE_DEF *attrdef,
@@ -36,13 +36,18 @@
 
 #include "KX_KetsjiEngine.h"
 
+#include <chrono>
+#include <thread>
+
 #include <fmt/format.h>
 
 #include "BLI_rect.hh"
+#include "BLI_task.hh"
 #include "DNA_scene_types.h"
 #include "../draw/intern/draw_command.hh"
 #include "GPU_immediate.hh"
 #include "GPU_viewport.hh"
+#include "PRF_profile.hh"
 #include "WM_api.hh"
 
 #include "BL_Converter.h"
@@ -59,6 +64,11 @@
 
 using namespace blender;
 
+#ifdef WITH_TRACY
+/// Name of the profiler frames spanning a logic tick, a rendered frame can run several ticks.
+static const std::string logic_tick_frame_name = "Logic tick";
+#endif
+
 #define DEFAULT_LOGIC_TIC_RATE 60.0
 
 #ifdef FREE_WINDOWS /* XXX mingw64 (gcc 4.7.0) defines a macro for DrawText that translates to \
@@ -144,6 +154,7 @@ KX_KetsjiEngine::KX_KetsjiEngine(KX_ISystem *system,
       m_firstEngineFrame(true),
       m_maxLogicFrame(5),
       m_maxPhysicsFrame(5),
+      m_physicsShapeCache(ShapeCacheNone),
       m_ticrate(DEFAULT_LOGIC_TIC_RATE),
       m_anim_framerate(25.0),
       m_doRender(true),
@@ -165,6 +176,7 @@ KX_KetsjiEngine::KX_KetsjiEngine(KX_ISystem *system,
 
 #ifdef WITH_PYTHON
   m_pyprofiledict = PyDict_New();
+  m_pysceneprofiledict = PyDict_New();
 #endif
 
   m_scenes = new EXP_ListValue<KX_Scene>();
@@ -178,6 +190,7 @@ KX_KetsjiEngine::~KX_KetsjiEngine()
 {
 #ifdef WITH_PYTHON
   Py_CLEAR(m_pyprofiledict);
+  Py_CLEAR(m_pysceneprofiledict);
 #endif
 
   m_scenes->Release();
@@ -248,6 +261,12 @@ PyObject *KX_KetsjiEngine::GetPyProfileDict()
   Py_INCREF(m_pyprofiledict);
   return m_pyprofiledict;
 }
+
+PyObject *KX_KetsjiEngine::GetPySceneProfileDict()
+{
+  Py_INCREF(m_pysceneprofiledict);
+  return m_pysceneprofiledict;
+}
 #endif
 
 void KX_KetsjiEngine::SetConverter(BL_Converter *converter)
@@ -271,16 +290,8 @@ void KX_KetsjiEngine::BeginFrame()
   m_canvas->BeginDraw();
 }
 
-void KX_KetsjiEngine::EndFrame()
+void KX_KetsjiEngine::UpdateFrameStats()
 {
-  // Show profiling info
-  m_logger.StartLog(tc_overhead);
-  if (m_flags & (SHOW_PROFILE | SHOW_FRAMERATE | SHOW_DEBUG_PROPERTIES)) {
-    RenderDebugProperties();
-  }
-
-  m_rasterizer->FlushDebugDraw(m_canvas);
-
   double tottime = m_logger.GetAverage();
   if (tottime < 1e-6)
     tottime = 1e-6;
@@ -299,8 +310,34 @@ void KX_KetsjiEngine::EndFrame()
 
   m_average_framerate = 1.0 / tottime;
 
+  UpdateSceneProfiles(tottime);
+
   // Go to next profiling measurement, time spent after this call is shown in the next frame.
   m_logger.NextMeasurement();
+}
+
+void KX_KetsjiEngine::EndFrameHeadless()
+{
+  PRF_scope(ProfileCategory::GameEngine);
+  UpdateScenesAnimations();
+
+  m_logger.StartLog(tc_overhead);
+  UpdateFrameStats();
+
+  PRF_frame_mark;
+}
+
+void KX_KetsjiEngine::EndFrame()
+{
+  // Show profiling info
+  m_logger.StartLog(tc_overhead);
+  if (m_flags & (SHOW_PROFILE | SHOW_FRAMERATE | SHOW_DEBUG_PROPERTIES)) {
+    RenderDebugProperties();
+  }
+
+  m_rasterizer->FlushDebugDraw(m_canvas);
+
+  UpdateFrameStats();
 
   m_logger.StartLog(tc_rasterizer);
   m_rasterizer->EndFrame();
@@ -326,26 +363,7 @@ void KX_KetsjiEngine::EndFrameViewportRender()
 
   m_rasterizer->FlushDebugDraw(m_canvas);
 
-  double tottime = m_logger.GetAverage();
-  if (tottime < 1e-6)
-    tottime = 1e-6;
-
-#ifdef WITH_PYTHON
-  for (int i = tc_first; i < tc_numCategories; ++i) {
-    double time = m_logger.GetAverage((KX_TimeCategory)i);
-    PyObject *val = PyTuple_New(2);
-    PyTuple_SetItem(val, 0, PyFloat_FromDouble(time * 1000.0));
-    PyTuple_SetItem(val, 1, PyFloat_FromDouble(time / tottime * 100.0));
-
-    PyDict_SetItemString(m_pyprofiledict, m_profileLabels[i].c_str(), val);
-    Py_DECREF(val);
-  }
-#endif
-
-  m_average_framerate = 1.0 / tottime;
-
-  // Go to next profiling measurement, time spent after this call is shown in the next frame.
-  m_logger.NextMeasurement();
+  UpdateFrameStats();
 
   m_logger.StartLog(tc_rasterizer);
   // m_rasterizer->EndFrame();
@@ -361,6 +379,64 @@ void KX_KetsjiEngine::EndFrameViewportRender()
   m_canvas->EndDraw();
 }
 
+KX_TimeCategoryLogger &KX_KetsjiEngine::GetSceneLogger(KX_Scene *scene)
+{
+  std::map<KX_Scene *, KX_TimeCategoryLogger>::iterator it = m_sceneLoggers.find(scene);
+  if (it != m_sceneLoggers.end()) {
+    return it->second;
+  }
+
+  KX_TimeCategoryLogger &logger = m_sceneLoggers
+                                      .emplace(scene,
+                                               KX_TimeCategoryLogger(
+                                                   m_clock, m_logger.GetMaxNumMeasurements()))
+                                      .first->second;
+  logger.AddCategory(tc_physics);
+  logger.AddCategory(tc_logic);
+  logger.AddCategory(tc_scenegraph);
+
+  return logger;
+}
+
+void KX_KetsjiEngine::UpdateSceneProfiles(double tottime)
+{
+#ifdef WITH_PYTHON
+  PyDict_Clear(m_pysceneprofiledict);
+#endif
+
+  if (!(m_flags & SCENE_PROFILE)) {
+    // Keep the averages up to date without building the python dictionaries.
+    for (std::map<KX_Scene *, KX_TimeCategoryLogger>::value_type &pair : m_sceneLoggers) {
+      pair.second.NextMeasurement();
+    }
+    return;
+  }
+
+  for (KX_Scene *scene : m_scenes) {
+    KX_TimeCategoryLogger &logger = GetSceneLogger(scene);
+
+#ifdef WITH_PYTHON
+    static const KX_TimeCategory categories[] = {tc_physics, tc_logic, tc_scenegraph};
+
+    PyObject *scenedict = PyDict_New();
+    for (KX_TimeCategory tc : categories) {
+      const double time = logger.GetAverage(tc);
+      PyObject *val = PyTuple_New(2);
+      PyTuple_SetItem(val, 0, PyFloat_FromDouble(time * 1000.0));
+      PyTuple_SetItem(val, 1, PyFloat_FromDouble(time / tottime * 100.0));
+
+      PyDict_SetItemString(scenedict, m_profileLabels[tc].c_str(), val);
+      Py_DECREF(val);
+    }
+
+    PyDict_SetItemString(m_pysceneprofiledict, scene->GetName().c_str(), scenedict);
+    Py_DECREF(scenedict);
+#endif
+
+    logger.NextMeasurement();
+  }
+}
+
 KX_KetsjiEngine::FrameTimes KX_KetsjiEngine::GetFrameTimes()
 {
   /*
@@ -446,6 +522,16 @@ KX_KetsjiEngine::FrameTimes KX_KetsjiEngine::GetFrameTimes()
   if (frames > 0) {
     m_previousRealTime = m_clockTime;
   }
+  /* Else in case of headless fixed framerate, nothing waits for the vsync: sleep until the next
+   * frame instead of spinning in the main loop. */
+  else if ((m_flags & HEADLESS) && (m_flags & FIXED_FRAMERATE) &&
+           !(m_flags & USE_EXTERNAL_CLOCK)) {
+    const double sleeptime = timestep - dt - 1.0e-3;
+    // If the remaining time is greater than 1ms (sleep resolution) sleep this thread.
+    if (sleeptime > 0.0) {
+      std::this_thread::sleep_for(std::chrono::nanoseconds((long)(sleeptime * 1.0e9)));
+    }
+  }
   //// Else in case of fixed framerate, try to sleep until the next frame.
   // else if (m_flags & FIXED_FRAMERATE) {
   //  const double sleeptime = timestep - dt - 1.0e-3;
@@ -470,6 +556,7 @@ KX_KetsjiEngine::FrameTimes KX_KetsjiEngine::GetFrameTimes()
 
 bool KX_KetsjiEngine::NextFrame()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   m_logger.StartLog(tc_services);
 
   const FrameTimes times = GetFrameTimes();
@@ -482,11 +569,14 @@ bool KX_KetsjiEngine::NextFrame()
     return false;
   }
 
+  /* Merge the finished asynchronous loads once per frame, the merge budget is per frame and
+   * must not be spent again for every logic tick of a late frame. */
+  m_converter->MergeAsyncLoads();
+
   for (unsigned short i = 0; i < times.frames; ++i) {
+    PRF_frame_mark_start(logic_tick_frame_name);
     m_frameTime += times.framestep;
 
-    m_converter->MergeAsyncLoads();
-
     m_inputDevice->ReleaseMoveEvent();
 
 #ifdef WITH_SDL
@@ -507,78 +597,288 @@ bool KX_KetsjiEngine::NextFrame()
     }
 #endif  // WITH_SDL
 
-    // for each scene, call the proceed functions
-    for (KX_Scene *scene : m_scenes) {
-      /* Suspension holds the physics and logic processing for an
-       * entire scene. Objects can be suspended individually, and
-       * the settings for that precede the logic and physics
-       * update. */
-      m_logger.StartLog(tc_logic);
-
-      if (i == 0) {  // No need to UpdateObjectActivity several times
-        scene->UpdateObjectActivity();
+    if ((m_flags & PARALLEL_SCENES) && m_scenes->GetCount() > 1) {
+      NextScenesFrameParallel(times, i);
+    }
+    else {
+      // for each scene, call the proceed functions
+      for (KX_Scene *scene : m_scenes) {
+        NextSceneFrame(scene, times, i);
       }
+    }
+
+    m_logger.StartLog(tc_network);
+    // Exchange the messages and replicated properties with the remote game engines, if any.
+    for (KX_Scene *scene : m_scenes) {
+      scene->ReplicateNetworkProperties();
+    }
+    m_networkMessageManager->ExchangeMessages();
+    for (KX_Scene *scene : m_scenes) {
+      scene->ApplyNetworkProperties();
+    }
+    m_networkMessageManager->ClearMessages();
+
+    // update system devices
+    m_logger.StartLog(tc_logic);
+    m_inputDevice->ClearInputs();
+
+    // scene management
+    ProcessScheduledScenes();
+    PRF_frame_mark_end(logic_tick_frame_name);
+  }
+
+  // Nothing is rendered in headless mode, the animations and the frame end are proceeded here.
+  if (m_flags & HEADLESS) {
+    EndFrameHeadless();
+  }
+
+  // Start logging time spent outside main loop
+  m_logger.StartLog(tc_outside);
+
+  return m_doRender && !(m_flags & HEADLESS);
+}
+
+void KX_KetsjiEngine::NextSceneFrame(KX_Scene *scene,
+                                     const FrameTimes &times,
+                                     unsigned short frame)
+{
+  PRF_scope(ProfileCategory::GameEngine);
+  PRF_scope_add_text("%s", scene->GetName().c_str());
+
+  KX_TimeCategoryLogger &sceneLogger = GetSceneLogger(scene);
 
-      m_logger.StartLog(tc_physics);
+  /* Suspension holds the physics and logic processing for an
+   * entire scene. Objects can be suspended individually, and
+   * the settings for that precede the logic and physics
+   * update. */
+  m_logger.StartLog(tc_logic);
+  sceneLogger.StartLog(tc_logic);
 
-      // set Python hooks for each scene
-      KX_SetActiveScene(scene);
+  if (frame == 0) {  // No need to UpdateObjectActivity several times
+    scene->UpdateObjectActivity();
+  }
 
-      // Process sensors, and controllers
-      m_logger.StartLog(tc_logic);
-      scene->LogicBeginFrame(m_frameTime, times.framestep);
+  m_logger.StartLog(tc_physics);
+  sceneLogger.StartLog(tc_physics);
 
-      // Scenegraph needs to be updated again, because Logic Controllers
-      // can affect the local matrices.
-      m_logger.StartLog(tc_scenegraph);
-      scene->UpdateParents(m_frameTime);
+  // set Python hooks for each scene
+  KX_SetActiveScene(scene);
 
-      // Process actuators
+  // Process sensors, and controllers
+  m_logger.StartLog(tc_logic);
+  sceneLogger.StartLog(tc_logic);
+  scene->LogicBeginFrame(m_frameTime, times.framestep);
 
-      // Do some cleanup work for this logic frame
-      m_logger.StartLog(tc_logic);
-      scene->LogicUpdateFrame(m_frameTime);
+  // Scenegraph needs to be updated again, because Logic Controllers
+  // can affect the local matrices.
+  m_logger.StartLog(tc_scenegraph);
+  sceneLogger.StartLog(tc_scenegraph);
+  scene->UpdateParents(m_frameTime);
+
+  // Process actuators
+
+  // Do some cleanup work for this logic frame
+  m_logger.StartLog(tc_logic);
+  sceneLogger.StartLog(tc_logic);
+  scene->LogicUpdateFrame(m_frameTime);
 
-      scene->LogicEndFrame();
+  scene->LogicEndFrame();
 
-      // Actuators can affect the scenegraph
-      m_logger.StartLog(tc_scenegraph);
-      scene->UpdateParents(m_frameTime);
+  // Actuators can affect the scenegraph
+  m_logger.StartLog(tc_scenegraph);
+  sceneLogger.StartLog(tc_scenegraph);
+  scene->UpdateParents(m_frameTime);
 
-      m_logger.StartLog(tc_physics);
+  m_logger.StartLog(tc_physics);
+  sceneLogger.StartLog(tc_physics);
 
-      // Perform physics calculations on the scene. This can involve
-      // many iterations of the physics solver.
-      scene->GetPhysicsEnvironment()->ProceedDeltaTime(
-          m_frameTime, times.timestep, times.framestep);  // m_deltatimerealDeltaTime);
+  // Perform physics calculations on the scene. This can involve
+  // many iterations of the physics solver.
+  scene->GetPhysicsEnvironment()->ProceedDeltaTime(
+      m_frameTime, times.timestep, times.framestep);  // m_deltatimerealDeltaTime);
 
-      /* No need to call sofbody update more than 1 time */
-      if (i == times.frames - 1) {
-        /// Update SoftBodies rendered mesh from bullet softbody simulation.
-        scene->GetPhysicsEnvironment()->UpdateSoftBodiesRenderedMesh();
+  /* No need to call sofbody update more than 1 time */
+  if (frame == times.frames - 1) {
+    /// Update SoftBodies rendered mesh from bullet softbody simulation.
+    scene->GetPhysicsEnvironment()->UpdateSoftBodiesRenderedMesh();
+  }
+
+  m_logger.StartLog(tc_scenegraph);
+  sceneLogger.StartLog(tc_scenegraph);
+  scene->UpdateParents(m_frameTime);
+
+  sceneLogger.EndLog();
+  m_logger.StartLog(tc_services);
+}
+
+std::vector<std::vector<KX_Scene *>> KX_KetsjiEngine::GetIndependentSceneGroups()
+{
+  std::vector<std::vector<KX_Scene *>> groups;
+
+  for (KX_Scene *scene : m_scenes) {
+    PHY_IPhysicsEnvironment *physEnv = scene->GetPhysicsEnvironment();
+    std::vector<KX_Scene *> group = {scene};
+
+    // Merge all the groups containing a scene depending on the current scene.
+    for (std::vector<std::vector<KX_Scene *>>::iterator it = groups.begin(); it != groups.end();) {
+      const bool dependent = std::any_of(
+          it->begin(), it->end(), [scene, physEnv](KX_Scene *other) {
+            // Scenes converted from the same blender scene share the blender objects.
+            return (scene->GetBlenderScene() == other->GetBlenderScene() ||
+                    !physEnv->IsParallelStepCompatible(other->GetPhysicsEnvironment()));
+          });
+
+      if (dependent) {
+        group.insert(group.begin(), it->begin(), it->end());
+        it = groups.erase(it);
+      }
+      else {
+        ++it;
       }
+    }
+
+    groups.push_back(group);
+  }
 
-      m_logger.StartLog(tc_scenegraph);
-      scene->UpdateParents(m_frameTime);
+  // Keep the scenes order inside the groups to step them as in serial mode.
+  std::vector<KX_Scene *> order;
+  for (KX_Scene *scene : m_scenes) {
+    order.push_back(scene);
+  }
+  for (std::vector<KX_Scene *> &group : groups) {
+    std::sort(group.begin(), group.end(), [&order](KX_Scene *sceneA, KX_Scene *sceneB) {
+      return std::find(order.begin(), order.end(), sceneA) <
+             std::find(order.begin(), order.end(), sceneB);
+    });
+  }
+
+  return groups;
+}
+
+/// Task data used to update a group of independent scenes in a thread.
+struct SceneGroupTaskData {
+  std::vector<KX_Scene *> *scenes;
+  std::vector<KX_TimeCategoryLogger *> loggers;
+  double frameTime;
+  double timestep;
+  double framestep;
+  bool updateSoftBodies;
+};
+
+static void scene_group_physics_task_func(blender::TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  SceneGroupTaskData *task = static_cast<SceneGroupTaskData *>(taskdata);
+
+  for (unsigned short i = 0, size = task->scenes->size(); i < size; ++i) {
+    KX_Scene *scene = (*task->scenes)[i];
+    KX_TimeCategoryLogger *logger = task->loggers[i];
 
-      m_logger.StartLog(tc_services);
+    // Actuators can affect the scenegraph
+    logger->StartLog(KX_KetsjiEngine::tc_scenegraph);
+    scene->UpdateParents(task->frameTime);
+
+    logger->StartLog(KX_KetsjiEngine::tc_physics);
+    scene->GetPhysicsEnvironment()->ProceedDeltaTime(
+        task->frameTime, task->timestep, task->framestep);
+
+    if (task->updateSoftBodies) {
+      scene->GetPhysicsEnvironment()->UpdateSoftBodiesRenderedMesh();
     }
 
-    m_logger.StartLog(tc_network);
-    m_networkMessageManager->ClearMessages();
+    logger->StartLog(KX_KetsjiEngine::tc_scenegraph);
+    scene->UpdateParents(task->frameTime);
+
+    logger->EndLog();
+  }
+}
+
+static void scene_group_scenegraph_task_func(blender::TaskPool *__restrict /*pool*/,
+                                             void *taskdata)
+{
+  SceneGroupTaskData *task = static_cast<SceneGroupTaskData *>(taskdata);
+
+  for (unsigned short i = 0, size = task->scenes->size(); i < size; ++i) {
+    KX_TimeCategoryLogger *logger = task->loggers[i];
+
+    logger->StartLog(KX_KetsjiEngine::tc_scenegraph);
+    (*task->scenes)[i]->UpdateParents(task->frameTime);
+    logger->EndLog();
+  }
+}
+
+void KX_KetsjiEngine::NextScenesFrameParallel(const FrameTimes &times, unsigned short frame)
+{
+  std::vector<std::vector<KX_Scene *>> groups = GetIndependentSceneGroups();
+
+  /* The loggers are created in the main thread, the threads only access
+   * to the logger of their own scenes. */
+  std::vector<SceneGroupTaskData> tasks(groups.size());
+  for (unsigned short i = 0, size = groups.size(); i < size; ++i) {
+    SceneGroupTaskData &task = tasks[i];
+    task.scenes = &groups[i];
+    for (KX_Scene *scene : groups[i]) {
+      task.loggers.push_back(&GetSceneLogger(scene));
+    }
+    task.frameTime = m_frameTime;
+    task.timestep = times.timestep;
+    task.framestep = times.framestep;
+    /* No need to call sofbody update more than 1 time */
+    task.updateSoftBodies = (frame == times.frames - 1);
+  }
+
+  // Process sensors and controllers, Python can access all the scenes, it's kept serial.
+  for (KX_Scene *scene : m_scenes) {
+    KX_TimeCategoryLogger &sceneLogger = GetSceneLogger(scene);
 
-    // update system devices
     m_logger.StartLog(tc_logic);
-    m_inputDevice->ClearInputs();
+    sceneLogger.StartLog(tc_logic);
 
-    // scene management
-    ProcessScheduledScenes();
+    if (frame == 0) {  // No need to UpdateObjectActivity several times
+      scene->UpdateObjectActivity();
+    }
+
+    KX_SetActiveScene(scene);
+    scene->LogicBeginFrame(m_frameTime, times.framestep);
+    sceneLogger.EndLog();
   }
 
-  // Start logging time spent outside main loop
-  m_logger.StartLog(tc_outside);
+  /* Scenegraph needs to be updated again, because Logic Controllers
+   * can affect the local matrices. */
+  m_logger.StartLog(tc_scenegraph);
+  blender::TaskPool *taskpool = BLI_task_pool_create(nullptr, TASK_PRIORITY_HIGH);
+  for (SceneGroupTaskData &task : tasks) {
+    BLI_task_pool_push(taskpool, scene_group_scenegraph_task_func, &task, false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(taskpool);
 
-  return m_doRender;
+  // Process actuators and do some cleanup work for this logic frame.
+  for (KX_Scene *scene : m_scenes) {
+    KX_TimeCategoryLogger &sceneLogger = GetSceneLogger(scene);
+
+    m_logger.StartLog(tc_logic);
+    sceneLogger.StartLog(tc_logic);
+
+    KX_SetActiveScene(scene);
+    scene->LogicUpdateFrame(m_frameTime);
+    scene->LogicEndFrame();
+    sceneLogger.EndLog();
+  }
+
+  /* Perform physics calculations on the independent scenes at the same time,
+   * the scene graph is updated before and after as in serial mode. */
+  m_logger.StartLog(tc_physics);
+  /* Scenes of different groups have the same global physics settings, set them
+   * from the main thread so that the threads never write them. */
+  for (std::vector<KX_Scene *> &group : groups) {
+    group.front()->GetPhysicsEnvironment()->ApplyGlobalSettings();
+  }
+  for (SceneGroupTaskData &task : tasks) {
+    BLI_task_pool_push(taskpool, scene_group_physics_task_func, &task, false, nullptr);
+  }
+  BLI_task_pool_work_and_wait(taskpool);
+  BLI_task_pool_free(taskpool);
+
+  m_logger.StartLog(tc_services);
 }
 
 KX_KetsjiEngine::CameraRenderData KX_KetsjiEngine::GetCameraRenderData(
@@ -761,6 +1061,7 @@ bool KX_KetsjiEngine::GetFrameRenderData(std::vector<FrameRenderData> &frameData
 
 void KX_KetsjiEngine::Render()
 {
+  PRF_scope(ProfileCategory::GameEngine);
   m_logger.StartLog(tc_rasterizer);
 
   BeginFrame();
@@ -777,10 +1078,7 @@ void KX_KetsjiEngine::Render()
    * This avoids a race where GetFrameRenderData computes projection
    * using stale camera data and later animation updates change the
    * lens, causing flickering depending on actuator execution order. */
-  m_logger.StartLog(tc_animations);
-  for (KX_Scene *scene : m_scenes) {
-    UpdateAnimations(scene);
-  }
+  UpdateScenesAnimations();
   m_logger.StartLog(tc_rasterizer);
 
   GetFrameRenderData(frameDataList);
@@ -863,6 +1161,8 @@ void KX_KetsjiEngine::Render()
   else {
     EndFrameViewportRender();
   }
+
+  PRF_frame_mark;
 }
 
 void KX_KetsjiEngine::RequestExit(KX_ExitRequest exitrequestmode)
@@ -967,6 +1267,14 @@ void KX_KetsjiEngine::GetSceneViewport(KX_Scene *scene,
   }
 }
 
+void KX_KetsjiEngine::UpdateScenesAnimations()
+{
+  m_logger.StartLog(tc_animations);
+  for (KX_Scene *scene : m_scenes) {
+    UpdateAnimations(scene);
+  }
+}
+
 void KX_KetsjiEngine::UpdateAnimations(KX_Scene *scene)
 {
   // Handle the animations independently of the logic time step
@@ -1148,6 +1456,7 @@ void KX_KetsjiEngine::StopEngine()
       // WARNING: here the scene is a dangling pointer.
       m_scenes->Remove(0);
     }
+    m_sceneLoggers.clear();
 
     // cleanup all the stuff
     m_rasterizer->Exit();
@@ -1305,6 +1614,34 @@ void KX_KetsjiEngine::RenderDebugProperties()
           MT_Vector2(xcoord + (int)(2.2 * profile_indent), ycoord), boxSize, white);
       ycoord += const_ysize;
     }
+
+    // Collisions reported by the physics of all the scenes during the last tick.
+    unsigned int numCollisions = 0;
+    for (KX_Scene *scene : m_scenes) {
+      numCollisions += scene->GetPhysicsEnvironment()->GetNumCollisions();
+    }
+    debugDraw.RenderText2D("Collisions:", MT_Vector2(xcoord + const_xindent, ycoord), white);
+    debugtxt = fmt::format("{:>5}", numCollisions);
+    debugDraw.RenderText2D(
+        debugtxt, MT_Vector2(xcoord + const_xindent + profile_indent, ycoord), white);
+    ycoord += const_ysize;
+
+    // Actions evaluated, culled and skipped by the animation level of detail.
+    KX_Scene::AnimationStats animStats = {0, 0, 0};
+    for (KX_Scene *scene : m_scenes) {
+      const KX_Scene::AnimationStats &stats = scene->GetAnimationStats();
+      animStats.m_evaluated += stats.m_evaluated;
+      animStats.m_culled += stats.m_culled;
+      animStats.m_skipped += stats.m_skipped;
+    }
+    debugDraw.RenderText2D("Actions:", MT_Vector2(xcoord + const_xindent, ycoord), white);
+    debugtxt = fmt::format("{:>5} | {} culled | {} skipped",
+                           animStats.m_evaluated,
+                           animStats.m_culled,
+                           animStats.m_skipped);
+    debugDraw.RenderText2D(
+        debugtxt, MT_Vector2(xcoord + const_xindent + profile_indent, ycoord), white);
+    ycoord += const_ysize;
   }
   // Add the ymargin for titles below the other section of debug info
   ycoord += title_y_top_margin;
@@ -1401,6 +1738,7 @@ void KX_KetsjiEngine::RemoveScheduledScenes()
 
       KX_Scene *scene = FindScene(scenename);
       if (scene) {
+        m_sceneLoggers.erase(scene);
         m_converter->RemoveScene(scene);
         m_scenes->RemoveValue(scene);
       }
@@ -1464,6 +1802,7 @@ void KX_KetsjiEngine::ReplaceScheduledScenes()
           // avoid crash if the new scene doesn't exist, just do nothing
           blender::Scene *blScene = m_converter->GetBlenderSceneForName(newscenename);
           if (blScene) {
+            m_sceneLoggers.erase(scene);
             m_converter->RemoveScene(scene);
 
             KX_Scene *tmpscene = CreateScene(blScene, false);
@@ -1521,6 +1860,16 @@ void KX_KetsjiEngine::SetMaxPhysicsFrame(int frame)
   m_maxPhysicsFrame = frame;
 }
 
+e_PhysicsShapeCache KX_KetsjiEngine::GetPhysicsShapeCache() const
+{
+  return m_physicsShapeCache;
+}
+
+void KX_KetsjiEngine::SetPhysicsShapeCache(e_PhysicsShapeCache cache)
+{
+  m_physicsShapeCache = cache;
+}
+
 double KX_KetsjiEngine::GetAnimFrameRate()
 {
   return m_anim_framerate;
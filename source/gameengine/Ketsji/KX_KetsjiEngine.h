@@ -32,12 +32,14 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "CM_Clock.h"
 #include "EXP_Python.h"
 #include "KX_ISystem.h"
+#include "KX_PhysicsEngineEnums.h"
 #include "KX_Scene.h"
 #include "KX_TimeCategoryLogger.h"
 #include "MT_Matrix4x4.h"
@@ -90,9 +92,32 @@ class KX_KetsjiEngine {
     /// Automatic add debug properties to the debug list.
     AUTO_ADD_DEBUG_PROPERTIES = (1 << 6),
     /// Use override camera?
-    CAMERA_OVERRIDE = (1 << 7)
+    CAMERA_OVERRIDE = (1 << 7),
+    /// Step physics and scene graph of independent scenes in parallel?
+    PARALLEL_SCENES = (1 << 8),
+    /// Run without window nor GPU context, the frames are never rendered.
+    HEADLESS = (1 << 9),
+    /// Expose the per scene profiling to python?
+    SCENE_PROFILE = (1 << 10)
   };
 
+  /// Categories for profiling display.
+  typedef enum {
+    tc_first = 0,
+    tc_physics = 0,
+    tc_logic,
+    tc_animations,
+    tc_depsgraph,
+    tc_network,
+    tc_scenegraph,
+    tc_rasterizer,
+    tc_services,  // time spent in miscelaneous activities
+    tc_overhead,  // profile info drawing overhead
+    tc_outside,   // time spent outside main loop
+    tc_latency,   // time spent waiting on the gpu
+    tc_numCategories
+  } KX_TimeCategory;
+
  private:
   struct CameraRenderData {
     CameraRenderData(KX_Camera *rendercam,
@@ -188,6 +213,8 @@ class KX_KetsjiEngine {
   int m_maxLogicFrame;
   /// maximum number of consecutive physics frame
   int m_maxPhysicsFrame;
+  /// location of the triangle mesh shapes cached between runs
+  e_PhysicsShapeCache m_physicsShapeCache;
   double m_ticrate;
   /// for animation playback only - ipo and action
   double m_anim_framerate;
@@ -209,30 +236,19 @@ class KX_KetsjiEngine {
   /// Default camera zoom.
   float m_overrideCamZoom;
 
-  /// Categories for profiling display.
-  typedef enum {
-    tc_first = 0,
-    tc_physics = 0,
-    tc_logic,
-    tc_animations,
-    tc_depsgraph,
-    tc_network,
-    tc_scenegraph,
-    tc_rasterizer,
-    tc_services,  // time spent in miscelaneous activities
-    tc_overhead,  // profile info drawing overhead
-    tc_outside,   // time spent outside main loop
-    tc_latency,   // time spent waiting on the gpu
-    tc_numCategories
-  } KX_TimeCategory;
-
   /// Time logger.
   KX_TimeCategoryLogger m_logger;
+  /// Time logger per scene, only logic, physics and scenegraph categories are used.
+  std::map<KX_Scene *, KX_TimeCategoryLogger> m_sceneLoggers;
 
   /// Labels for profiling display.
   static const std::string m_profileLabels[tc_numCategories];
   /// Last estimated framerate
   double m_average_framerate;
+#ifdef WITH_PYTHON
+  /// Per scene profiling informations.
+  PyObject *m_pysceneprofiledict;
+#endif
 
   /// Enable debug draw of culling bounding boxes.
   KX_DebugOption m_showBoundingBox;
@@ -289,6 +305,28 @@ class KX_KetsjiEngine {
   void BeginFrame();
   FrameTimes GetFrameTimes();
 
+  /// Return the time logger of a scene, created if it doesn't exist.
+  KX_TimeCategoryLogger &GetSceneLogger(KX_Scene *scene);
+  /// Update the per scene profiling informations and go to next measurement.
+  void UpdateSceneProfiles(double tottime);
+  /// Update the framerate and profiling informations and go to next measurement.
+  void UpdateFrameStats();
+  /// Update the animations of all the scenes.
+  void UpdateScenesAnimations();
+  /// End a frame without rendering in headless mode, animations are still updated.
+  void EndFrameHeadless();
+
+  /// Proceed logic, physics and scenegraph of a scene for one logic frame.
+  void NextSceneFrame(KX_Scene *scene, const FrameTimes &times, unsigned short frame);
+  /** Split the scenes in groups that don't share any objects or physics settings.
+   * The scenes of a group are always stepped serially, the groups can be stepped in parallel.
+   */
+  std::vector<std::vector<KX_Scene *>> GetIndependentSceneGroups();
+  /** Proceed logic serially and physics and scenegraph in parallel for all the scenes for one
+   * logic frame.
+   */
+  void NextScenesFrameParallel(const FrameTimes &times, unsigned short frame);
+
  public:
   KX_KetsjiEngine(KX_ISystem *system,
                   blender::bContext *C,
@@ -320,6 +358,7 @@ class KX_KetsjiEngine {
   void SetNetworkMessageManager(KX_NetworkMessageManager *manager);
 #ifdef WITH_PYTHON
   PyObject *GetPyProfileDict();
+  PyObject *GetPySceneProfileDict();
 #endif
   void SetConverter(BL_Converter *converter);
   BL_Converter *GetConverter()
@@ -434,6 +473,12 @@ class KX_KetsjiEngine {
    */
   void SetMaxPhysicsFrame(int frame);
 
+  e_PhysicsShapeCache GetPhysicsShapeCache() const;
+  /**
+   * Sets where the built triangle mesh shapes are cached between runs
+   */
+  void SetPhysicsShapeCache(e_PhysicsShapeCache cache);
+
   /**
    * Gets the framerate for playing animations. (actions and ipos)
    */
@@ -40,6 +40,8 @@ KX_LibLoadStatus::KX_LibLoadStatus(class BL_Converter *kx_converter,
       m_data(nullptr),
       m_libname(path),
       m_progress(0.0f),
+      m_conversionProgress(0.0f),
+      m_mergeProgress(0.0f),
       m_finished(false)
 #ifdef WITH_PYTHON
       ,
@@ -54,6 +56,8 @@ void KX_LibLoadStatus::Finish()
 {
   m_finished = true;
   m_progress = 1.f;
+  m_conversionProgress = 1.0f;
+  m_mergeProgress = 1.0f;
   m_endtime = BLI_time_now_seconds();
 
   RunFinishCallback();
@@ -139,6 +143,28 @@ void KX_LibLoadStatus::AddProgress(float progress)
   RunProgressCallback();
 }
 
+void KX_LibLoadStatus::AddConversionProgress(float progress)
+{
+  m_conversionProgress += progress;
+  SetProgress(m_conversionProgress * 0.9f + m_mergeProgress * 0.1f);
+}
+
+float KX_LibLoadStatus::GetConversionProgress() const
+{
+  return m_conversionProgress;
+}
+
+void KX_LibLoadStatus::SetMergeProgress(float progress)
+{
+  m_mergeProgress = progress;
+  SetProgress(m_conversionProgress * 0.9f + m_mergeProgress * 0.1f);
+}
+
+float KX_LibLoadStatus::GetMergeProgress() const
+{
+  return m_mergeProgress;
+}
+
 #ifdef WITH_PYTHON
 
 PyMethodDef KX_LibLoadStatus::Methods[] = {
@@ -151,6 +177,8 @@ PyAttributeDef KX_LibLoadStatus::Attributes[] = {
     // EXP_PYATTRIBUTE_RW_FUNCTION("onProgress", KX_LibLoadStatus, pyattr_get_onprogress,
     // pyattr_set_onprogress),
     EXP_PYATTRIBUTE_FLOAT_RO("progress", KX_LibLoadStatus, m_progress),
+    EXP_PYATTRIBUTE_FLOAT_RO("conversionProgress", KX_LibLoadStatus, m_conversionProgress),
+    EXP_PYATTRIBUTE_FLOAT_RO("mergeProgress", KX_LibLoadStatus, m_mergeProgress),
     EXP_PYATTRIBUTE_STRING_RO("libraryName", KX_LibLoadStatus, m_libname),
     EXP_PYATTRIBUTE_RO_FUNCTION("timeTaken", KX_LibLoadStatus, pyattr_get_timetaken),
     EXP_PYATTRIBUTE_BOOL_RO("finished", KX_LibLoadStatus, m_finished),
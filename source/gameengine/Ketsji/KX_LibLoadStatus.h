@@ -35,7 +35,10 @@ class KX_LibLoadStatus : public EXP_PyObjectPlus {
   void *m_data;
   std::string m_libname;
 
+  /// Overall progress, the conversion counts for 90% and the merge for 10%.
   float m_progress;
+  float m_conversionProgress;
+  float m_mergeProgress;
   double m_starttime;
   double m_endtime;
 
@@ -73,6 +76,13 @@ class KX_LibLoadStatus : public EXP_PyObjectPlus {
   float GetProgress();
   void AddProgress(float progress);
 
+  /// Add to the normalized progress of the scenes conversion.
+  void AddConversionProgress(float progress);
+  float GetConversionProgress() const;
+  /// Set the normalized progress of the merge into the scene.
+  void SetMergeProgress(float progress);
+  float GetMergeProgress() const;
+
 #ifdef WITH_PYTHON
   static PyObject *pyattr_get_onfinish(EXP_PyObjectPlus *self_v,
                                        const EXP_PYATTRIBUTE_DEF *attrdef);
@@ -26,6 +26,9 @@
 
 #include "KX_LodManager.h"
 
+#include <algorithm>
+#include <cfloat>
+
 #include "BLI_listbase.hh"
 #include "BLI_math_vector_c.hh"
 #include "DNA_object_types.h"
@@ -37,72 +40,13 @@
 
 using namespace blender;
 
-KX_LodManager::LodLevelIterator::LodLevelIterator(const std::vector<KX_LodLevel *> &levels,
-                                                  unsigned short index,
-                                                  KX_Scene *scene)
-    : m_levels(levels), m_index(index), m_scene(scene)
-{
-}
-
-inline float KX_LodManager::LodLevelIterator::GetHysteresis(unsigned short level) const
-{
-  if (level < 1 || !m_scene->IsActivedLodHysteresis()) {
-    return 0.0f;
-  }
-
-  KX_LodLevel *lod = m_levels[level];
-  KX_LodLevel *prelod = m_levels[level - 1];
-
-  float hysteresis = 0.0f;
-  // if exists, LoD level hysteresis will override scene hysteresis
-  if (lod->GetFlag() & KX_LodLevel::USE_HYSTERESIS) {
-    hysteresis = lod->GetHysteresis() / 100.0f;
-  }
-  else {
-    hysteresis = m_scene->GetLodHysteresisValue() / 100.0f;
-  }
-
-  return MT_abs(prelod->GetDistance() - lod->GetDistance()) * hysteresis;
-}
-
-inline int KX_LodManager::LodLevelIterator::operator++()
-{
-  return m_index++;
-}
-
-inline int KX_LodManager::LodLevelIterator::operator--()
-{
-  return m_index--;
-}
-
-inline short KX_LodManager::LodLevelIterator::operator*() const
-{
-  return m_index;
-}
-
-inline bool KX_LodManager::LodLevelIterator::operator<=(float distance2) const
-{
-  // The last level doesn't have a next level, then the maximum distance is infinite and should
-  // always return false.
-  if (m_index == (m_levels.size() - 1)) {
-    return false;
-  }
-
-  return square_f(m_levels[m_index + 1]->GetDistance() + GetHysteresis(m_index + 1)) <= distance2;
-}
-
-inline bool KX_LodManager::LodLevelIterator::operator>(float distance2) const
-{
-  return square_f(m_levels[m_index]->GetDistance() - GetHysteresis(m_index)) > distance2;
-}
-
 KX_LodManager::KX_LodManager(blender::Object *ob,
                              KX_Scene *scene,
                              RAS_Rasterizer *rasty,
                              BL_SceneConverter *converter,
                              bool libloading,
                              bool converting_during_runtime)
-    : m_refcount(1), m_distanceFactor(ob->lodfactor)
+    : m_thresholdsHysteresis(-1.0f), m_refcount(1), m_distanceFactor(ob->lodfactor)
 {
   if (BLI_listbase_count_at_most(&ob->lodlevels, 2) > 1) {
     blender::Mesh *lodmesh = (blender::Mesh *)ob->data;
@@ -142,7 +86,7 @@ KX_LodManager::KX_LodManager(blender::Object *ob,
 }
 
 KX_LodManager::KX_LodManager(RAS_MeshObject *meshObj, blender::Object *lodsource)
-    : m_refcount(1), m_distanceFactor(1.0f)
+    : m_thresholdsHysteresis(-1.0f), m_refcount(1), m_distanceFactor(1.0f)
 {
   KX_LodLevel *lodLevel = new KX_LodLevel(
       0.0f, 0.0f, 0, meshObj, lodsource, OB_LOD_USE_MESH | OB_LOD_USE_MAT);
@@ -171,29 +115,72 @@ KX_LodLevel *KX_LodManager::GetLevel(unsigned int index) const
   return m_levels[index];
 }
 
-KX_LodLevel *KX_LodManager::GetLevel(KX_Scene *scene, short previouslod, float distance2)
+float KX_LodManager::GetHysteresis(KX_Scene *scene, unsigned short level)
 {
-  if (m_levels.size() == 1) {
-    return m_levels[0];  // in the case of ReplaceMesh we have only 1 level with 1 RAS_MeshObject
+  if (level < 1 || !scene->IsActivedLodHysteresis()) {
+    return 0.0f;
   }
-  distance2 *= (m_distanceFactor * m_distanceFactor);
 
-  LodLevelIterator it(m_levels, previouslod, scene);
+  KX_LodLevel *lod = m_levels[level];
+  KX_LodLevel *prelod = m_levels[level - 1];
+
+  float hysteresis = 0.0f;
+  // if exists, LoD level hysteresis will override scene hysteresis
+  if (lod->GetFlag() & KX_LodLevel::USE_HYSTERESIS) {
+    hysteresis = lod->GetHysteresis() / 100.0f;
+  }
+  else {
+    hysteresis = scene->GetLodHysteresisValue() / 100.0f;
+  }
+
+  return MT_abs(prelod->GetDistance() - lod->GetDistance()) * hysteresis;
+}
+
+void KX_LodManager::UpdateThresholds(KX_Scene *scene)
+{
+  const float hysteresis = scene->IsActivedLodHysteresis() ?
+                               (float)scene->GetLodHysteresisValue() :
+                               -1.0f;
+  if (m_thresholds.size() == m_levels.size() && hysteresis == m_thresholdsHysteresis) {
+    return;
+  }
+
+  const unsigned short count = m_levels.size();
+  m_thresholds.resize(count);
+  for (unsigned short i = 0; i < count; ++i) {
+    LevelThreshold &threshold = m_thresholds[i];
+    // The last level doesn't have a next level, then the maximum distance is infinite.
+    threshold.next = (i < count - 1) ?
+                         square_f(m_levels[i + 1]->GetDistance() + GetHysteresis(scene, i + 1)) :
+                         FLT_MAX;
+    threshold.previous = square_f(m_levels[i]->GetDistance() - GetHysteresis(scene, i));
+  }
+  m_thresholdsHysteresis = hysteresis;
+}
+
+short KX_LodManager::SelectLevel(short previouslod, float distance2) const
+{
+  const short last = m_thresholds.size() - 1;
+  // In the case of ReplaceMesh we have only 1 level with 1 RAS_MeshObject.
+  if (last <= 0) {
+    return 0;
+  }
+  distance2 *= (m_distanceFactor * m_distanceFactor);
 
+  short level = std::clamp<short>(previouslod, 0, last);
   while (true) {
-    if (it <= distance2) {
-      ++it;
+    if (level < last && m_thresholds[level].next <= distance2) {
+      ++level;
     }
-    else if (it > distance2) {
-      --it;
+    else if (level > 0 && m_thresholds[level].previous > distance2) {
+      --level;
     }
     else {
       break;
     }
   }
 
-  const unsigned short level = *it;
-  return (level == previouslod) ? nullptr : m_levels[level];
+  return level;
 }
 
 #ifdef WITH_PYTHON
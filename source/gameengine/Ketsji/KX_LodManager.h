@@ -39,30 +39,16 @@ namespace blender { struct Object; }
 class KX_LodManager : public EXP_Value {
   Py_Header
 
-      private :
-      /** This class helps to compare the object distance to camera with the list of lod levels.
-       * It represent the gap between two levels, when you compare it with a distance it compare
-       * with the a N level distance and a N+1 level distance including hysteresis.
-       */
-      class LodLevelIterator {
-   private:
-    const std::vector<KX_LodLevel *> &m_levels;
-    short m_index;
-    KX_Scene *m_scene;
-    float GetHysteresis(unsigned short level) const;
-
-   public:
-    LodLevelIterator(const std::vector<KX_LodLevel *> &levels,
-                     unsigned short index,
-                     KX_Scene *scene);
-
-    int operator++();
-    int operator--();
-    short operator*() const;
-    /// Compare next level distance more hysteresis with current distance.
-    bool operator<=(float distance2) const;
-    /// Compare the current lod level distance less hysteresis with current distance.
-    bool operator>(float distance2) const;
+ private:
+  /** Squared distances, including hysteresis, at which an object leaves a level. They only
+   * depend on the levels and the scene hysteresis, and are shared by all objects using this
+   * manager, so a level is selected without touching the levels.
+   */
+  struct LevelThreshold {
+    /// Distance from which the next level is used, infinite for the last level.
+    float next;
+    /// Distance under which the previous level is used.
+    float previous;
   };
 
   std::vector<KX_LodLevel *> m_levels;
@@ -73,6 +59,10 @@ class KX_LodManager : public EXP_Value {
    */
   float GetHysteresis(KX_Scene *scene, unsigned short level);
 
+  std::vector<LevelThreshold> m_thresholds;
+  /// Scene hysteresis value the thresholds were computed with, negative if disabled.
+  float m_thresholdsHysteresis;
+
   int m_refcount;
 
   /// Factor applied to the distance from the camera to the object.
@@ -98,13 +88,17 @@ class KX_LodManager : public EXP_Value {
    */
   KX_LodLevel *GetLevel(unsigned int index) const;
 
-  /** Get lod level corresponding to distance and previous level.
-   * \param scene blender::Scene used to get default hysteresis.
+  /** Compute the level thresholds used by SelectLevel, only if the scene hysteresis changed.
+   * \param scene Scene used to get default hysteresis.
+   */
+  void UpdateThresholds(KX_Scene *scene);
+
+  /** Get lod level index corresponding to distance and previous level, using the thresholds
+   * of the last call to UpdateThresholds.
    * \param previouslod Previous lod computed by this function before.
-   *   Use -1 to disable the hysteresis when the lod manager has changed.
    * \param distance2 Squared distance object to the camera.
    */
-  KX_LodLevel *GetLevel(KX_Scene *scene, short previouslod, float distance);
+  short SelectLevel(short previouslod, float distance2) const;
 
 #ifdef WITH_PYTHON
 
@@ -48,6 +48,110 @@
 
 using namespace blender;
 
+/** Buffer exporter for one attribute of the vertices of a display array.
+ * The buffer is two dimensional, one row per vertex and one column per component, and points
+ * to the vertex memory: the row stride is the vertex size. The mesh proxy is referenced to be
+ * kept alive by the buffer.
+ */
+struct KX_VertexBuffer {
+  PyObject_HEAD
+  PyObject *m_owner;
+  char *m_data;
+  Py_ssize_t m_shape[2];
+  Py_ssize_t m_strides[2];
+  Py_ssize_t m_itemSize;
+  const char *m_format;
+};
+
+static void kx_vertex_buffer_dealloc(KX_VertexBuffer *self)
+{
+  Py_XDECREF(self->m_owner);
+  Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static int kx_vertex_buffer_getbuffer(KX_VertexBuffer *self, Py_buffer *view, int flags)
+{
+  if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+    PyErr_SetString(PyExc_BufferError, "vertex buffer: only strided buffers are supported");
+    view->obj = nullptr;
+    return -1;
+  }
+
+  view->buf = self->m_data;
+  view->obj = (PyObject *)self;
+  Py_INCREF(self);
+  view->len = self->m_shape[0] * self->m_shape[1] * self->m_itemSize;
+  view->readonly = 0;
+  view->itemsize = self->m_itemSize;
+  view->format = (flags & PyBUF_FORMAT) ? (char *)self->m_format : nullptr;
+  view->ndim = 2;
+  view->shape = self->m_shape;
+  view->strides = self->m_strides;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+
+  return 0;
+}
+
+static PyBufferProcs kx_vertex_buffer_procs = {(getbufferproc)kx_vertex_buffer_getbuffer,
+                                               nullptr};
+
+static PyTypeObject KX_VertexBuffer_Type = {PyVarObject_HEAD_INIT(nullptr, 0) "KX_VertexBuffer",
+                                            sizeof(KX_VertexBuffer),
+                                            0,
+                                            (destructor)kx_vertex_buffer_dealloc,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            0,
+                                            &kx_vertex_buffer_procs,
+                                            Py_TPFLAGS_DEFAULT};
+
+/** Return a memoryview on components of the vertices of a display array.
+ * \param offset The offset of the first component in a vertex.
+ * \param size The number of components.
+ * \param format The buffer format of a component, "f" or "B".
+ */
+static PyObject *kx_vertex_buffer_new(PyObject *owner,
+                                      RAS_IDisplayArray *array,
+                                      intptr_t offset,
+                                      unsigned short size,
+                                      const char *format)
+{
+  if (PyType_Ready(&KX_VertexBuffer_Type) < 0) {
+    return nullptr;
+  }
+
+  KX_VertexBuffer *buffer = PyObject_New(KX_VertexBuffer, &KX_VertexBuffer_Type);
+  if (!buffer) {
+    return nullptr;
+  }
+
+  const Py_ssize_t itemsize = (format[0] == 'f') ? sizeof(float) : sizeof(unsigned char);
+  buffer->m_owner = owner;
+  buffer->m_data = (char *)array->GetVertexPointer() + offset;
+  buffer->m_shape[0] = array->GetVertexCount();
+  buffer->m_shape[1] = size;
+  buffer->m_strides[0] = array->GetVertexMemorySize();
+  buffer->m_strides[1] = itemsize;
+  buffer->m_itemSize = itemsize;
+  buffer->m_format = format;
+
+  PyObject *view = PyMemoryView_FromObject((PyObject *)buffer);
+  Py_DECREF(buffer);
+
+  return view;
+}
+
 PyTypeObject KX_MeshProxy::Type = {PyVarObject_HEAD_INIT(nullptr, 0) "KX_MeshProxy",
                                    sizeof(EXP_PyObjectPlus_Proxy),
                                    0,
@@ -91,6 +195,11 @@ PyMethodDef KX_MeshProxy::Methods[] = {
     {"getVertexArrayLength", (PyCFunction)KX_MeshProxy::sPyGetVertexArrayLength, METH_VARARGS},
     {"getVertex", (PyCFunction)KX_MeshProxy::sPyGetVertex, METH_VARARGS},
     {"getPolygon", (PyCFunction)KX_MeshProxy::sPyGetPolygon, METH_VARARGS},
+    {"getVertexPositions", (PyCFunction)KX_MeshProxy::sPyGetVertexPositions, METH_VARARGS},
+    {"getVertexNormals", (PyCFunction)KX_MeshProxy::sPyGetVertexNormals, METH_VARARGS},
+    {"getVertexUVs", (PyCFunction)KX_MeshProxy::sPyGetVertexUVs, METH_VARARGS},
+    {"getVertexColors", (PyCFunction)KX_MeshProxy::sPyGetVertexColors, METH_VARARGS},
+    {"commitVertexArray", (PyCFunction)KX_MeshProxy::sPyCommitVertexArray, METH_VARARGS},
     {nullptr, nullptr}  // Sentinel
 };
 
@@ -143,6 +252,7 @@ PyObject *KX_MeshProxy::PyGetVertexArrayLength(PyObject *args, PyObject *kwds)
   RAS_MeshMaterial *mmat = m_meshobj->GetMeshMaterial(matid); /* can be nullptr*/
 
   if (mmat) {
+    m_meshobj->EnsureDisplayArrays();
     RAS_IDisplayArray *array = mmat->GetDisplayArray();
     if (array) {
       length = array->GetVertexCount();
@@ -170,7 +280,7 @@ PyObject *KX_MeshProxy::PyGetVertex(PyObject *args, PyObject *kwds)
 
   RAS_IVertex *vertex = array->GetVertex(vertexindex);
 
-  return (new KX_VertexProxy(array, vertex))->NewProxy(true);
+  return (new KX_VertexProxy(m_meshobj, array, vertex))->NewProxy(true);
 }
 
 PyObject *KX_MeshProxy::PyGetPolygon(PyObject *args, PyObject *kwds)
@@ -198,6 +308,126 @@ PyObject *KX_MeshProxy::PyGetPolygon(PyObject *args, PyObject *kwds)
   return polyob;
 }
 
+static RAS_IDisplayArray *kx_mesh_proxy_get_display_array(RAS_MeshObject *mesh,
+                                                           int matid,
+                                                           const char *error_prefix)
+{
+  RAS_MeshMaterial *mmat = (matid < 0) ? nullptr : mesh->GetMeshMaterial(matid);
+  if (!mmat || !mmat->GetDisplayArray()) {
+    PyErr_Format(
+        PyExc_ValueError, "%s: KX_MeshProxy, invalid material index %d", error_prefix, matid);
+    return nullptr;
+  }
+
+  mesh->EnsureDisplayArrays();
+  return mmat->GetDisplayArray();
+}
+
+PyObject *KX_MeshProxy::PyGetVertexPositions(PyObject *args, PyObject *kwds)
+{
+  int matid;
+
+  if (!PyArg_ParseTuple(args, "i:getVertexPositions", &matid)) {
+    return nullptr;
+  }
+
+  RAS_IDisplayArray *array = kx_mesh_proxy_get_display_array(
+      m_meshobj, matid, "mesh.getVertexPositions(matid)");
+  if (!array) {
+    return nullptr;
+  }
+
+  return kx_vertex_buffer_new(GetProxy(), array, array->GetVertexXYZOffset(), 3, "f");
+}
+
+PyObject *KX_MeshProxy::PyGetVertexNormals(PyObject *args, PyObject *kwds)
+{
+  int matid;
+
+  if (!PyArg_ParseTuple(args, "i:getVertexNormals", &matid)) {
+    return nullptr;
+  }
+
+  RAS_IDisplayArray *array = kx_mesh_proxy_get_display_array(
+      m_meshobj, matid, "mesh.getVertexNormals(matid)");
+  if (!array) {
+    return nullptr;
+  }
+
+  return kx_vertex_buffer_new(GetProxy(), array, array->GetVertexNormalOffset(), 3, "f");
+}
+
+PyObject *KX_MeshProxy::PyGetVertexUVs(PyObject *args, PyObject *kwds)
+{
+  int matid;
+  int layer = 0;
+
+  if (!PyArg_ParseTuple(args, "i|i:getVertexUVs", &matid, &layer)) {
+    return nullptr;
+  }
+
+  RAS_IDisplayArray *array = kx_mesh_proxy_get_display_array(
+      m_meshobj, matid, "mesh.getVertexUVs(matid, layer)");
+  if (!array) {
+    return nullptr;
+  }
+
+  if (layer < 0 || layer >= array->GetVertexUvSize()) {
+    PyErr_Format(PyExc_ValueError,
+                 "mesh.getVertexUVs(matid, layer): KX_MeshProxy, invalid UV layer %d",
+                 layer);
+    return nullptr;
+  }
+
+  const intptr_t offset = array->GetVertexUVOffset() + layer * sizeof(float[2]);
+  return kx_vertex_buffer_new(GetProxy(), array, offset, 2, "f");
+}
+
+PyObject *KX_MeshProxy::PyGetVertexColors(PyObject *args, PyObject *kwds)
+{
+  int matid;
+  int layer = 0;
+
+  if (!PyArg_ParseTuple(args, "i|i:getVertexColors", &matid, &layer)) {
+    return nullptr;
+  }
+
+  RAS_IDisplayArray *array = kx_mesh_proxy_get_display_array(
+      m_meshobj, matid, "mesh.getVertexColors(matid, layer)");
+  if (!array) {
+    return nullptr;
+  }
+
+  if (layer < 0 || layer >= array->GetVertexColorSize()) {
+    PyErr_Format(PyExc_ValueError,
+                 "mesh.getVertexColors(matid, layer): KX_MeshProxy, invalid color layer %d",
+                 layer);
+    return nullptr;
+  }
+
+  const intptr_t offset = array->GetVertexColorOffset() + layer * sizeof(unsigned int);
+  return kx_vertex_buffer_new(GetProxy(), array, offset, 4, "B");
+}
+
+PyObject *KX_MeshProxy::PyCommitVertexArray(PyObject *args, PyObject *kwds)
+{
+  int matid;
+
+  if (!PyArg_ParseTuple(args, "i:commitVertexArray", &matid)) {
+    return nullptr;
+  }
+
+  RAS_IDisplayArray *array = kx_mesh_proxy_get_display_array(
+      m_meshobj, matid, "mesh.commitVertexArray(matid)");
+  if (!array) {
+    return nullptr;
+  }
+
+  array->AppendModifiedFlag(RAS_IDisplayArray::MESH_MODIFIED);
+
+  Py_RETURN_NONE;
+}
+
 PyObject *KX_MeshProxy::pyattr_get_materials(EXP_PyObjectPlus *self_v,
                                              const EXP_PYATTRIBUTE_DEF *attrdef)
 {
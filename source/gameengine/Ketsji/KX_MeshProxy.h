@@ -73,6 +73,13 @@ class KX_MeshProxy : public EXP_Value {
   EXP_PYMETHOD(KX_MeshProxy, GetVertex);
   EXP_PYMETHOD(KX_MeshProxy, GetPolygon);
 
+  // Strided views on the vertex attributes of a material display array.
+  EXP_PYMETHOD(KX_MeshProxy, GetVertexPositions);
+  EXP_PYMETHOD(KX_MeshProxy, GetVertexNormals);
+  EXP_PYMETHOD(KX_MeshProxy, GetVertexUVs);
+  EXP_PYMETHOD(KX_MeshProxy, GetVertexColors);
+  EXP_PYMETHOD(KX_MeshProxy, CommitVertexArray);
+
   static PyObject *pyattr_get_materials(EXP_PyObjectPlus *self_v,
                                         const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_numMaterials(EXP_PyObjectPlus *self_v,
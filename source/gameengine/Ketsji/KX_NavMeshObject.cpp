@@ -719,7 +719,8 @@ bool KX_NavMeshObject::BuildVertIndArrays(float *&vertices,
     // create from RAS_MeshObject (detailed mesh is fake)
     RAS_MeshObject *meshobj = GetMesh(0);
     vertsPerPoly = 3;
-    nverts = meshobj->m_sharedvertex_map.size();
+    const RAS_MeshObject::SharedVertexMap &sharedVertices = meshobj->GetSharedVertexMap();
+    nverts = sharedVertices.size();
     if (nverts >= 0xffff)
       return false;
     // calculate count of tris
@@ -734,7 +735,7 @@ bool KX_NavMeshObject::BuildVertIndArrays(float *&vertices,
     vertices = new float[nverts * 3];
     float *vert = vertices;
     for (int vi = 0; vi < nverts; vi++) {
-      const float *pos = !meshobj->m_sharedvertex_map[vi].empty() ?
+      const float *pos = !sharedVertices[vi].empty() ?
                              meshobj->GetVertexLocation(vi) :
                              nullptr;
       if (pos)
@@ -28,10 +28,14 @@
 
 #include "KX_ObstacleSimulation.h"
 
+#include <algorithm>
+
 #include "BLI_math_geom.hh"
+#include "BLI_task_c.hh"
 
 #include "KX_Globals.h"
 #include "KX_NavMeshObject.h"
+#include "SCA_SteeringActuator.h"
 
 using namespace blender;
 
@@ -190,8 +194,18 @@ static float interpolateToi(float a, const float *dir, const float *toi, const i
   return 0;
 }
 
+static uint64_t grid_key(int x, int y)
+{
+  return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+}
+
 KX_ObstacleSimulation::KX_ObstacleSimulation(MT_Scalar levelHeight, bool enableVisualization)
-    : m_levelHeight(levelHeight), m_enableVisualization(enableVisualization)
+    : m_cellSize(1.0f),
+      m_maxObstacleRadius(0.0f),
+      m_maxObstacleSpeed(0.0f),
+      m_maxAgentSpeed(0.0f),
+      m_levelHeight(levelHeight),
+      m_enableVisualization(enableVisualization)
 {
 }
 
@@ -211,12 +225,15 @@ KX_Obstacle *KX_ObstacleSimulation::CreateObstacle(KX_GameObject *gameobj)
   vset(obstacle->vel, 0, 0);
   vset(obstacle->pvel, 0, 0);
   vset(obstacle->dvel, 0, 0);
-  vset(obstacle->nvel, 0, 0);
   for (int i = 0; i < VEL_HIST_SIZE; ++i)
     vset(&obstacle->hvel[i * 2], 0, 0);
   obstacle->hhead = 0;
+  // Not in the grid until the next rebuild.
+  obstacle->m_cellMin[0] = obstacle->m_cellMin[1] = 0;
+  obstacle->m_cellMax[0] = obstacle->m_cellMax[1] = -1;
 
   m_obstacles.push_back(obstacle);
+  m_objectObstacles.emplace(gameobj, obstacle);
   return obstacle;
 }
 
@@ -256,11 +273,23 @@ void KX_ObstacleSimulation::AddObstaclesForNavMesh(KX_NavMeshObject *navmeshobj)
 
 void KX_ObstacleSimulation::DestroyObstacleForObj(KX_GameObject *gameobj)
 {
+  if (m_objectObstacles.erase(gameobj) == 0) {
+    return;
+  }
+
+  m_requests.erase(std::remove_if(m_requests.begin(),
+                                  m_requests.end(),
+                                  [gameobj](const KX_ObstacleRequest &request) {
+                                    return request.m_obstacle->m_gameObj == gameobj;
+                                  }),
+                   m_requests.end());
+
   for (size_t i = 0; i < m_obstacles.size();) {
     if (m_obstacles[i]->m_gameObj == gameobj) {
       KX_Obstacle *obstacle = m_obstacles[i];
       m_obstacles[i] = m_obstacles.back();
       m_obstacles.pop_back();
+      RemoveFromGrid(obstacle);
       delete obstacle;
     }
     else
@@ -268,6 +297,128 @@ void KX_ObstacleSimulation::DestroyObstacleForObj(KX_GameObject *gameobj)
   }
 }
 
+void KX_ObstacleSimulation::AddToGrid(KX_Obstacle *obstacle,
+                                      const MT_Vector3 &min,
+                                      const MT_Vector3 &max)
+{
+  obstacle->m_cellMin[0] = (int)floorf(min.x() / m_cellSize);
+  obstacle->m_cellMin[1] = (int)floorf(min.y() / m_cellSize);
+  obstacle->m_cellMax[0] = (int)floorf(max.x() / m_cellSize);
+  obstacle->m_cellMax[1] = (int)floorf(max.y() / m_cellSize);
+
+  for (int x = obstacle->m_cellMin[0]; x <= obstacle->m_cellMax[0]; ++x) {
+    for (int y = obstacle->m_cellMin[1]; y <= obstacle->m_cellMax[1]; ++y) {
+      m_grid[grid_key(x, y)].push_back(obstacle);
+    }
+  }
+}
+
+void KX_ObstacleSimulation::RemoveFromGrid(KX_Obstacle *obstacle)
+{
+  for (int x = obstacle->m_cellMin[0]; x <= obstacle->m_cellMax[0]; ++x) {
+    for (int y = obstacle->m_cellMin[1]; y <= obstacle->m_cellMax[1]; ++y) {
+      const std::unordered_map<uint64_t, KX_Obstacles>::iterator cellit = m_grid.find(
+          grid_key(x, y));
+      if (cellit == m_grid.end()) {
+        continue;
+      }
+      KX_Obstacles &cell = cellit->second;
+      KX_Obstacles::iterator it = std::find(cell.begin(), cell.end(), obstacle);
+      if (it != cell.end()) {
+        *it = cell.back();
+        cell.pop_back();
+      }
+    }
+  }
+}
+
+void KX_ObstacleSimulation::RebuildGrid()
+{
+  m_maxObstacleRadius = 0.0f;
+  m_maxObstacleSpeed = 0.0f;
+  for (KX_Obstacle *obs : m_obstacles) {
+    m_maxObstacleRadius = std::max(m_maxObstacleRadius, obs->m_rad);
+    if (obs->m_shape == KX_OBSTACLE_CIRCLE) {
+      m_maxObstacleSpeed = std::max(m_maxObstacleSpeed, len_v2(obs->vel));
+    }
+  }
+
+  /* An agent reaches the obstacles it could hit during the time of impact horizon, a cell size
+   * in the order of the moving distance during one second keeps the queries to a few cells. */
+  m_cellSize = std::max(
+      {m_maxObstacleRadius * 2.0f, m_maxObstacleSpeed * 2.0f, m_maxAgentSpeed * 2.0f, 1.0f});
+
+  // Keep the cells allocated to reuse them, only the cells left empty are released.
+  for (std::pair<const uint64_t, KX_Obstacles> &cell : m_grid) {
+    cell.second.clear();
+  }
+
+  for (KX_Obstacle *obs : m_obstacles) {
+    if (obs->m_shape == KX_OBSTACLE_SEGMENT) {
+      MT_Vector3 p1 = obs->m_pos;
+      MT_Vector3 p2 = obs->m_pos2;
+      // apply world transform
+      if (obs->m_type == KX_OBSTACLE_NAV_MESH) {
+        KX_NavMeshObject *navmeshobj = static_cast<KX_NavMeshObject *>(obs->m_gameObj);
+        p1 = navmeshobj->TransformToWorldCoords(p1);
+        p2 = navmeshobj->TransformToWorldCoords(p2);
+      }
+      const MT_Vector3 rad(obs->m_rad, obs->m_rad, 0.0f);
+      AddToGrid(obs,
+                MT_Vector3(std::min(p1.x(), p2.x()), std::min(p1.y(), p2.y()), 0.0f) - rad,
+                MT_Vector3(std::max(p1.x(), p2.x()), std::max(p1.y(), p2.y()), 0.0f) + rad);
+    }
+    else {
+      const MT_Vector3 rad(obs->m_rad, obs->m_rad, 0.0f);
+      AddToGrid(obs, obs->m_pos - rad, obs->m_pos + rad);
+    }
+  }
+
+  for (std::unordered_map<uint64_t, KX_Obstacles>::iterator it = m_grid.begin();
+       it != m_grid.end();) {
+    if (it->second.empty()) {
+      it = m_grid.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void KX_ObstacleSimulation::GetNeighbourObstacles(KX_Obstacle *activeObst,
+                                                  MT_Scalar reach,
+                                                  KX_Obstacles &neighbours) const
+{
+  neighbours.clear();
+
+  const MT_Vector3 &pos = activeObst->m_pos;
+  const double span = std::floor(2.0 * reach / m_cellSize) + 2.0;
+  // Visiting the cells would be slower than testing all the obstacles.
+  if (span * span > (double)m_obstacles.size()) {
+    neighbours = m_obstacles;
+    return;
+  }
+
+  const int xmin = (int)floorf((pos.x() - reach) / m_cellSize);
+  const int ymin = (int)floorf((pos.y() - reach) / m_cellSize);
+  const int xmax = (int)floorf((pos.x() + reach) / m_cellSize);
+  const int ymax = (int)floorf((pos.y() + reach) / m_cellSize);
+
+  for (int x = xmin; x <= xmax; ++x) {
+    for (int y = ymin; y <= ymax; ++y) {
+      const std::unordered_map<uint64_t, KX_Obstacles>::const_iterator it = m_grid.find(
+          grid_key(x, y));
+      if (it != m_grid.end()) {
+        neighbours.insert(neighbours.end(), it->second.begin(), it->second.end());
+      }
+    }
+  }
+
+  // Obstacles overlapping several cells are found several times.
+  std::sort(neighbours.begin(), neighbours.end());
+  neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+}
+
 void KX_ObstacleSimulation::UpdateObstacles()
 {
   for (size_t i = 0; i < m_obstacles.size(); i++) {
@@ -288,24 +439,94 @@ void KX_ObstacleSimulation::UpdateObstacles()
       add_v2_v2v2(obs->pvel, obs->pvel, &obs->hvel[j * 2]);
     mul_v2_fl(obs->pvel, 1.0f / VEL_HIST_SIZE);
   }
+
+  RebuildGrid();
 }
 
 KX_Obstacle *KX_ObstacleSimulation::GetObstacle(KX_GameObject *gameobj)
 {
-  for (size_t i = 0; i < m_obstacles.size(); i++) {
-    if (m_obstacles[i]->m_gameObj == gameobj)
-      return m_obstacles[i];
+  const std::unordered_map<KX_GameObject *, KX_Obstacle *>::iterator it = m_objectObstacles.find(
+      gameobj);
+  if (it == m_objectObstacles.end()) {
+    return nullptr;
   }
 
-  return nullptr;
+  return it->second;
 }
 
 void KX_ObstacleSimulation::AdjustObstacleVelocity(KX_Obstacle *activeObst,
                                                    KX_NavMeshObject *activeNavMeshObj,
                                                    MT_Vector3 &velocity,
                                                    MT_Scalar maxDeltaSpeed,
-                                                   MT_Scalar maxDeltaAngle)
+                                                   MT_Scalar maxDeltaAngle,
+                                                   KX_Obstacles &neighbours)
+{
+}
+
+void KX_ObstacleSimulation::RequestObstacleVelocity(SCA_SteeringActuator *actuator,
+                                                    KX_Obstacle *activeObst,
+                                                    KX_NavMeshObject *activeNavMeshObj,
+                                                    const MT_Vector3 &velocity,
+                                                    MT_Scalar maxDeltaSpeed,
+                                                    MT_Scalar maxDeltaAngle)
+{
+  m_requests.push_back(
+      {actuator, activeObst, activeNavMeshObj, velocity, maxDeltaSpeed, maxDeltaAngle});
+}
+
+struct UpdateAgentsTaskData {
+  KX_ObstacleSimulation *simulation;
+  KX_ObstacleRequest *requests;
+  KX_Obstacles *neighbours;
+};
+
+static void update_agents_task_func(void *__restrict userdata,
+                                    const int iter,
+                                    const TaskParallelTLS *__restrict /*tls*/)
+{
+  UpdateAgentsTaskData *data = (UpdateAgentsTaskData *)userdata;
+  KX_ObstacleRequest &request = data->requests[iter];
+
+  // The obstacles are only read, each agent writes its own request and neighbours buffer.
+  data->simulation->AdjustObstacleVelocity(request.m_obstacle,
+                                           request.m_navmesh,
+                                           request.m_velocity,
+                                           request.m_maxDeltaSpeed,
+                                           request.m_maxDeltaAngle,
+                                           data->neighbours[iter]);
+}
+
+void KX_ObstacleSimulation::UpdateAgents()
 {
+  if (m_requests.empty()) {
+    return;
+  }
+
+  /* The adjustment of an agent reads the desired velocity of the others, commit all of them
+   * before the parallel range which then never writes the obstacles. */
+  m_maxAgentSpeed = 0.0f;
+  for (KX_ObstacleRequest &request : m_requests) {
+    vset(request.m_obstacle->dvel, request.m_velocity.x(), request.m_velocity.y());
+    m_maxAgentSpeed = std::max(m_maxAgentSpeed, len_v2(request.m_obstacle->dvel));
+  }
+
+  // Keep the buffers of the previous frames to not allocate the neighbours of each agent.
+  if (m_requestNeighbours.size() < m_requests.size()) {
+    m_requestNeighbours.resize(m_requests.size());
+  }
+
+  UpdateAgentsTaskData data = {this, m_requests.data(), m_requestNeighbours.data()};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 4;
+  BLI_task_parallel_range(0, m_requests.size(), &data, update_agents_task_func, &settings);
+
+  for (KX_ObstacleRequest &request : m_requests) {
+    request.m_actuator->ApplyObstacleVelocity(request.m_velocity);
+  }
+
+  m_requests.clear();
 }
 
 void KX_ObstacleSimulation::DrawObstacles()
@@ -392,23 +613,24 @@ void KX_ObstacleSimulationTOI::AdjustObstacleVelocity(KX_Obstacle *activeObst,
                                                       KX_NavMeshObject *activeNavMeshObj,
                                                       MT_Vector3 &velocity,
                                                       MT_Scalar maxDeltaSpeed,
-                                                      MT_Scalar maxDeltaAngle)
+                                                      MT_Scalar maxDeltaAngle,
+                                                      KX_Obstacles &neighbours)
 {
-  int nobs = m_obstacles.size();
-  int obstidx = std::find(m_obstacles.begin(), m_obstacles.end(), activeObst) -
-                m_obstacles.begin();
-  if (obstidx == nobs)
-    return;
-
-  vset(activeObst->dvel, velocity.x(), velocity.y());
+  /* The obstacles out of reach can't be hit before the max time of impact, even with the
+   * relative velocity of the RVO and the oversized velocity samples. */
+  const MT_Scalar reach = activeObst->m_rad + m_maxObstacleRadius +
+                          m_maxToi * (3.0f * len_v2(activeObst->dvel) + len_v2(activeObst->vel) +
+                                      m_maxObstacleSpeed);
+  GetNeighbourObstacles(activeObst, reach, neighbours);
 
   // apply RVO
-  sampleRVO(activeObst, activeNavMeshObj, maxDeltaAngle);
+  float nvel[2];
+  sampleRVO(activeObst, activeNavMeshObj, neighbours, maxDeltaAngle, nvel);
 
   // Fake dynamic constraint.
   float dv[2];
   float vel[2];
-  sub_v2_v2v2(dv, activeObst->nvel, activeObst->vel);
+  sub_v2_v2v2(dv, nvel, activeObst->vel);
   float ds = len_v2(dv);
   if (ds > maxDeltaSpeed || ds < -maxDeltaSpeed)
     mul_v2_fl(dv, fabs(maxDeltaSpeed / ds));
@@ -445,7 +667,9 @@ KX_ObstacleSimulationTOI_rays::KX_ObstacleSimulationTOI_rays(MT_Scalar levelHeig
 
 void KX_ObstacleSimulationTOI_rays::sampleRVO(KX_Obstacle *activeObst,
                                               KX_NavMeshObject *activeNavMeshObj,
-                                              const float maxDeltaAngle)
+                                              const KX_Obstacles &obstacles,
+                                              const float maxDeltaAngle,
+                                              float nvel[2])
 {
   MT_Vector2 vel(activeObst->dvel[0], activeObst->dvel[1]);
   float vmax = (float)vel.length();
@@ -466,7 +690,7 @@ void KX_ObstacleSimulationTOI_rays::sampleRVO(KX_Obstacle *activeObst,
   const int iforw = m_maxSamples / 2;
   const float aoff = (float)iforw / (float)m_maxSamples;
 
-  size_t nobs = m_obstacles.size();
+  size_t nobs = obstacles.size();
   for (int iter = 0; iter < m_maxSamples; ++iter) {
     // Calculate sample velocity
     const float ndir = ((float)iter / (float)m_maxSamples) - aoff;
@@ -479,7 +703,7 @@ void KX_ObstacleSimulationTOI_rays::sampleRVO(KX_Obstacle *activeObst,
     float tmin = m_maxToi;
     float tmine = 0.0f;
     for (int i = 0; i < nobs; ++i) {
-      KX_Obstacle *ob = m_obstacles[i];
+      KX_Obstacle *ob = obstacles[i];
       bool res = filterObstacle(activeObst, activeNavMeshObj, ob, m_levelHeight);
       if (!res)
         continue;
@@ -585,15 +809,15 @@ void KX_ObstacleSimulationTOI_rays::sampleRVO(KX_Obstacle *activeObst,
     vmax *= bestToi / m_minToi;
 
   // New steering velocity.
-  activeObst->nvel[0] = cosf(bestDir) * vmax;
-  activeObst->nvel[1] = sinf(bestDir) * vmax;
+  nvel[0] = cosf(bestDir) * vmax;
+  nvel[1] = sinf(bestDir) * vmax;
 }
 
 ///////////********* TOI_cells**********/////////////////
 
 static void processSamples(KX_Obstacle *activeObst,
                            KX_NavMeshObject *activeNavMeshObj,
-                           KX_Obstacles &obstacles,
+                           const KX_Obstacles &obstacles,
                            float levelHeight,
                            const float vmax,
                            const float *spos,
@@ -757,9 +981,11 @@ static void processSamples(KX_Obstacle *activeObst,
 
 void KX_ObstacleSimulationTOI_cells::sampleRVO(KX_Obstacle *activeObst,
                                                KX_NavMeshObject *activeNavMeshObj,
-                                               const float maxDeltaAngle)
+                                               const KX_Obstacles &obstacles,
+                                               const float maxDeltaAngle,
+                                               float nvel[2])
 {
-  vset(activeObst->nvel, 0.f, 0.f);
+  vset(nvel, 0.f, 0.f);
   float vmax = len_v2(activeObst->dvel);
 
   float *spos = new float[2 * m_maxSamples];
@@ -786,13 +1012,13 @@ void KX_ObstacleSimulationTOI_cells::sampleRVO(KX_Obstacle *activeObst,
     }
     processSamples(activeObst,
                    activeNavMeshObj,
-                   m_obstacles,
+                   obstacles,
                    m_levelHeight,
                    vmax,
                    spos,
                    cs / 2,
                    nspos,
-                   activeObst->nvel,
+                   nvel,
                    m_maxToi,
                    m_velWeight,
                    m_curVelWeight,
@@ -827,7 +1053,7 @@ void KX_ObstacleSimulationTOI_cells::sampleRVO(KX_Obstacle *activeObst,
 
       processSamples(activeObst,
                      activeNavMeshObj,
-                     m_obstacles,
+                     obstacles,
                      m_levelHeight,
                      vmax,
                      spos,
@@ -842,7 +1068,7 @@ void KX_ObstacleSimulationTOI_cells::sampleRVO(KX_Obstacle *activeObst,
 
       cs *= 0.5f;
     }
-    copy_v2_v2(activeObst->nvel, res);
+    copy_v2_v2(nvel, res);
   }
 
   delete[] spos;
@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include "MT_Vector2.h"
@@ -32,6 +34,7 @@
 
 class KX_GameObject;
 class KX_NavMeshObject;
+class SCA_SteeringActuator;
 
 enum KX_OBSTACLE_TYPE {
   KX_OBSTACLE_OBJ,
@@ -54,23 +57,62 @@ struct KX_Obstacle {
   float vel[2];
   float pvel[2];
   float dvel[2];
-  float nvel[2];
   float hvel[VEL_HIST_SIZE * 2];
   int hhead;
 
+  /// Range of the cells of the obstacle grid containing the obstacle.
+  int m_cellMin[2];
+  int m_cellMax[2];
+
   KX_GameObject *m_gameObj;
 };
 typedef std::vector<KX_Obstacle *> KX_Obstacles;
 
+/// Velocity adjustment requested by a steering actuator, solved by UpdateAgents.
+struct KX_ObstacleRequest {
+  SCA_SteeringActuator *m_actuator;
+  KX_Obstacle *m_obstacle;
+  KX_NavMeshObject *m_navmesh;
+  MT_Vector3 m_velocity;
+  MT_Scalar m_maxDeltaSpeed;
+  MT_Scalar m_maxDeltaAngle;
+};
+
 class KX_ObstacleSimulation {
  protected:
   KX_Obstacles m_obstacles;
+  /// The obstacle of each object, the first one for a navigation mesh.
+  std::unordered_map<KX_GameObject *, KX_Obstacle *> m_objectObstacles;
+
+  /** Uniform grid in the XY plane rebuilt by UpdateObstacles, each cell lists the obstacles
+   * overlapping it. The key packs the two cell coordinates. */
+  std::unordered_map<uint64_t, KX_Obstacles> m_grid;
+  /// Size of the grid cells.
+  MT_Scalar m_cellSize;
+  /// Highest radius and speed of the obstacles, bounding the reach of an agent.
+  MT_Scalar m_maxObstacleRadius;
+  MT_Scalar m_maxObstacleSpeed;
+  /// Highest desired speed of the agents during the last update.
+  MT_Scalar m_maxAgentSpeed;
+
+  std::vector<KX_ObstacleRequest> m_requests;
+  /// Neighbour obstacles of each request, reused from frame to frame by UpdateAgents.
+  std::vector<KX_Obstacles> m_requestNeighbours;
 
   MT_Scalar m_levelHeight;
   bool m_enableVisualization;
 
   KX_Obstacle *CreateObstacle(KX_GameObject *gameobj);
 
+  void AddToGrid(KX_Obstacle *obstacle, const MT_Vector3 &min, const MT_Vector3 &max);
+  void RemoveFromGrid(KX_Obstacle *obstacle);
+  void RebuildGrid();
+  /** Get the obstacles around an agent which could be hit in the radius \a reach.
+   * An obstacle can't be listed twice. */
+  void GetNeighbourObstacles(KX_Obstacle *activeObst,
+                             MT_Scalar reach,
+                             KX_Obstacles &neighbours) const;
+
  public:
   KX_ObstacleSimulation(MT_Scalar levelHeight, bool enableVisualization);
   virtual ~KX_ObstacleSimulation();
@@ -83,11 +125,29 @@ class KX_ObstacleSimulation {
   void AddObstaclesForNavMesh(KX_NavMeshObject *navmesh);
   KX_Obstacle *GetObstacle(KX_GameObject *gameobj);
   void UpdateObstacles();
+  /** Adjust the velocity of an agent whose desired velocity is already in its obstacle,
+   * only \a velocity and \a neighbours, a buffer for the neighbour obstacles, are written.
+   */
   virtual void AdjustObstacleVelocity(KX_Obstacle *activeObst,
                                       KX_NavMeshObject *activeNavMeshObj,
                                       MT_Vector3 &velocity,
                                       MT_Scalar maxDeltaSpeed,
-                                      MT_Scalar maxDeltaAngle);
+                                      MT_Scalar maxDeltaAngle,
+                                      KX_Obstacles &neighbours);
+
+  /** Queue the adjustment of the velocity of an agent, the adjusted velocity is passed to
+   * SCA_SteeringActuator::ApplyObstacleVelocity by UpdateAgents.
+   */
+  void RequestObstacleVelocity(SCA_SteeringActuator *actuator,
+                               KX_Obstacle *activeObst,
+                               KX_NavMeshObject *activeNavMeshObj,
+                               const MT_Vector3 &velocity,
+                               MT_Scalar maxDeltaSpeed,
+                               MT_Scalar maxDeltaAngle);
+  /** Adjust the velocity of all the queued agents, in parallel. The desired velocity of all the
+   * agents is known before the adjustments, the result doesn't depend on the agent order.
+   */
+  void UpdateAgents();
 };
 class KX_ObstacleSimulationTOI : public KX_ObstacleSimulation {
  protected:
@@ -101,7 +161,9 @@ class KX_ObstacleSimulationTOI : public KX_ObstacleSimulation {
 
   virtual void sampleRVO(KX_Obstacle *activeObst,
                          KX_NavMeshObject *activeNavMeshObj,
-                         const float maxDeltaAngle) = 0;
+                         const KX_Obstacles &obstacles,
+                         const float maxDeltaAngle,
+                         float nvel[2]) = 0;
 
  public:
   KX_ObstacleSimulationTOI(MT_Scalar levelHeight, bool enableVisualization);
@@ -109,14 +171,17 @@ class KX_ObstacleSimulationTOI : public KX_ObstacleSimulation {
                                       KX_NavMeshObject *activeNavMeshObj,
                                       MT_Vector3 &velocity,
                                       MT_Scalar maxDeltaSpeed,
-                                      MT_Scalar maxDeltaAngle);
+                                      MT_Scalar maxDeltaAngle,
+                                      KX_Obstacles &neighbours);
 };
 
 class KX_ObstacleSimulationTOI_rays : public KX_ObstacleSimulationTOI {
  protected:
   virtual void sampleRVO(KX_Obstacle *activeObst,
                          KX_NavMeshObject *activeNavMeshObj,
-                         const float maxDeltaAngle);
+                         const KX_Obstacles &obstacles,
+                         const float maxDeltaAngle,
+                         float nvel[2]);
 
  public:
   KX_ObstacleSimulationTOI_rays(MT_Scalar levelHeight, bool enableVisualization);
@@ -129,7 +194,9 @@ class KX_ObstacleSimulationTOI_cells : public KX_ObstacleSimulationTOI {
   int m_sampleRadius;
   virtual void sampleRVO(KX_Obstacle *activeObst,
                          KX_NavMeshObject *activeNavMeshObj,
-                         const float maxDeltaAngle);
+                         const KX_Obstacles &obstacles,
+                         const float maxDeltaAngle,
+                         float nvel[2]);
 
  public:
   KX_ObstacleSimulationTOI_cells(MT_Scalar levelHeight, bool enableVisualization);
@@ -36,3 +36,12 @@ enum e_PhysicsEngine {
   UseNone = 0,
   UseBullet = 5,
 };
+
+/// Location of the cached physics shapes.
+enum e_PhysicsShapeCache {
+  ShapeCacheNone = 0,
+  /// In a directory next to the blend file.
+  ShapeCacheBlendDirectory = 1,
+  /// In the user cache directory.
+  ShapeCacheUserDirectory = 2,
+};
@@ -54,6 +54,11 @@ KX_MeshProxy *KX_PolyProxy::GetMeshProxy()
   return m_meshProxy;
 }
 
+RAS_MeshObject *KX_PolyProxy::GetMesh()
+{
+  return m_mesh;
+}
+
 PyTypeObject KX_PolyProxy::Type = {PyVarObject_HEAD_INIT(nullptr, 0) "KX_PolyProxy",
                                    sizeof(EXP_PyObjectPlus_Proxy),
                                    0,
@@ -196,7 +201,8 @@ static PyObject *kx_poly_proxy_get_vertices_item_cb(void *self_v, int index)
   RAS_Polygon *polygon = self->GetPolygon();
   int vertindex = polygon->GetVertexOffset(index);
   RAS_IDisplayArray *array = polygon->GetDisplayArray();
-  KX_VertexProxy *vert = new KX_VertexProxy(array, array->GetVertex(vertindex));
+  KX_VertexProxy *vert = new KX_VertexProxy(
+      self->GetMesh(), array, array->GetVertex(vertindex));
 
   return vert->GetProxy();
 }
@@ -53,6 +53,7 @@ class KX_PolyProxy : public EXP_Value {
 
   RAS_Polygon *GetPolygon();
   KX_MeshProxy *GetMeshProxy();
+  RAS_MeshObject *GetMesh();
 
   // stuff for python integration
   static PyObject *pyattr_get_material_name(EXP_PyObjectPlus *self_v,
@@ -105,6 +105,12 @@ PyDoc_STRVAR(gPySetSolverDamping__doc__,
 PyDoc_STRVAR(gPySetSolverType__doc__,
              "setSolverType(int solverType)\n"
              "Very experimental, not recommended");
+PyDoc_STRVAR(gPySetWorldType__doc__,
+             "setWorldType(int worldType)\n"
+             "Switch between the serial and the multithreaded physics world");
+PyDoc_STRVAR(gPyGetWorldType__doc__,
+             "getWorldType()\n"
+             "Return the physics world type");
 
 PyDoc_STRVAR(gPyCreateConstraint__doc__,
              "createConstraint(ob1,ob2,float restLength,float restitution,float damping)\n"
@@ -369,6 +375,33 @@ static PyObject *gPySetSolverType(PyObject *self, PyObject *args, PyObject *kwds
   Py_RETURN_NONE;
 }
 
+static PyObject *gPySetWorldType(PyObject *self, PyObject *args, PyObject *kwds)
+{
+  int worldType;
+  if (!PyArg_ParseTuple(args, "i:setWorldType", &worldType)) {
+    return nullptr;
+  }
+
+  if (worldType != PHY_WORLD_SERIAL && worldType != PHY_WORLD_MULTITHREAD) {
+    PyErr_SetString(PyExc_ValueError,
+                    "setWorldType(worldType): expected WORLD_SERIAL or WORLD_MULTITHREAD");
+    return nullptr;
+  }
+
+  if (KX_GetPhysicsEnvironment()) {
+    KX_GetPhysicsEnvironment()->SetWorldType((PHY_WorldType)worldType);
+  }
+  Py_RETURN_NONE;
+}
+
+static PyObject *gPyGetWorldType(PyObject *self)
+{
+  if (KX_GetPhysicsEnvironment()) {
+    return PyLong_FromLong(KX_GetPhysicsEnvironment()->GetWorldType());
+  }
+  return PyLong_FromLong(PHY_WORLD_NONE);
+}
+
 static PyObject *gPyGetVehicleConstraint(PyObject *self, PyObject *args, PyObject *kwds)
 {
 #  if defined(_WIN64)
@@ -666,6 +699,14 @@ static struct PyMethodDef physicsconstraints_methods[] = {
      (PyCFunction)gPySetSolverType,
      METH_VARARGS,
      (const char *)gPySetSolverType__doc__},
+    {"setWorldType",
+     (PyCFunction)gPySetWorldType,
+     METH_VARARGS,
+     (const char *)gPySetWorldType__doc__},
+    {"getWorldType",
+     (PyCFunction)gPyGetWorldType,
+     METH_NOARGS,
+     (const char *)gPyGetWorldType__doc__},
 
     {"createConstraint",
      (PyCFunction)gPyCreateConstraint,
@@ -754,6 +795,10 @@ PyMODINIT_FUNC initConstraintPythonBinding()
   KX_MACRO_addTypesToDict(d, VEHICLE_CONSTRAINT, PHY_VEHICLE_CONSTRAINT);
   KX_MACRO_addTypesToDict(d, GENERIC_6DOF_CONSTRAINT, PHY_GENERIC_6DOF_CONSTRAINT);
 
+  // World types to be used with setWorldType() python function
+  KX_MACRO_addTypesToDict(d, WORLD_SERIAL, PHY_WORLD_SERIAL);
+  KX_MACRO_addTypesToDict(d, WORLD_MULTITHREAD, PHY_WORLD_MULTITHREAD);
+
   // Check for errors
   if (PyErr_Occurred()) {
     Py_FatalError("can't initialize module PhysicsConstraints");
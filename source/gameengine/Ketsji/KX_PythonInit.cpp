@@ -107,6 +107,7 @@
 #include "KX_MeshProxy.h" /* for creating a new library of mesh objects */
 #include "KX_NavMeshObject.h"
 #include "KX_NetworkMessageScene.h"  //Needed for sendMessage()
+#include "KX_NetworkTransport.h"
 #include "KX_PyConstraintBinding.h"
 #include "KX_PyMath.h"
 #include "KX_PythonInitTypes.h"
@@ -284,6 +285,15 @@ static PyObject *gPyGetProfileInfo(PyObject *)
   return KX_GetActiveEngine()->GetPyProfileDict();
 }
 
+PyDoc_STRVAR(gPyGetSceneProfileInfo_doc,
+             "getSceneProfileInfo()\n"
+             "returns a dictionary with profiling information per scene, empty unless "
+             "setUseSceneProfile(True) was called");
+static PyObject *gPyGetSceneProfileInfo(PyObject *)
+{
+  return KX_GetActiveEngine()->GetPySceneProfileDict();
+}
+
 PyDoc_STRVAR(gPySendMessage_doc,
              "sendMessage(subject, [body, to, from])\n"
              "sends a message in same manner as a message actuator"
@@ -316,6 +326,146 @@ static PyObject *gPySendMessage(PyObject *, PyObject *args)
   Py_RETURN_NONE;
 }
 
+static bool network_port_check(int port, const char *method_name)
+{
+  if (port < 0 || port > 65535) {
+    PyErr_Format(PyExc_ValueError, "%s: port must be in the range [0, 65535]", method_name);
+    return false;
+  }
+  return true;
+}
+
+static KX_NetworkTransport *network_transport_get(const char *method_name)
+{
+  KX_NetworkTransport *transport =
+      KX_GetActiveEngine()->GetNetworkMessageManager()->GetTransport();
+  if (!transport) {
+    PyErr_Format(PyExc_RuntimeError, "%s: the network transport is not open", method_name);
+  }
+  return transport;
+}
+
+PyDoc_STRVAR(gPyNetworkOpen_doc,
+             "networkOpen([port, [server]])\n"
+             "opens the UDP transport sending the messages to the remote game engines"
+             " port = Local port, any free port if 0 or omitted"
+             " server = Accept the unknown senders and send the replicated properties"
+             " returns True if the port was opened");
+static PyObject *gPyNetworkOpen(PyObject *, PyObject *args)
+{
+  int port = 0;
+  int server = 0;
+  if (!PyArg_ParseTuple(args, "|ii:networkOpen", &port, &server) ||
+      !network_port_check(port, "networkOpen([port, [server]])")) {
+    return nullptr;
+  }
+
+  KX_NetworkMessageManager *manager = KX_GetActiveEngine()->GetNetworkMessageManager();
+  return PyBool_FromLong(manager->OpenTransport(port, server) != nullptr);
+}
+
+PyDoc_STRVAR(gPyNetworkClose_doc,
+             "networkClose()\n"
+             "closes the UDP transport, the messages are then only sent locally");
+static PyObject *gPyNetworkClose(PyObject *)
+{
+  KX_GetActiveEngine()->GetNetworkMessageManager()->CloseTransport();
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(gPyNetworkAddPeer_doc,
+             "networkAddPeer(host, port)\n"
+             "sends the messages and replicated properties to a remote game engine"
+             " host = Host name or IPv4 address"
+             " port = Port of the remote transport"
+             " returns True if the host was resolved");
+static PyObject *gPyNetworkAddPeer(PyObject *, PyObject *args)
+{
+  char *host;
+  int port;
+  if (!PyArg_ParseTuple(args, "si:networkAddPeer", &host, &port) ||
+      !network_port_check(port, "networkAddPeer(host, port)")) {
+    return nullptr;
+  }
+
+  KX_NetworkTransport *transport = network_transport_get("networkAddPeer(host, port)");
+  if (!transport) {
+    return nullptr;
+  }
+
+  return PyBool_FromLong(transport->AddPeer(host, port));
+}
+
+PyDoc_STRVAR(gPyNetworkSetInterest_doc,
+             "networkSetInterest(center, [radius])\n"
+             "only receive the messages and properties of the remote objects inside a sphere"
+             " center = World position of the sphere, None to receive from all objects"
+             " radius = Radius of the sphere");
+static PyObject *gPyNetworkSetInterest(PyObject *, PyObject *args)
+{
+  PyObject *pycenter;
+  float radius = 0.0f;
+  if (!PyArg_ParseTuple(args, "O|f:networkSetInterest", &pycenter, &radius)) {
+    return nullptr;
+  }
+
+  KX_NetworkTransport *transport = network_transport_get("networkSetInterest(center, [radius])");
+  if (!transport) {
+    return nullptr;
+  }
+
+  if (pycenter == Py_None) {
+    transport->ClearInterest();
+    Py_RETURN_NONE;
+  }
+
+  MT_Vector3 center;
+  if (!PyVecTo(pycenter, center)) {
+    return nullptr;
+  }
+
+  float values[3];
+  center.getValue(values);
+  transport->SetInterest(values, radius);
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(gPyGetNetworkStats_doc,
+             "getNetworkStats()\n"
+             "returns a dictionary with the bandwidth and latency counters of the network"
+             " transport, None if not open");
+static PyObject *gPyGetNetworkStats(PyObject *)
+{
+  KX_NetworkTransport *transport =
+      KX_GetActiveEngine()->GetNetworkMessageManager()->GetTransport();
+  if (!transport) {
+    Py_RETURN_NONE;
+  }
+
+  const KX_NetworkTransport::Stats &stats = transport->GetStats();
+  const std::pair<const char *, PyObject *> items[] = {
+      {"bytesSent", PyLong_FromUnsignedLongLong(stats.bytesSent)},
+      {"bytesReceived", PyLong_FromUnsignedLongLong(stats.bytesReceived)},
+      {"datagramsSent", PyLong_FromUnsignedLong(stats.datagramsSent)},
+      {"datagramsReceived", PyLong_FromUnsignedLong(stats.datagramsReceived)},
+      {"messagesSent", PyLong_FromUnsignedLong(stats.messagesSent)},
+      {"messagesReceived", PyLong_FromUnsignedLong(stats.messagesReceived)},
+      {"propertiesSent", PyLong_FromUnsignedLong(stats.propertiesSent)},
+      {"propertiesReceived", PyLong_FromUnsignedLong(stats.propertiesReceived)},
+      {"dropped", PyLong_FromUnsignedLong(stats.dropped)},
+      {"latency", PyFloat_FromDouble(transport->GetLatency())},
+      {"peers", PyLong_FromUnsignedLong(transport->GetPeerCount())},
+      {"port", PyLong_FromLong(transport->GetPort())}};
+
+  PyObject *dict = PyDict_New();
+  for (const std::pair<const char *, PyObject *> &item : items) {
+    PyDict_SetItemString(dict, item.first, item.second);
+    Py_DECREF(item.second);
+  }
+
+  return dict;
+}
+
 // this gets a pointer to an array filled with floats
 static PyObject *gPyGetSpectrum(PyObject *)
 {
@@ -448,6 +598,38 @@ static PyObject *gPySetUseExternalClock(PyObject *, PyObject *args)
   Py_RETURN_NONE;
 }
 
+static PyObject *gPyGetUseParallelScenes(PyObject *)
+{
+  return PyBool_FromLong(KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::PARALLEL_SCENES));
+}
+
+static PyObject *gPySetUseParallelScenes(PyObject *, PyObject *args)
+{
+  int bUseParallelScenes;
+
+  if (!PyArg_ParseTuple(args, "p:setUseParallelScenes", &bUseParallelScenes))
+    return nullptr;
+
+  KX_GetActiveEngine()->SetFlag(KX_KetsjiEngine::PARALLEL_SCENES, (bool)bUseParallelScenes);
+  Py_RETURN_NONE;
+}
+
+static PyObject *gPyGetUseSceneProfile(PyObject *)
+{
+  return PyBool_FromLong(KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::SCENE_PROFILE));
+}
+
+static PyObject *gPySetUseSceneProfile(PyObject *, PyObject *args)
+{
+  int bUseSceneProfile;
+
+  if (!PyArg_ParseTuple(args, "p:setUseSceneProfile", &bUseSceneProfile))
+    return nullptr;
+
+  KX_GetActiveEngine()->SetFlag(KX_KetsjiEngine::SCENE_PROFILE, (bool)bUseSceneProfile);
+  Py_RETURN_NONE;
+}
+
 static PyObject *gPyGetClockTime(PyObject *)
 {
   return PyFloat_FromDouble(KX_GetActiveEngine()->GetClockTime());
@@ -759,6 +941,35 @@ static PyObject *gLibList(PyObject *, PyObject *args)
   return list;
 }
 
+PyDoc_STRVAR(gPySetLibLoadMergeBudget_doc,
+             "setLibLoadMergeBudget(budget)\n"
+             "Sets the time in milliseconds spent per frame to merge the asynchronous libloads,"
+             " 0 to merge them at once");
+static PyObject *gPySetLibLoadMergeBudget(PyObject *, PyObject *args)
+{
+  float budget;
+  if (!PyArg_ParseTuple(args, "f:setLibLoadMergeBudget", &budget)) {
+    return nullptr;
+  }
+
+  if (budget < 0.0f) {
+    PyErr_SetString(PyExc_ValueError,
+                    "bge.logic.setLibLoadMergeBudget(budget): budget must be positive or 0");
+    return nullptr;
+  }
+
+  KX_GetActiveEngine()->GetConverter()->SetMergeBudget(budget * 1.0e-3);
+  Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(gPyGetLibLoadMergeBudget_doc,
+             "getLibLoadMergeBudget()\n"
+             "Gets the time in milliseconds spent per frame to merge the asynchronous libloads");
+static PyObject *gPyGetLibLoadMergeBudget(PyObject *)
+{
+  return PyFloat_FromDouble(KX_GetActiveEngine()->GetConverter()->GetMergeBudget() * 1.0e3);
+}
+
 struct PyNextFrameState pynextframestate;
 static PyObject *gPyNextFrame(PyObject *)
 {
@@ -791,6 +1002,23 @@ static struct PyMethodDef game_methods[] = {
      METH_NOARGS,
      (const char *)gPyLoadGlobalDict_doc},
     {"sendMessage", (PyCFunction)gPySendMessage, METH_VARARGS, (const char *)gPySendMessage_doc},
+    {"networkOpen", (PyCFunction)gPyNetworkOpen, METH_VARARGS, (const char *)gPyNetworkOpen_doc},
+    {"networkClose",
+     (PyCFunction)gPyNetworkClose,
+     METH_NOARGS,
+     (const char *)gPyNetworkClose_doc},
+    {"networkAddPeer",
+     (PyCFunction)gPyNetworkAddPeer,
+     METH_VARARGS,
+     (const char *)gPyNetworkAddPeer_doc},
+    {"networkSetInterest",
+     (PyCFunction)gPyNetworkSetInterest,
+     METH_VARARGS,
+     (const char *)gPyNetworkSetInterest_doc},
+    {"getNetworkStats",
+     (PyCFunction)gPyGetNetworkStats,
+     METH_NOARGS,
+     (const char *)gPyGetNetworkStats_doc},
     {"getCurrentController",
      (PyCFunction)SCA_PythonController::sPyGetCurrentController,
      METH_NOARGS,
@@ -863,6 +1091,24 @@ static struct PyMethodDef game_methods[] = {
      (PyCFunction)gPySetUseExternalClock,
      METH_VARARGS,
      (const char *)"Set if we use the time provided by an external clock"},
+    {"getUseParallelScenes",
+     (PyCFunction)gPyGetUseParallelScenes,
+     METH_NOARGS,
+     (const char *)"Get if the physics and scene graph of independent scenes are updated in "
+                   "parallel"},
+    {"setUseParallelScenes",
+     (PyCFunction)gPySetUseParallelScenes,
+     METH_VARARGS,
+     (const char *)"Set if the physics and scene graph of independent scenes are updated in "
+                   "parallel"},
+    {"getUseSceneProfile",
+     (PyCFunction)gPyGetUseSceneProfile,
+     METH_NOARGS,
+     (const char *)"Get if the profiling information per scene is computed"},
+    {"setUseSceneProfile",
+     (PyCFunction)gPySetUseSceneProfile,
+     METH_VARARGS,
+     (const char *)"Set if the profiling information per scene is computed"},
     {"getClockTime",
      (PyCFunction)gPyGetClockTime,
      METH_NOARGS,
@@ -919,11 +1165,23 @@ static struct PyMethodDef game_methods[] = {
      METH_NOARGS,
      (const char *)"Render next frame (if Python has control)"},
     {"getProfileInfo", (PyCFunction)gPyGetProfileInfo, METH_NOARGS, gPyGetProfileInfo_doc},
+    {"getSceneProfileInfo",
+     (PyCFunction)gPyGetSceneProfileInfo,
+     METH_NOARGS,
+     gPyGetSceneProfileInfo_doc},
     /* library functions */
     {"LibLoad", (PyCFunction)gLibLoad, METH_VARARGS | METH_KEYWORDS, (const char *)""},
     {"LibNew", (PyCFunction)gLibNew, METH_VARARGS, (const char *)""},
     {"LibFree", (PyCFunction)gLibFree, METH_VARARGS, (const char *)""},
     {"LibList", (PyCFunction)gLibList, METH_VARARGS, (const char *)""},
+    {"setLibLoadMergeBudget",
+     (PyCFunction)gPySetLibLoadMergeBudget,
+     METH_VARARGS,
+     (const char *)gPySetLibLoadMergeBudget_doc},
+    {"getLibLoadMergeBudget",
+     (PyCFunction)gPyGetLibLoadMergeBudget,
+     METH_NOARGS,
+     (const char *)gPyGetLibLoadMergeBudget_doc},
 
     {nullptr, (PyCFunction) nullptr, 0, nullptr}};
 
@@ -36,6 +36,12 @@
 
 #include "KX_Scene.h"
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "BKE_context.hh"
 #include "BKE_global.hh"
 #include "BKE_layer.hh"
 #include "BKE_lib_id.hh"
@@ -48,9 +54,13 @@
 #include "BLI_listbase.hh"
 #include "BLI_math_matrix.hh"
 #include "BLI_task.hh"
+#include "BLI_task_c.hh"
+#include "BLI_time.hh"
+#include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_query.hh"
 #include "DNA_camera_types.h"
 #include "DNA_collection_types.h"
+#include "DNA_constraint_types.h"
 #include "DNA_property_types.h"
 #include "DNA_rigidbody_types.h"
 #include "DRW_render.hh"
@@ -61,6 +71,7 @@
 #include "GPU_matrix.hh"
 #include "GPU_state.hh"
 #include "GPU_viewport.hh"
+#include "PRF_profile.hh"
 #include "wm_draw.hh"
 #include "wm_event_system.hh"
 #include "xr/wm_xr.hh"
@@ -70,7 +81,10 @@
 #include "BL_DataConversion.h"
 #include "BL_SceneConverter.h"
 #include "CM_List.h"
+#include "EXP_BoolValue.h"
 #include "EXP_FloatValue.h"
+#include "EXP_IntValue.h"
+#include "EXP_StringValue.h"
 #include "KX_2DFilterManager.h"
 #include "KX_BlenderCanvas.h"
 #include "KX_Camera.h"
@@ -81,6 +95,7 @@
 #include "KX_LodManager.h"
 #include "KX_MotionState.h"
 #include "KX_NetworkMessageScene.h"
+#include "KX_NetworkTransport.h"
 #include "KX_NodeRelationships.h"
 #include "KX_ObstacleSimulation.h"
 #include "KX_PyMath.h"
@@ -96,6 +111,7 @@
 #include "SCA_MouseManager.h"
 #include "SCA_TimeEventManager.h"
 #include "SG_Controller.h"
+#include "SG_Familly.h"
 
 #ifdef WITH_PYTHON
 #  include "EXP_PythonCallBack.h"
@@ -104,6 +120,10 @@
 
 using namespace blender;
 
+/// Keys of the properties looked up for every added object.
+static const EXP_PropertyKey timebombPropKey("::timebomb");
+static const EXP_PropertyKey timerPropKey("timer");
+
 static void bge_dupli_provider(DEGObjectIterData *data)
 {
   KX_KetsjiEngine *engine = KX_GetActiveEngine();
@@ -162,11 +182,17 @@ bool KX_Scene::KX_ScenegraphRescheduleFunc(SG_Node *node, void *gameobj, void *s
   return node->Reschedule(((KX_Scene *)scene)->m_sghead);
 }
 
+bool KX_Scene::KX_ScenegraphRenderFunc(SG_Node *node, void *gameobj, void *scene)
+{
+  return node->ScheduleRender(((KX_Scene *)scene)->m_renderhead);
+}
+
 SG_Callbacks KX_Scene::m_callbacks = SG_Callbacks(KX_SceneReplicationFunc,
                                                   KX_SceneDestructionFunc,
                                                   KX_GameObject::UpdateTransformFunc,
                                                   KX_Scene::KX_ScenegraphUpdateFunc,
-                                                  KX_Scene::KX_ScenegraphRescheduleFunc);
+                                                  KX_Scene::KX_ScenegraphRescheduleFunc,
+                                                  KX_Scene::KX_ScenegraphRenderFunc);
 
 KX_Scene::KX_Scene(SCA_IInputDevice *inputDevice,
                    const std::string &sceneName,
@@ -196,6 +222,14 @@ KX_Scene::KX_Scene(SCA_IInputDevice *inputDevice,
   m_dbvt_culling = false;
   m_dbvt_occlusion_res = 0;
   m_activityCulling = false;
+  m_animationLod = false;
+  m_animationLodCulling = true;
+  // Actions are updated every 2 frames from 25 units and every 4 frames from 50 units.
+  m_animationLodLevels = {{25.0f * 25.0f, 2}, {50.0f * 50.0f, 4}};
+  m_animationFrame = 0;
+  m_animationNextPhase = 0;
+  m_animationStats = {0, 0, 0};
+  m_lastNetworkId = 0;
   m_objectlist = new EXP_ListValue<KX_GameObject>();
   m_parentlist = new EXP_ListValue<KX_GameObject>();
   m_lightlist = new EXP_ListValue<KX_LightObject>();
@@ -261,6 +295,7 @@ KX_Scene::KX_Scene(SCA_IInputDevice *inputDevice,
   scene->lay = 1;
 
   m_kxobWithLod = {};
+  m_lodDepsgraphUpdateCount = 0;
   m_obVisibilityFlag = {};
   m_backupOverlayFlag = -1;
 
@@ -328,7 +363,9 @@ KX_Scene::KX_Scene(SCA_IInputDevice *inputDevice,
   DEG_register_bge_object_provider(bge_dupli_provider);
 
   /* Fix black shading issue with addObject https://github.com/UPBGE/upbge/issues/1354 */
-  GPU_shader_force_unbind();
+  if (!KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+    GPU_shader_force_unbind();
+  }
   /****************************************************/
 }
 
@@ -364,7 +401,9 @@ KX_Scene::~KX_Scene()
   }
 
   /* Fixes issue when switching .blend erm...*/
-  GPU_shader_force_unbind();
+  if (!KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+    GPU_shader_force_unbind();
+  }
 
   // Put that before we flush depsgraph updates at scene exit
   scene->flag &= ~SCE_INTERACTIVE;
@@ -377,6 +416,11 @@ KX_Scene::~KX_Scene()
   // reference might be hanging and causing late release of objects
   RemoveAllDebugProperties();
 
+  // Free the dormant replicas before the objects they were replicated from.
+  while (!m_replicaPools.empty()) {
+    FreeReplicaPool(m_replicaPools.begin()->first);
+  }
+
   while (GetRootParentList()->GetCount() > 0) {
     KX_GameObject *parentobj = GetRootParentList()->GetValue(0);
     this->RemoveObject(parentobj);
@@ -702,6 +746,7 @@ void KX_Scene::UpdateDepsgraph(blender::Main *bmain,
                                bool is_last_render_pass,
                                KX_Camera *cam)
 {
+  PRF_scope(ProfileCategory::GameEngine);
   if (m_collectionRemap) {
     /* check 68589a31ebfb79165f99a979357d237e5413e904 for potential issue or improvement? */
     /* If problem with ReplicateBlenderObject, see other occurrences of
@@ -710,13 +755,23 @@ void KX_Scene::UpdateDepsgraph(blender::Main *bmain,
     m_collectionRemap = false;
   }
 
+  /* Update compatibles blender physics simulations, they can concern static objects. */
+  if (scene->gm.flag & (GAME_USE_INTERACTIVE_DYNAPAINT | GAME_USE_INTERACTIVE_RIGIDBODY)) {
+    for (KX_GameObject *gameobj : GetObjectList()) {
+      TagBlenderPhysicsObject(scene, gameobj->GetBlenderObject());
+    }
+  }
+
   /* Notify the depsgraph if object transform changed in the scene
-   * for next drawing loop. */
-  for (KX_GameObject *gameobj : GetObjectList()) {
-    /* Update compatibles blender physics simulations */
-    blender::Object *ob = gameobj->GetBlenderObject();
-    TagBlenderPhysicsObject(scene, ob);
-    gameobj->TagForTransformUpdate(is_overlay_pass);
+   * for next drawing loop. Only the nodes with DIRTY_RENDER set or requesting an update
+   * are in m_renderhead, static objects are skipped. */
+  for (SG_Node *node = SG_Node::GetFirstRender(m_renderhead); node;
+       node = node->GetNextRender(m_renderhead))
+  {
+    KX_GameObject *gameobj = static_cast<KX_GameObject *>(node->GetSGClientObject());
+    if (gameobj) {
+      gameobj->TagForTransformUpdate(is_overlay_pass);
+    }
   }
 
   /* Notify depsgraph for other changes */
@@ -732,8 +787,18 @@ void KX_Scene::UpdateDepsgraph(blender::Main *bmain,
   BKE_scene_graph_update_tagged(depsgraph, bmain);
 
   /* Update evaluated object object_to_world according to SceneGraph. */
-  for (KX_GameObject *gameobj : GetObjectList()) {
-    gameobj->TagForTransformUpdateEvaluated(is_last_render_pass);
+  SG_Node *next;
+  for (SG_Node *node = SG_Node::GetFirstRender(m_renderhead); node; node = next) {
+    // The node leaves the list at last render pass.
+    next = node->GetNextRender(m_renderhead);
+
+    KX_GameObject *gameobj = static_cast<KX_GameObject *>(node->GetSGClientObject());
+    if (gameobj) {
+      gameobj->TagForTransformUpdateEvaluated(is_last_render_pass);
+    }
+    if (is_last_render_pass) {
+      node->ClearDirty(SG_Node::DIRTY_RENDER);
+    }
   }
 }
 
@@ -1429,7 +1494,7 @@ void KX_Scene::ApplyLifespan(KX_GameObject *replica, float lifespan)
     // 60 frames per second if you change this value, make sure you change it in
     // KX_GameObject::pyattr_get_life property too
     EXP_Value *fval = new EXP_FloatValue(lifespan * 0.016666667f);
-    replica->SetProperty("::timebomb", fval);
+    replica->SetProperty(timebombPropKey, fval);
     fval->Release();
   }
 }
@@ -1658,7 +1723,7 @@ KX_GameObject *KX_Scene::AddNodeReplicaObject(SG_Node *node, KX_GameObject *game
   for (int i = 0; i < numprops; i++) {
     EXP_Value *prop = newobj->GetProperty(i);
 
-    if (prop->GetProperty("timer"))
+    if (prop->GetProperty(timerPropKey))
       this->m_timemgr->AddTimeProperty(prop);
   }
 
@@ -1698,6 +1763,7 @@ KX_GameObject *KX_Scene::AddNodeReplicaObject(SG_Node *node, KX_GameObject *game
 
   // this is the list of object that are send to the graphics pipeline
   m_objectlist->Add(CM_AddRef(newobj));
+  RegisterNetworkObject(newobj, true);
   switch (newobj->GetGameObjectType()) {
     case SCA_IObject::OBJ_LIGHT: {
       m_lightlist->Add(CM_AddRef(static_cast<KX_LightObject *>(newobj)));
@@ -2018,9 +2084,74 @@ void KX_Scene::DupliGroupRecurse(KX_GameObject *groupobj, int level)
   }
 }
 
+/// Return true if the replicas of an object can be kept dormant in a replica pool.
+static bool is_object_poolable(KX_GameObject *gameobj)
+{
+  switch (gameobj->GetGameObjectType()) {
+    case SCA_IObject::OBJ_ARMATURE:
+    case SCA_IObject::OBJ_CAMERA:
+    case SCA_IObject::OBJ_LIGHT:
+    case SCA_IObject::OBJ_TEXT: {
+      return false;
+    }
+  }
+
+  blender::Object *ob = gameobj->GetBlenderObject();
+  if (!ob || (ob->gameflag & OB_DUPLI_UPBGE) || gameobj->IsDupliGroup()) {
+    return false;
+  }
+
+  if (gameobj->GetPrototype() || gameobj->GetComponents()) {
+    return false;
+  }
+
+  // Only single objects are pooled, a hierarchy could be modified by its replicas.
+  return gameobj->GetSGNode()->GetSGChildren().empty();
+}
+
+bool KX_Scene::PreallocateObjects(KX_GameObject *gameobj, unsigned int count)
+{
+  if (!is_object_poolable(gameobj)) {
+    return false;
+  }
+
+  std::vector<KX_GameObject *> &pool = m_replicaPools[gameobj];
+  pool.reserve(pool.size() + count);
+
+  for (unsigned int i = 0; i < count; ++i) {
+    KX_GameObject *replica = NewReplicaObject(gameobj, nullptr, 0.0f);
+    m_pooledReplicas[replica] = gameobj;
+    RecycleReplicaObject(replica);
+    // release here because NewReplicaObject AddRef's, the pool owns its own reference
+    replica->Release();
+  }
+
+  return true;
+}
+
 KX_GameObject *KX_Scene::AddReplicaObject(KX_GameObject *originalobject,
                                           KX_GameObject *referenceobject,
                                           float lifespan)
+{
+  const auto it = m_replicaPools.find(originalobject);
+  if (it == m_replicaPools.end()) {
+    return NewReplicaObject(originalobject, referenceobject, lifespan);
+  }
+
+  if (!it->second.empty()) {
+    return ReuseReplicaObject(originalobject, referenceobject, lifespan);
+  }
+
+  // The pool is empty, the new replica will join it once removed.
+  KX_GameObject *replica = NewReplicaObject(originalobject, referenceobject, lifespan);
+  m_pooledReplicas[replica] = originalobject;
+
+  return replica;
+}
+
+KX_GameObject *KX_Scene::NewReplicaObject(KX_GameObject *originalobject,
+                                          KX_GameObject *referenceobject,
+                                          float lifespan)
 {
   m_logicHierarchicalGameObjects.clear();
   m_map_gameobject_to_replica.clear();
@@ -2102,6 +2233,143 @@ KX_GameObject *KX_Scene::AddReplicaObject(KX_GameObject *originalobject,
   return replica;
 }
 
+KX_GameObject *KX_Scene::ReuseReplicaObject(KX_GameObject *originalobj,
+                                            KX_GameObject *referenceobj,
+                                            float lifespan)
+{
+  std::vector<KX_GameObject *> &pool = m_replicaPools[originalobj];
+  KX_GameObject *replica = pool.back();
+  pool.pop_back();
+
+  // Reset the transformation as for a new replica, the physics controller follows.
+  SG_Node *orgnode = originalobj->GetSGNode();
+  replica->NodeSetLocalScale(orgnode->GetLocalScale());
+  replica->NodeSetLocalPosition(orgnode->GetLocalPosition());
+  replica->NodeSetLocalOrientation(orgnode->GetLocalOrientation());
+  ApplyReferenceTransform(replica, referenceobj);
+  replica->GetSGNode()->UpdateWorldData(0);
+
+  replica->RestorePooledReplica(originalobj);
+
+  if (m_obstacleSimulation && originalobj->GetBlenderObject()->gameflag & OB_HASOBSTACLE) {
+    m_obstacleSimulation->AddObstacleForObj(replica);
+  }
+
+  // The reference owned by the pool is given to the caller like for a new replica.
+  m_objectlist->Add(CM_AddRef(replica));
+  m_parentlist->Add(CM_AddRef(replica));
+  RegisterNetworkObject(replica, true);
+
+  ApplyLifespan(replica, lifespan);
+
+  // also register 'timers' (time properties) of the replica
+  for (int i = 0, numprops = replica->GetPropertyCount(); i < numprops; ++i) {
+    EXP_Value *prop = replica->GetProperty(i);
+    if (prop->GetProperty(timerPropKey)) {
+      m_timemgr->AddTimeProperty(prop);
+    }
+  }
+
+  // The logic bricks are replicated again from the original object to reset them.
+  m_logicHierarchicalGameObjects.clear();
+  m_map_gameobject_to_replica.clear();
+  m_groupGameObjects.clear();
+  m_ueberExecutionPriority++;
+  m_map_gameobject_to_replica[originalobj] = replica;
+
+  replica->SetLogicFrom(originalobj);
+  replica->ReParentLogic();
+  replica->Relink(m_map_gameobject_to_replica);
+  replica->SetLayer(referenceobj ? referenceobj->GetLayer() : m_blenderScene->lay);
+  ReplicateLogic(replica);
+
+  return replica;
+}
+
+bool KX_Scene::RecycleReplicaObject(KX_GameObject *gameobj)
+{
+  const auto it = m_pooledReplicas.find(gameobj);
+  if (it == m_pooledReplicas.end()) {
+    return false;
+  }
+
+  /* Objects parented or used as parent since their creation and objects moved
+   * to an overlay collection are destructed as usual. */
+  SG_Node *node = gameobj->GetSGNode();
+  if (node->GetSGParent() || !node->GetSGChildren().empty() ||
+      (gameobj->GetBlenderObject()->gameflag & OB_OVERLAY_COLLECTION))
+  {
+    return false;
+  }
+
+  // The pool owns a reference while the object is dormant.
+  gameobj->AddRef();
+
+  // Run the remove callbacks before invalidating the python proxy.
+  gameobj->SuspendPooledReplica();
+  RemoveObjectDebugProperties(gameobj);
+  gameobj->InvalidateProxy();
+
+  UnregisterObjectLogic(gameobj);
+  gameobj->DeleteLogic();
+  gameobj->ClearProperties();
+
+  if (m_obstacleSimulation) {
+    m_obstacleSimulation->DestroyObstacleForObj(gameobj);
+  }
+
+  node->Unschedule();
+
+  UnregisterNetworkObject(gameobj);
+  if (m_objectlist->RemoveValue(gameobj)) {
+    gameobj->Release();
+  }
+  if (m_parentlist->RemoveValue(gameobj)) {
+    gameobj->Release();
+  }
+
+  CM_ListRemoveIfFound(m_animatedlist, gameobj);
+  CM_ListRemoveIfFound(m_euthanasyobjects, gameobj);
+  CM_ListRemoveIfFound(m_tempObjectList, gameobj);
+
+  m_replicaPools[it->second].push_back(gameobj);
+
+  return true;
+}
+
+void KX_Scene::FreeReplicaPool(KX_GameObject *gameobj)
+{
+  const auto it = m_replicaPools.find(gameobj);
+  if (it == m_replicaPools.end()) {
+    return;
+  }
+
+  const std::vector<KX_GameObject *> dormants = std::move(it->second);
+  m_replicaPools.erase(it);
+
+  for (KX_GameObject *replica : dormants) {
+    // A dormant replica is in no list, the reference of the pool is the last one.
+    SG_Node *node = replica->GetSGNode();
+    replica->Release();
+    delete node;
+  }
+
+  // Forget the dormant and active replicas, the active ones are destructed when removed.
+  for (auto rit = m_pooledReplicas.begin(); rit != m_pooledReplicas.end();) {
+    if (rit->second == gameobj) {
+      rit = m_pooledReplicas.erase(rit);
+    }
+    else {
+      ++rit;
+    }
+  }
+}
+
+void KX_Scene::UnpoolReplicaObject(KX_GameObject *gameobj)
+{
+  m_pooledReplicas.erase(gameobj);
+}
+
 void KX_Scene::RemoveObject(KX_GameObject *gameobj)
 {
   // disconnect child from parent
@@ -2160,34 +2428,7 @@ bool KX_Scene::NewRemoveObject(KX_GameObject *gameobj)
     m_logicmgr->UnregisterGameObj(gameobj->GetBlenderObject(), gameobj);
   }
 
-  // remove all sensors/controllers/actuators from logicsystem...
-
-  SCA_SensorList &sensors = gameobj->GetSensors();
-  for (SCA_ISensor *sensor : sensors) {
-    m_logicmgr->RemoveSensor(sensor);
-  }
-
-  SCA_ControllerList &controllers = gameobj->GetControllers();
-  for (SCA_IController *controller : controllers) {
-    m_logicmgr->RemoveController(controller);
-    controller->ReParent(nullptr);
-  }
-
-  SCA_ActuatorList &actuators = gameobj->GetActuators();
-  for (SCA_IActuator *actuator : actuators) {
-    m_logicmgr->RemoveActuator(actuator);
-  }
-  // the sensors/controllers/actuators must also be released, this is done in ~SCA_IObject
-
-  // now remove the timer properties from the time manager
-  int numprops = gameobj->GetPropertyCount();
-
-  for (int i = 0; i < numprops; i++) {
-    EXP_Value *propval = gameobj->GetProperty(i);
-    if (propval->GetProperty("timer")) {
-      m_timemgr->RemoveTimeProperty(propval);
-    }
-  }
+  UnregisterObjectLogic(gameobj);
 
   // if the object is the dupligroup proxy, you have to cleanup all m_pDupliGroupObject's in all
   // instances referring to this group
@@ -2208,7 +2449,12 @@ bool KX_Scene::NewRemoveObject(KX_GameObject *gameobj)
 
   m_proxyManager.Unregister(gameobj);
 
+  // Free the dormant replicas of an original object and forget a destructed pooled replica.
+  FreeReplicaPool(gameobj);
+  m_pooledReplicas.erase(gameobj);
+
   gameobj->RemoveMeshes();
+  UnregisterNetworkObject(gameobj);
 
   bool ret = true;
   if (m_lightlist->RemoveValue(gameobj)) {
@@ -2250,6 +2496,38 @@ bool KX_Scene::NewRemoveObject(KX_GameObject *gameobj)
   return ret;
 }
 
+void KX_Scene::UnregisterObjectLogic(KX_GameObject *gameobj)
+{
+  // remove all sensors/controllers/actuators from logicsystem...
+
+  SCA_SensorList &sensors = gameobj->GetSensors();
+  for (SCA_ISensor *sensor : sensors) {
+    m_logicmgr->RemoveSensor(sensor);
+  }
+
+  SCA_ControllerList &controllers = gameobj->GetControllers();
+  for (SCA_IController *controller : controllers) {
+    m_logicmgr->RemoveController(controller);
+    controller->ReParent(nullptr);
+  }
+
+  SCA_ActuatorList &actuators = gameobj->GetActuators();
+  for (SCA_IActuator *actuator : actuators) {
+    m_logicmgr->RemoveActuator(actuator);
+  }
+  // the sensors/controllers/actuators must also be released, this is done in ~SCA_IObject
+
+  // now remove the timer properties from the time manager
+  int numprops = gameobj->GetPropertyCount();
+
+  for (int i = 0; i < numprops; i++) {
+    EXP_Value *propval = gameobj->GetProperty(i);
+    if (propval->GetProperty(timerPropKey)) {
+      m_timemgr->RemoveTimeProperty(propval);
+    }
+  }
+}
+
 void KX_Scene::ReplaceMesh(KX_GameObject *gameobj,
                            RAS_MeshObject *mesh,
                            bool use_gfx,
@@ -2377,9 +2655,10 @@ void KX_Scene::RenderDebugProperties(RAS_DebugDraw &debugDraw,
 // logic stuff
 void KX_Scene::LogicBeginFrame(double curtime, double framestep)
 {
+  PRF_scope(ProfileCategory::GameEngine);
   // have a look at temp objects ...
   for (KX_GameObject *gameobj : m_tempObjectList) {
-    EXP_FloatValue *propval = (EXP_FloatValue *)gameobj->GetProperty("::timebomb");
+    EXP_FloatValue *propval = (EXP_FloatValue *)gameobj->GetProperty(timebombPropKey);
 
     if (propval) {
       const float timeleft = propval->GetNumber() - framestep;
@@ -2402,67 +2681,333 @@ void KX_Scene::LogicBeginFrame(double curtime, double framestep)
 
 void KX_Scene::AddAnimatedObject(KX_GameObject *gameobj)
 {
-  CM_ListAddIfNotFound(m_animatedlist, gameobj);
+  if (CM_ListAddIfNotFound(m_animatedlist, gameobj)) {
+    // Spread the objects updated at the same rate over different frames.
+    gameobj->SetAnimationLodPhase(m_animationNextPhase++);
+  }
 }
 
 void KX_Scene::UpdateAnimations(double curtime)
 {
-  for (KX_GameObject *gameobj : m_animatedlist) {
-    if (!gameobj->IsActionsSuspended()) {
-      gameobj->UpdateActionManager(curtime, true);
+  PRF_scope(ProfileCategory::GameEngine);
+  m_animationStats = {0, 0, 0};
+
+  if (m_animationLod) {
+    UpdateAnimationsLod(curtime);
+  }
+  else {
+    for (KX_GameObject *gameobj : m_animatedlist) {
+      if (!gameobj->IsActionsSuspended()) {
+        gameobj->UpdateActionManager(curtime, true, true);
+        ++m_animationStats.m_evaluated;
+      }
     }
   }
-}
-
-void KX_Scene::LogicUpdateFrame(double curtime)
-{
-  m_proxyManager.Update();
 
-  m_logicmgr->UpdateFrame(curtime);
+  // Evaluate the armature poses of the actions updated above.
+  UpdateArmaturePoses();
 }
 
-void KX_Scene::LogicEndFrame()
+void KX_Scene::UpdateAnimationsLod(double curtime)
 {
-  m_logicmgr->EndFrame();
+  PRF_scope(ProfileCategory::GameEngine);
+  ++m_animationFrame;
 
-  /* Don't remove the objects from the euthanasy list here as the child objects of a deleted
-   * parent object are destructed directly from the sgnode in the same time the parent
-   * object is destructed. These child objects must be removed automatically from the
-   * euthanasy list to avoid double deletion in case the user ask to delete the child object
-   * explicitly. NewRemoveObject is the place to do it.
-   */
-  while (!m_euthanasyobjects.empty()) {
-    RemoveObject(m_euthanasyobjects.front());
+  /* The cameras rendering the scene: the active camera and the cameras using a viewport.
+   * Their frustums are only tested when all of them have a valid projection matrix, else an
+   * object could be seen by a camera without being known as visible. */
+  std::vector<MT_Vector3> camPositions;
+  std::vector<const SG_Frustum *> camFrustums;
+  bool useFrustums = m_animationLodCulling;
+  for (KX_Camera *cam : m_cameralist) {
+    if (cam != m_active_camera && !cam->GetViewport()) {
+      continue;
+    }
+    camPositions.push_back(cam->NodeGetWorldPosition());
+    if (useFrustums && cam->hasValidProjectionMatrix()) {
+      camFrustums.push_back(&cam->GetFrustum());
+    }
+    else {
+      useFrustums = false;
+    }
   }
+  useFrustums = useFrustums && !camFrustums.empty();
 
-  // prepare obstacle simulation for new frame
-  if (m_obstacleSimulation)
-    m_obstacleSimulation->UpdateObstacles();
+  for (KX_GameObject *gameobj : m_animatedlist) {
+    if (gameobj->IsActionsSuspended()) {
+      continue;
+    }
 
-  for (KX_FontObject *font : m_fontlist) {
-    font->UpdateTextFromProperty();
-  }
-}
+    if (!gameobj->GetAnimationLod() || camPositions.empty()) {
+      gameobj->UpdateActionManager(curtime, true, true);
+      ++m_animationStats.m_evaluated;
+      continue;
+    }
 
-/**
- * UpdateParents: SceneGraph transformation update.
- */
-void KX_Scene::UpdateParents(double curtime)
-{
-  // we use the SG dynamic list
-  SG_Node *node;
+    const MT_Vector3 &obpos = gameobj->NodeGetWorldPosition();
+    float dist = FLT_MAX;
+    for (const MT_Vector3 &campos : camPositions) {
+      dist = min_ff((obpos - campos).length2(), dist);
+    }
 
-  while ((node = SG_Node::GetNextScheduled(m_sghead)) != nullptr) {
-    node->UpdateWorldData(curtime);
-  }
+    // Use the divisor of the farthest level reached.
+    unsigned short divisor = 1;
+    for (const std::pair<float, unsigned short> &level : m_animationLodLevels) {
+      if (dist < level.first) {
+        break;
+      }
+      divisor = level.second;
+    }
 
-  // the list must be empty here
-  BLI_assert(m_sghead.Empty());
-  // some nodes may be ready for reschedule, move them to schedule list for next time
-  while ((node = SG_Node::GetNextRescheduled(m_sghead)) != nullptr) {
-    node->Schedule(m_sghead);
-  }
-}
+    /* A skipped object keeps its actions time, the next update advances the actions of all the
+     * elapsed time. */
+    if ((m_animationFrame + gameobj->GetAnimationLodPhase()) % divisor != 0) {
+      ++m_animationStats.m_skipped;
+      continue;
+    }
+
+    bool visible = true;
+    if (useFrustums) {
+      const MT_Vector3 scale = gameobj->NodeGetWorldScaling().absolute();
+      const float radius = gameobj->GetAnimationLodRadius() *
+                           max_ff(scale.x(), max_ff(scale.y(), scale.z()));
+      visible = false;
+      for (const SG_Frustum *frustum : camFrustums) {
+        if (frustum->SphereInsideFrustum(obpos, radius) != SG_Frustum::OUTSIDE) {
+          visible = true;
+          break;
+        }
+      }
+    }
+
+    /* The actions of an invisible object keep their time and animate the object channels, only
+     * the evaluation of the armature pose is skipped. */
+    gameobj->UpdateActionManager(curtime, true, visible);
+    if (visible) {
+      ++m_animationStats.m_evaluated;
+    }
+    else {
+      ++m_animationStats.m_culled;
+    }
+  }
+}
+
+struct ArmaturePoseTaskData {
+  BL_ArmatureObject **armatures;
+  blender::Depsgraph *depsgraph;
+};
+
+static void armature_pose_task_func(void *__restrict userdata,
+                                    const int iter,
+                                    const TaskParallelTLS *__restrict /*tls*/)
+{
+  ArmaturePoseTaskData *data = static_cast<ArmaturePoseTaskData *>(userdata);
+  data->armatures[iter]->EvaluatePendingActions(data->depsgraph);
+}
+
+void KX_Scene::UpdateArmaturePoses()
+{
+  PRF_scope(ProfileCategory::GameEngine);
+  std::vector<BL_ArmatureObject *> parallelArmatures;
+  std::vector<BL_ArmatureObject *> serialArmatures;
+  for (KX_GameObject *gameobj : m_animatedlist) {
+    if (gameobj->GetGameObjectType() != SCA_IObject::OBJ_ARMATURE) {
+      continue;
+    }
+
+    BL_ArmatureObject *armature = static_cast<BL_ArmatureObject *>(gameobj);
+    if (!armature->HasPendingActions()) {
+      continue;
+    }
+
+    if (armature->HasExternalPoseDependencies()) {
+      serialArmatures.push_back(armature);
+    }
+    else {
+      parallelArmatures.push_back(armature);
+    }
+  }
+
+  if (parallelArmatures.empty() && serialArmatures.empty()) {
+    return;
+  }
+
+  blender::bContext *C = KX_GetActiveEngine()->GetContext();
+  blender::Depsgraph *depsgraph = CTX_data_depsgraph_pointer(C);
+
+  /* Each armature only modifies its own pose, the result doesn't depend on the evaluation
+   * order of the threads. */
+  ArmaturePoseTaskData data = {parallelArmatures.data(), depsgraph};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  settings.use_threading = (parallelArmatures.size() > 1);
+  BLI_task_parallel_range(
+      0, parallelArmatures.size(), &data, armature_pose_task_func, &settings);
+
+  /* The armatures using other objects in their constraints are evaluated after, in the
+   * animated list order, so that the targeted armatures poses are already solved. */
+  for (BL_ArmatureObject *armature : serialArmatures) {
+    armature->EvaluatePendingActions(depsgraph);
+  }
+}
+
+const KX_Scene::AnimationStats &KX_Scene::GetAnimationStats() const
+{
+  return m_animationStats;
+}
+
+void KX_Scene::LogicUpdateFrame(double curtime)
+{
+  PRF_scope(ProfileCategory::GameEngine);
+  m_proxyManager.Update();
+
+  m_logicmgr->UpdateFrame(curtime);
+
+  // Steer the agents of the steering actuators with the velocity avoiding the obstacles.
+  if (m_obstacleSimulation) {
+    m_obstacleSimulation->UpdateAgents();
+  }
+}
+
+void KX_Scene::LogicEndFrame()
+{
+  m_logicmgr->EndFrame();
+
+  /* Don't remove the objects from the euthanasy list here as the child objects of a deleted
+   * parent object are destructed directly from the sgnode in the same time the parent
+   * object is destructed. These child objects must be removed automatically from the
+   * euthanasy list to avoid double deletion in case the user ask to delete the child object
+   * explicitly. NewRemoveObject is the place to do it.
+   */
+  while (!m_euthanasyobjects.empty()) {
+    KX_GameObject *gameobj = m_euthanasyobjects.front();
+    if (!RecycleReplicaObject(gameobj)) {
+      RemoveObject(gameobj);
+    }
+  }
+
+  // prepare obstacle simulation for new frame
+  if (m_obstacleSimulation)
+    m_obstacleSimulation->UpdateObstacles();
+
+  for (KX_FontObject *font : m_fontlist) {
+    font->UpdateTextFromProperty();
+  }
+}
+
+/// Minimum number of scheduled nodes before the families are updated in parallel.
+static const unsigned int PARALLEL_UPDATE_PARENTS_THRESHOLD = 64;
+/// Minimum number of nodes of a work item, a familly is never split between work items.
+static const unsigned int PARALLEL_UPDATE_PARENTS_CHUNK_SIZE = 32;
+
+struct UpdateParentsTaskData {
+  SG_Node *const *nodes;
+  KX_Scene::UpdateParentsChunk *chunks;
+  double curtime;
+};
+
+static void update_parents_task_func(void *__restrict userdata,
+                                     const int iter,
+                                     const TaskParallelTLS *__restrict /*tls*/)
+{
+  UpdateParentsTaskData *data = (UpdateParentsTaskData *)userdata;
+  KX_Scene::UpdateParentsChunk &chunk = data->chunks[iter];
+
+  SG_Node::UpdateWorldDataDeferred(data->nodes + chunk.m_begin,
+                                   chunk.m_end - chunk.m_begin,
+                                   data->curtime,
+                                   chunk.m_callbacks);
+}
+
+/**
+ * UpdateParents: SceneGraph transformation update.
+ */
+void KX_Scene::UpdateParents(double curtime)
+{
+  PRF_scope(ProfileCategory::GameEngine);
+  // we use the SG dynamic list
+  SG_Node *node;
+
+  std::vector<SG_Node *> &scheduled = m_updateParentsNodes;
+  scheduled.clear();
+  for (node = SG_Node::GetNextScheduled(m_sghead); node;
+       node = SG_Node::GetNextScheduled(m_sghead))
+  {
+    scheduled.push_back(node);
+    if (scheduled.size() == PARALLEL_UPDATE_PARENTS_THRESHOLD) {
+      break;
+    }
+  }
+
+  if (scheduled.size() < PARALLEL_UPDATE_PARENTS_THRESHOLD) {
+    for (SG_Node *scheduledNode : scheduled) {
+      scheduledNode->Schedule(m_sghead);
+    }
+  }
+  else {
+    while ((node = SG_Node::GetNextScheduled(m_sghead)) != nullptr) {
+      scheduled.push_back(node);
+    }
+
+    /* Group the nodes by familly, each familly is an independent hierarchy, and cut the
+     * groups in work items of whole families. */
+    std::stable_sort(scheduled.begin(), scheduled.end(), [](SG_Node *a, SG_Node *b) {
+      return a->GetFamilly().get() < b->GetFamilly().get();
+    });
+
+    const unsigned int count = scheduled.size();
+    unsigned int numChunks = 0;
+    for (unsigned int begin = 0, end = 1; end <= count; ++end) {
+      if (end < count && (end - begin < PARALLEL_UPDATE_PARENTS_CHUNK_SIZE ||
+                          scheduled[end]->GetFamilly() == scheduled[end - 1]->GetFamilly()))
+      {
+        continue;
+      }
+      if (numChunks == m_updateParentsChunks.size()) {
+        m_updateParentsChunks.emplace_back();
+      }
+      UpdateParentsChunk &chunk = m_updateParentsChunks[numChunks++];
+      chunk.m_begin = begin;
+      chunk.m_end = end;
+      begin = end;
+    }
+
+    if (numChunks > 1) {
+      UpdateParentsTaskData data = {scheduled.data(), m_updateParentsChunks.data(), curtime};
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.min_iter_per_thread = 1;
+      BLI_task_parallel_range(0, numChunks, &data, update_parents_task_func, &settings);
+
+      /* The client callbacks requested by the work items need the global locks or modify the
+       * physics and render lists, call them once the parallel section is over. */
+      for (unsigned int i = 0; i < numChunks; ++i) {
+        SG_Node::FlushDeferredCallbacks(m_updateParentsChunks[i].m_callbacks);
+      }
+    }
+    else {
+      // Only one work item, restore the scene list and use the common update.
+      for (SG_Node *scheduledNode : scheduled) {
+        scheduledNode->Schedule(m_sghead);
+      }
+    }
+  }
+
+  // Nodes scheduled by the update callbacks are still in the scene list.
+  while ((node = SG_Node::GetNextScheduled(m_sghead)) != nullptr) {
+    node->UpdateWorldData(curtime);
+  }
+
+  // the list must be empty here
+  BLI_assert(m_sghead.Empty());
+  // some nodes may be ready for reschedule, move them to schedule list for next time
+  while ((node = SG_Node::GetNextRescheduled(m_sghead)) != nullptr) {
+    node->Schedule(m_sghead);
+  }
+}
 
 RAS_MaterialBucket *KX_Scene::FindBucket(class RAS_IPolyMaterial *polymat, bool &bucketCreated)
 {
@@ -2471,12 +3016,72 @@ RAS_MaterialBucket *KX_Scene::FindBucket(class RAS_IPolyMaterial *polymat, bool
 
 void KX_Scene::UpdateObjectLods(KX_Camera *cam)
 {
+  PRF_scope(ProfileCategory::GameEngine);
+  const unsigned int count = m_kxobWithLod.size();
+  if (count == 0) {
+    return;
+  }
+
   const MT_Vector3 &cam_pos = cam->NodeGetWorldPosition();
   const float lodfactor = cam->GetLodDistanceFactor();
 
-  for (KX_GameObject *gameobj : m_kxobWithLod) {
-    gameobj->UpdateLod(cam_pos, lodfactor);
+  /* Select the levels of all objects first, from the packed positions and the lod managers
+   * thresholds only. */
+  m_lodPositions.resize(count * 3);
+  m_lodDistances.resize(count);
+  m_lodLevels.resize(count);
+  float *posx = m_lodPositions.data();
+  float *posy = posx + count;
+  float *posz = posy + count;
+  for (unsigned int i = 0; i < count; ++i) {
+    const MT_Vector3 &pos = m_kxobWithLod[i]->NodeGetWorldPosition();
+    posx[i] = pos.x();
+    posy[i] = pos.y();
+    posz[i] = pos.z();
+  }
+
+  const float camx = cam_pos.x();
+  const float camy = cam_pos.y();
+  const float camz = cam_pos.z();
+  const float lodfactor2 = lodfactor * lodfactor;
+  float *distances = m_lodDistances.data();
+  for (unsigned int i = 0; i < count; ++i) {
+    const float dx = posx[i] - camx;
+    const float dy = posy[i] - camy;
+    const float dz = posz[i] - camz;
+    distances[i] = (dx * dx + dy * dy + dz * dz) * lodfactor2;
+  }
+
+  for (unsigned int i = 0; i < count; ++i) {
+    KX_GameObject *gameobj = m_kxobWithLod[i];
+    KX_LodManager *lodManager = gameobj->GetLodManager();
+    if (lodManager) {
+      lodManager->UpdateThresholds(this);
+      m_lodLevels[i] = lodManager->SelectLevel(gameobj->GetCurrentLodLevel(), distances[i]);
+    }
+    else {
+      m_lodLevels[i] = -1;
+    }
   }
+
+  // Then only apply the changed levels, and the levels replacing a reset evaluated mesh.
+  blender::Depsgraph *depsgraph = CTX_data_expect_evaluated_depsgraph(
+      KX_GetActiveEngine()->GetContext());
+  const bool depsgraphUpdated = DEG_get_update_count(depsgraph) != m_lodDepsgraphUpdateCount;
+
+  for (unsigned int i = 0; i < count; ++i) {
+    const short level = m_lodLevels[i];
+    if (level == -1) {
+      continue;
+    }
+
+    KX_GameObject *gameobj = m_kxobWithLod[i];
+    if (level != gameobj->GetCurrentLodLevel() || gameobj->IsLodUpdateNeeded(depsgraphUpdated)) {
+      gameobj->UpdateLod(level, depsgraph);
+    }
+  }
+
+  m_lodDepsgraphUpdateCount = DEG_get_update_count(depsgraph);
 }
 
 void KX_Scene::SetLodHysteresis(bool active)
@@ -2546,6 +3151,269 @@ void KX_Scene::SetNetworkMessageScene(KX_NetworkMessageScene *newScene)
   m_networkMessageScene = newScene;
 }
 
+/// Pack a game property value in little endian, return false if the type is not replicated.
+static bool pack_network_property(EXP_Value *value, std::string &r_data)
+{
+  unsigned long long bits;
+  unsigned int size;
+  switch (value->GetValueType()) {
+    case VALUE_INT_TYPE: {
+      bits = (unsigned long long)static_cast<EXP_IntValue *>(value)->GetInt();
+      size = 8;
+      break;
+    }
+    case VALUE_FLOAT_TYPE: {
+      const float number = static_cast<EXP_FloatValue *>(value)->GetFloat();
+      unsigned int floatBits;
+      memcpy(&floatBits, &number, sizeof(float));
+      bits = floatBits;
+      size = 4;
+      break;
+    }
+    case VALUE_BOOL_TYPE: {
+      bits = static_cast<EXP_BoolValue *>(value)->GetBool() ? 1 : 0;
+      size = 1;
+      break;
+    }
+    case VALUE_STRING_TYPE: {
+      r_data = value->GetText();
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+
+  r_data.resize(size);
+  for (unsigned int i = 0; i < size; ++i) {
+    r_data[i] = (char)((bits >> (i * 8)) & 0xFF);
+  }
+  return true;
+}
+
+/// Create a game property value from its packed data, return nullptr if invalid.
+static EXP_Value *unpack_network_property(const KX_NetworkTransport::Property &property)
+{
+  const std::string &data = property.value;
+  unsigned long long bits = 0;
+  for (unsigned int i = 0, size = std::min<unsigned int>(data.size(), 8); i < size; ++i) {
+    bits |= (unsigned long long)(unsigned char)data[i] << (i * 8);
+  }
+
+  switch (property.type) {
+    case VALUE_INT_TYPE: {
+      if (data.size() != 8) {
+        return nullptr;
+      }
+      return new EXP_IntValue((cInt)bits, property.name);
+    }
+    case VALUE_FLOAT_TYPE: {
+      if (data.size() != 4) {
+        return nullptr;
+      }
+      const unsigned int floatBits = (unsigned int)bits;
+      float number;
+      memcpy(&number, &floatBits, sizeof(float));
+      return new EXP_FloatValue(number, property.name);
+    }
+    case VALUE_BOOL_TYPE: {
+      if (data.size() != 1) {
+        return nullptr;
+      }
+      return new EXP_BoolValue(bits != 0, property.name);
+    }
+    case VALUE_STRING_TYPE: {
+      return new EXP_StringValue(data, property.name);
+    }
+  }
+
+  return nullptr;
+}
+
+void KX_Scene::RegisterNetworkObject(KX_GameObject *gameobj, bool spawned)
+{
+  const unsigned int id = ++m_lastNetworkId;
+  gameobj->SetNetworkId(id);
+  m_networkObjects[id] = {gameobj, spawned};
+}
+
+void KX_Scene::UnregisterNetworkObject(KX_GameObject *gameobj)
+{
+  const unsigned int id = gameobj->GetNetworkId();
+
+  // Object of a client bound to an id of the server.
+  const auto remoteIt = m_remoteNetworkObjects.find(id);
+  if (remoteIt != m_remoteNetworkObjects.end() && remoteIt->second.object == gameobj) {
+    m_remoteNetworkObjects.erase(remoteIt);
+    gameobj->SetNetworkId(0);
+    return;
+  }
+
+  const auto it = m_networkObjects.find(id);
+  if (it == m_networkObjects.end() || it->second.object != gameobj) {
+    return;
+  }
+
+  m_networkObjects.erase(it);
+  gameobj->SetNetworkId(0);
+
+  // The id isn't reused, forget the properties sent for the object and remove it from the peers.
+  KX_NetworkTransport *transport =
+      m_networkMessageScene->GetMessageManager()->GetTransport();
+  if (transport) {
+    transport->RemoveObject(GetName(), id);
+  }
+}
+
+void KX_Scene::BindNetworkObject(unsigned int id, const std::string &name, bool spawned)
+{
+  if (m_remoteNetworkObjects.find(id) != m_remoteNetworkObjects.end()) {
+    return;
+  }
+
+  KX_GameObject *gameobj = nullptr;
+  if (spawned) {
+    KX_GameObject *original = m_inactivelist->FindValue(name);
+    if (!original) {
+      return;
+    }
+    gameobj = AddReplicaObject(original, nullptr, 0);
+    // release here because AddReplicaObject AddRef's, the object list keeps a reference.
+    gameobj->Release();
+  }
+  else {
+    for (KX_GameObject *candidate : m_objectlist) {
+      const auto it = m_networkObjects.find(candidate->GetNetworkId());
+      if (it != m_networkObjects.end() && it->second.object == candidate &&
+          candidate->GetName() == name)
+      {
+        gameobj = candidate;
+        break;
+      }
+    }
+    if (!gameobj) {
+      return;
+    }
+  }
+
+  // The object now uses the id of the server.
+  m_networkObjects.erase(gameobj->GetNetworkId());
+  gameobj->SetNetworkId(id);
+  m_remoteNetworkObjects[id] = {gameobj, spawned};
+}
+
+void KX_Scene::UnbindNetworkObject(unsigned int id)
+{
+  const auto it = m_remoteNetworkObjects.find(id);
+  if (it == m_remoteNetworkObjects.end()) {
+    return;
+  }
+
+  const NetworkObject object = it->second;
+  m_remoteNetworkObjects.erase(it);
+  object.object->SetNetworkId(0);
+
+  if (object.spawned) {
+    DelayedRemoveObject(object.object);
+  }
+}
+
+void KX_Scene::ReplicateNetworkProperties()
+{
+  KX_NetworkTransport *transport =
+      m_networkMessageScene->GetMessageManager()->GetTransport();
+  // The server is the authority of the network ids and the replicated properties.
+  if (!transport || !transport->IsServer()) {
+    return;
+  }
+
+  KX_NetworkTransport::Object object;
+  object.scene = GetName();
+  object.removed = false;
+  KX_NetworkTransport::Property property;
+  property.scene = object.scene;
+  for (const auto &pair : m_networkObjects) {
+    KX_GameObject *gameobj = pair.second.object;
+    const std::vector<std::string> &names = gameobj->GetReplicatedProperties();
+    if (names.empty()) {
+      continue;
+    }
+
+    float position[3];
+    const bool hasPosition = gameobj->GetNetworkPosition(position);
+
+    // Bind the id to the object on the clients before sending its properties.
+    object.object = pair.first;
+    object.name = gameobj->GetName();
+    object.spawned = pair.second.spawned;
+    transport->QueueObject(object, hasPosition ? position : nullptr);
+
+    property.object = pair.first;
+    for (const std::string &name : names) {
+      EXP_Value *value = gameobj->GetProperty(name);
+      if (!value || !pack_network_property(value, property.value)) {
+        continue;
+      }
+      property.name = name;
+      property.type = value->GetValueType();
+      transport->QueueProperty(property, hasPosition ? position : nullptr);
+    }
+  }
+}
+
+void KX_Scene::ApplyNetworkProperties()
+{
+  KX_NetworkTransport *transport =
+      m_networkMessageScene->GetMessageManager()->GetTransport();
+  if (!transport || transport->IsServer()) {
+    return;
+  }
+
+  const std::string name = GetName();
+  for (const KX_NetworkTransport::Object &object : transport->GetReceivedObjects()) {
+    if (object.scene != name) {
+      continue;
+    }
+
+    if (object.removed) {
+      UnbindNetworkObject(object.object);
+    }
+    else {
+      BindNetworkObject(object.object, object.name, object.spawned);
+    }
+  }
+
+  for (const KX_NetworkTransport::Property &property : transport->GetReceivedProperties()) {
+    if (property.scene != name) {
+      continue;
+    }
+
+    const auto it = m_remoteNetworkObjects.find(property.object);
+    if (it == m_remoteNetworkObjects.end()) {
+      continue;
+    }
+    KX_GameObject *gameobj = it->second.object;
+    // The peers can only change the properties the client replicates.
+    if (!gameobj->IsReplicatedProperty(property.name)) {
+      continue;
+    }
+
+    EXP_Value *value = unpack_network_property(property);
+    if (!value) {
+      continue;
+    }
+
+    EXP_Value *oldprop = gameobj->GetProperty(property.name);
+    if (oldprop && oldprop->GetValueType() == value->GetValueType()) {
+      oldprop->SetValue(value);
+    }
+    else {
+      gameobj->SetProperty(property.name, value);
+    }
+    value->Release();
+  }
+}
+
 void KX_Scene::SetGravity(const MT_Vector3 &gravity)
 {
   GetPhysicsEnvironment()->SetGravity(gravity[0], gravity[1], gravity[2]);
@@ -2649,6 +3517,96 @@ static void MergeScene_GameObject(KX_GameObject *gameobj, KX_Scene *to, KX_Scene
   }
 }
 
+bool KX_Scene::MergeSceneObjects(KX_Scene *other, double budget)
+{
+  PRF_scope(ProfileCategory::GameEngine);
+
+  // Incompatible physics are reported by MergeScene.
+  if ((GetPhysicsEnvironment() == nullptr) != (other->GetPhysicsEnvironment() == nullptr)) {
+    return true;
+  }
+
+  const double endtime = BLI_time_now_seconds() + budget;
+
+  GetBucketManager()->MergeBucketManager(other->GetBucketManager());
+
+  /* The hierarchies using rigid body constraints are left to MergeScene which replicates the
+   * constraints once all their targets are in the physics environment. */
+  std::unordered_set<std::string> constrainedNames;
+  for (KX_GameObject *gameobj : *other->GetObjectList()) {
+    for (blender::bRigidBodyJointConstraint *dat : gameobj->GetConstraints()) {
+      constrainedNames.insert(gameobj->GetName());
+      if (dat->tar) {
+        constrainedNames.insert(dat->tar->id.name + 2);
+      }
+    }
+  }
+
+  // Active hierarchies first, then the inactive ones.
+  std::vector<KX_GameObject *> roots;
+  for (KX_GameObject *gameobj : *other->GetRootParentList()) {
+    roots.push_back(gameobj);
+  }
+  const unsigned int activeRoots = roots.size();
+  for (KX_GameObject *gameobj : *other->GetInactiveList()) {
+    if (!gameobj->GetParent()) {
+      roots.push_back(gameobj);
+    }
+  }
+
+  bool finished = true;
+  for (unsigned int i = 0, size = roots.size(); i < size; ++i) {
+    std::vector<KX_GameObject *> hierarchy = roots[i]->GetChildrenRecursive();
+    hierarchy.push_back(roots[i]);
+
+    if (!constrainedNames.empty() &&
+        std::any_of(hierarchy.begin(),
+                    hierarchy.end(),
+                    [&constrainedNames](KX_GameObject *gameobj) {
+                      return constrainedNames.count(gameobj->GetName()) != 0;
+                    }))
+    {
+      continue;
+    }
+
+    for (KX_GameObject *gameobj : hierarchy) {
+      MergeScene_GameObject(gameobj, this, other);
+
+      // Timers of the merged objects must run before the end of the merge.
+      for (int j = 0, numprops = gameobj->GetPropertyCount(); j < numprops; ++j) {
+        EXP_Value *prop = gameobj->GetProperty(j);
+        if (prop->GetProperty(timerPropKey)) {
+          other->GetTimeEventManager()->MoveTimeProperty(prop, GetTimeEventManager());
+        }
+      }
+
+      if (i < activeRoots) {
+        RegisterNetworkObject(gameobj);
+        if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::AUTO_ADD_DEBUG_PROPERTIES)) {
+          AddObjectDebugProperties(gameobj);
+        }
+      }
+    }
+
+    // Always merge at least one hierarchy per call.
+    if (BLI_time_now_seconds() >= endtime && i + 1 < size) {
+      finished = false;
+      break;
+    }
+  }
+
+  // The merged objects now use this scene as scene graph client, move them in its lists.
+  const auto merged = [this](KX_GameObject *gameobj) { return gameobj->GetScene() == this; };
+  other->GetObjectList()->MoveIf(GetObjectList(), merged);
+  other->GetInactiveList()->MoveIf(GetInactiveList(), merged);
+  other->GetRootParentList()->MoveIf(GetRootParentList(), merged);
+  other->GetLightList()->MoveIf(GetLightList(), merged);
+  other->GetCameraList()->MoveIf(GetCameraList(), merged);
+  other->GetFontList()->MoveIf(GetFontList(), merged);
+
+  return finished;
+}
+
 bool KX_Scene::MergeScene(KX_Scene *other)
 {
   PHY_IPhysicsEnvironment *env = this->GetPhysicsEnvironment();
@@ -2668,6 +3626,7 @@ bool KX_Scene::MergeScene(KX_Scene *other)
   /* active + inactive == all ??? - lets hope so */
   for (KX_GameObject *gameobj : *other->GetObjectList()) {
     MergeScene_GameObject(gameobj, this, other);
+    RegisterNetworkObject(gameobj);
 
     /* add properties to debug list for LibLoad objects */
     if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::AUTO_ADD_DEBUG_PROPERTIES)) {
@@ -2847,6 +3806,7 @@ PyTypeObject KX_Scene::Type = {PyVarObject_HEAD_INIT(nullptr, 0) "KX_Scene",
 
 PyMethodDef KX_Scene::Methods[] = {
     EXP_PYMETHODTABLE(KX_Scene, addObject),
+    EXP_PYMETHODTABLE(KX_Scene, preallocate),
     EXP_PYMETHODTABLE(KX_Scene, end),
     EXP_PYMETHODTABLE(KX_Scene, restart),
     EXP_PYMETHODTABLE(KX_Scene, replace),
@@ -2859,6 +3819,7 @@ PyMethodDef KX_Scene::Methods[] = {
     EXP_PYMETHODTABLE(KX_Scene, addOverlayCollection),
     EXP_PYMETHODTABLE(KX_Scene, removeOverlayCollection),
     EXP_PYMETHODTABLE(KX_Scene, getGameObjectFromObject),
+    EXP_PYMETHODTABLE(KX_Scene, rayCastBatch),
 
     /* dict style access */
     EXP_PYMETHODTABLE(KX_Scene, get),
@@ -3155,6 +4116,67 @@ int KX_Scene::pyattr_set_remove_callback(EXP_PyObjectPlus *self_v,
   return PY_SET_ATTR_SUCCESS;
 }
 
+PyObject *KX_Scene::pyattr_get_animation_lod_levels(EXP_PyObjectPlus *self_v,
+                                                     const EXP_PYATTRIBUTE_DEF *attrdef)
+{
+  KX_Scene *self = static_cast<KX_Scene *>(self_v);
+
+  PyObject *levels = PyList_New(self->m_animationLodLevels.size());
+  for (unsigned int i = 0, size = self->m_animationLodLevels.size(); i < size; ++i) {
+    const std::pair<float, unsigned short> &level = self->m_animationLodLevels[i];
+    PyList_SET_ITEM(levels, i, Py_BuildValue("(fi)", sqrtf(level.first), level.second));
+  }
+
+  return levels;
+}
+
+int KX_Scene::pyattr_set_animation_lod_levels(EXP_PyObjectPlus *self_v,
+                                              const EXP_PYATTRIBUTE_DEF *attrdef,
+                                              PyObject *value)
+{
+  KX_Scene *self = static_cast<KX_Scene *>(self_v);
+
+  PyObject *seq = PySequence_Fast(value, "");
+  if (!seq) {
+    PyErr_Format(PyExc_TypeError,
+                 "scene.%s = levels: KX_Scene, expected a sequence of (distance, divisor)",
+                 attrdef->m_name.c_str());
+    return PY_SET_ATTR_FAIL;
+  }
+
+  std::vector<std::pair<float, unsigned short>> levels;
+  for (unsigned int i = 0, size = PySequence_Fast_GET_SIZE(seq); i < size; ++i) {
+    float distance;
+    int divisor;
+    if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i), "fi", &distance, &divisor) ||
+        distance < 0.0f || divisor < 1 || divisor > USHRT_MAX)
+    {
+      PyErr_Clear();
+      PyErr_Format(PyExc_ValueError,
+                   "scene.%s = levels: KX_Scene, expected (distance >= 0, divisor >= 1) tuples",
+                   attrdef->m_name.c_str());
+      Py_DECREF(seq);
+      return PY_SET_ATTR_FAIL;
+    }
+    levels.emplace_back(distance * distance, divisor);
+  }
+  Py_DECREF(seq);
+
+  std::sort(levels.begin(), levels.end());
+  self->m_animationLodLevels = levels;
+
+  return PY_SET_ATTR_SUCCESS;
+}
+
+PyObject *KX_Scene::pyattr_get_animation_stats(EXP_PyObjectPlus *self_v,
+                                               const EXP_PYATTRIBUTE_DEF *attrdef)
+{
+  KX_Scene *self = static_cast<KX_Scene *>(self_v);
+
+  const AnimationStats &stats = self->m_animationStats;
+  return Py_BuildValue("(III)", stats.m_evaluated, stats.m_culled, stats.m_skipped);
+}
+
 PyObject *KX_Scene::pyattr_get_gravity(EXP_PyObjectPlus *self_v,
                                        const EXP_PYATTRIBUTE_DEF *attrdef)
 {
@@ -3201,6 +4223,13 @@ PyAttributeDef KX_Scene::Attributes[] = {
         "pre_draw_setup", KX_Scene, pyattr_get_drawing_callback, pyattr_set_drawing_callback),
     EXP_PYATTRIBUTE_RW_FUNCTION("gravity", KX_Scene, pyattr_get_gravity, pyattr_set_gravity),
     EXP_PYATTRIBUTE_BOOL_RO("activityCulling", KX_Scene, m_activityCulling),
+    EXP_PYATTRIBUTE_BOOL_RW("animationLod", KX_Scene, m_animationLod),
+    EXP_PYATTRIBUTE_BOOL_RW("animationLodCulling", KX_Scene, m_animationLodCulling),
+    EXP_PYATTRIBUTE_RW_FUNCTION("animationLodLevels",
+                                KX_Scene,
+                                pyattr_get_animation_lod_levels,
+                                pyattr_set_animation_lod_levels),
+    EXP_PYATTRIBUTE_RO_FUNCTION("animationStats", KX_Scene, pyattr_get_animation_stats),
     EXP_PYATTRIBUTE_BOOL_RO("dbvt_culling", KX_Scene, m_dbvt_culling),
     EXP_PYATTRIBUTE_RO_FUNCTION("logger", KX_Scene, KX_PythonProxy::pyattr_get_logger),
     EXP_PYATTRIBUTE_RO_FUNCTION("loggerName", KX_Scene, KX_PythonProxy::pyattr_get_logger_name),
@@ -3261,6 +4290,47 @@ EXP_PYMETHODDEF_DOC(KX_Scene,
   return replica->GetProxy();
 }
 
+EXP_PYMETHODDEF_DOC(KX_Scene,
+                    preallocate,
+                    "preallocate(object, count)\n"
+                    "Creates dormant replicas of an object reused by the next addObject calls.\n")
+{
+  PyObject *pyob;
+  KX_GameObject *ob;
+  int count;
+
+  if (!PyArg_ParseTuple(args, "Oi:preallocate", &pyob, &count)) {
+    return nullptr;
+  }
+
+  if (!ConvertPythonToGameObject(
+          m_logicmgr, pyob, &ob, false, "scene.preallocate(object, count): KX_Scene")) {
+    return nullptr;
+  }
+
+  if (!m_inactivelist->SearchValue(ob)) {
+    PyErr_SetString(PyExc_ValueError,
+                    "scene.preallocate(object, count): KX_Scene: object must be in an inactive "
+                    "layer");
+    return nullptr;
+  }
+
+  if (count < 0) {
+    PyErr_SetString(PyExc_ValueError,
+                    "scene.preallocate(object, count): KX_Scene: count must be positive");
+    return nullptr;
+  }
+
+  if (!PreallocateObjects(ob, count)) {
+    PyErr_SetString(PyExc_ValueError,
+                    "scene.preallocate(object, count): KX_Scene: object can't be pooled, it must "
+                    "be a single mesh or empty object without components");
+    return nullptr;
+  }
+
+  Py_RETURN_NONE;
+}
+
 EXP_PYMETHODDEF_DOC(KX_Scene,
                     end,
                     "end()\n"
@@ -3565,6 +4635,199 @@ EXP_PYMETHODDEF_DOC(KX_Scene,
   Py_RETURN_NONE;
 }
 
+/** Read 3D points from a contiguous buffer of floats or doubles (e.g a numpy array of shape
+ * (n, 3)) or from a sequence of vectors.
+ */
+static bool py_ray_points_from(PyObject *value,
+                               std::vector<MT_Vector3> &points,
+                               const char *error_prefix)
+{
+  if (PyObject_CheckBuffer(value)) {
+    Py_buffer view;
+    if (PyObject_GetBuffer(value, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == -1) {
+      return false;
+    }
+
+    const char *format = view.format;
+    if (format[0] == '@' || format[0] == '=') {
+      ++format;
+    }
+    const bool isFloat = STREQ(format, "f");
+    const bool isDouble = STREQ(format, "d");
+    if ((!isFloat && !isDouble) || (view.len / view.itemsize) % 3 != 0) {
+      PyErr_Format(PyExc_ValueError,
+                   "%s, expected a buffer of 3D points of float or double",
+                   error_prefix);
+      PyBuffer_Release(&view);
+      return false;
+    }
+
+    const unsigned int count = view.len / view.itemsize / 3;
+    points.resize(count);
+    for (unsigned int i = 0; i < count; ++i) {
+      if (isFloat) {
+        points[i] = MT_Vector3((const float *)view.buf + i * 3);
+      }
+      else {
+        points[i] = MT_Vector3((const double *)view.buf + i * 3);
+      }
+    }
+
+    PyBuffer_Release(&view);
+    return true;
+  }
+
+  PyObject *fast = PySequence_Fast(value, error_prefix);
+  if (!fast) {
+    return false;
+  }
+
+  const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast);
+  PyObject **items = PySequence_Fast_ITEMS(fast);
+  points.resize(size);
+  for (Py_ssize_t i = 0; i < size; ++i) {
+    if (!PyVecTo(items[i], points[i])) {
+      Py_DECREF(fast);
+      return false;
+    }
+  }
+
+  Py_DECREF(fast);
+  return true;
+}
+
+/// Return a memoryview of format \a format and shape (count, width) owning a copy of \a data.
+static PyObject *py_ray_memoryview_from(const void *data,
+                                        unsigned int count,
+                                        unsigned int width,
+                                        unsigned int itemsize,
+                                        const char *format)
+{
+  PyObject *bytes = PyByteArray_FromStringAndSize((const char *)data, count * width * itemsize);
+  if (!bytes) {
+    return nullptr;
+  }
+
+  PyObject *view = PyMemoryView_FromObject(bytes);
+  Py_DECREF(bytes);
+  if (!view) {
+    return nullptr;
+  }
+
+  PyObject *result;
+  // A memoryview can't be cast to a shape containing zero.
+  if (count == 0) {
+    result = PyObject_CallMethod(view, "cast", "s", format);
+  }
+  else if (width == 1) {
+    result = PyObject_CallMethod(view, "cast", "s(I)", format, count);
+  }
+  else {
+    result = PyObject_CallMethod(view, "cast", "s(II)", format, count, width);
+  }
+  Py_DECREF(view);
+
+  return result;
+}
+
+EXP_PYMETHODDEF_DOC(KX_Scene,
+                    rayCastBatch,
+                    "rayCastBatch(origins, targets, mask=0xFFFF)\n"
+                    "Casts rays from origins[i] to targets[i] and returns the tuple\n"
+                    "(positions, normals, indices, distances, objects).\n")
+{
+  PyObject *pyorigins;
+  PyObject *pytargets;
+  int mask = (1 << OB_MAX_COL_MASKS) - 1;
+
+  if (!PyArg_ParseTuple(args, "OO|i:rayCastBatch", &pyorigins, &pytargets, &mask)) {
+    return nullptr;
+  }
+
+  std::vector<MT_Vector3> origins;
+  std::vector<MT_Vector3> targets;
+  if (!py_ray_points_from(
+          pyorigins, origins, "scene.rayCastBatch(origins, targets, mask): KX_Scene, origins") ||
+      !py_ray_points_from(
+          pytargets, targets, "scene.rayCastBatch(origins, targets, mask): KX_Scene, targets")) {
+    return nullptr;
+  }
+
+  if (origins.size() != targets.size()) {
+    PyErr_SetString(PyExc_ValueError,
+                    "scene.rayCastBatch(origins, targets, mask): KX_Scene, origins and targets "
+                    "must have the same length");
+    return nullptr;
+  }
+
+  if (mask == 0 || mask & ~((1 << OB_MAX_COL_MASKS) - 1)) {
+    PyErr_Format(PyExc_ValueError,
+                 "scene.rayCastBatch(origins, targets, mask): KX_Scene, mask argument must be a "
+                 "int bitfield, 0 < mask < %i",
+                 (1 << OB_MAX_COL_MASKS));
+    return nullptr;
+  }
+
+  const unsigned int count = origins.size();
+  std::vector<PHY_RayCastBatchResult> results(count);
+  if (m_physicsEnvironment && count > 0) {
+    m_physicsEnvironment->RayTestBatch(
+        origins.data(), targets.data(), count, (unsigned short)mask, results.data());
+  }
+
+  std::vector<float> positions(count * 3, 0.0f);
+  std::vector<float> normals(count * 3, 0.0f);
+  std::vector<int> indices(count, -1);
+  std::vector<float> distances(count, -1.0f);
+  // The hit objects and their index in the returned list.
+  std::vector<KX_GameObject *> objects;
+  std::unordered_map<KX_GameObject *, int> objectIndices;
+
+  for (unsigned int i = 0; i < count; ++i) {
+    const PHY_RayCastBatchResult &result = results[i];
+    if (!result.m_controller) {
+      continue;
+    }
+
+    KX_GameObject *gameobj = KX_GameObject::GetClientObject(
+        static_cast<KX_ClientObjectInfo *>(result.m_controller->GetNewClientInfo()));
+    if (!gameobj) {
+      continue;
+    }
+
+    const auto it = objectIndices.emplace(gameobj, objects.size()).first;
+    if (it->second == (int)objects.size()) {
+      objects.push_back(gameobj);
+    }
+
+    result.m_hitPoint.getValue(&positions[i * 3]);
+    result.m_hitNormal.getValue(&normals[i * 3]);
+    indices[i] = it->second;
+    distances[i] = result.m_distance;
+  }
+
+  PyObject *pyobjects = PyList_New(objects.size());
+  for (unsigned int i = 0, size = objects.size(); i < size; ++i) {
+    PyList_SET_ITEM(pyobjects, i, objects[i]->GetProxy());
+  }
+
+  PyObject *items[4] = {
+      py_ray_memoryview_from(positions.data(), count, 3, sizeof(float), "f"),
+      py_ray_memoryview_from(normals.data(), count, 3, sizeof(float), "f"),
+      py_ray_memoryview_from(indices.data(), count, 1, sizeof(int), "i"),
+      py_ray_memoryview_from(distances.data(), count, 1, sizeof(float), "f")};
+
+  if (!items[0] || !items[1] || !items[2] || !items[3]) {
+    for (PyObject *item : items) {
+      Py_XDECREF(item);
+    }
+    Py_DECREF(pyobjects);
+    return nullptr;
+  }
+
+  return Py_BuildValue("(NNNNN)", items[0], items[1], items[2], items[3], pyobjects);
+}
+
 bool ConvertPythonToScene(PyObject *value,
                           KX_Scene **scene,
                           bool py_none_ok,
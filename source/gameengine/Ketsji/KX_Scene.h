@@ -103,6 +103,23 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
  public:
   enum DrawingCallbackType { PRE_DRAW = 0, POST_DRAW, PRE_DRAW_SETUP, MAX_DRAW_CALLBACK };
 
+  /// Statistics of the last animation update.
+  struct AnimationStats {
+    /// Objects with their actions applied.
+    unsigned int m_evaluated;
+    /// Objects outside of the camera frustums, their armature pose evaluation was skipped.
+    unsigned int m_culled;
+    /// Objects not updated because of their update rate.
+    unsigned int m_skipped;
+  };
+
+  /// Work item of the parallel scene graph update, a range of whole families.
+  struct UpdateParentsChunk {
+    unsigned int m_begin;
+    unsigned int m_end;
+    SG_DeferredCallbacks m_callbacks;
+  };
+
  private:
   Py_Header
 
@@ -122,6 +139,13 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   BL_SceneConverter *m_sceneConverter;
   bool m_isPythonMainLoop;
   std::vector<KX_GameObject *> m_kxobWithLod;
+  /** Positions of the objects with lod, packed as all x, all y then all z to compute the
+   * distances to the camera in a vectorizable loop. */
+  std::vector<float> m_lodPositions;
+  std::vector<float> m_lodDistances;
+  std::vector<short> m_lodLevels;
+  /// Depsgraph update count after the last lod update, to detect the evaluated meshes reset.
+  uint64_t m_lodDepsgraphUpdateCount;
   std::map<blender::Object *, short> m_obVisibilityFlag;
   bool m_collectionRemap;
   std::vector<BackupObj *> m_backupObList;
@@ -168,6 +192,13 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
                       // the Qlist is for objects that needs to be rescheduled
                       // for updates after udpate is over (slow parent, bone parent)
 
+  /// List of nodes with SG_Node::DIRTY_RENDER set, synchronized with the depsgraph.
+  SG_DList m_renderhead;
+
+  /// Scheduled nodes sorted by familly and their chunks, kept to reuse the memory.
+  std::vector<SG_Node *> m_updateParentsNodes;
+  std::vector<UpdateParentsChunk> m_updateParentsChunks;
+
   /**
    * Various SCA managers used by the scene
    */
@@ -237,6 +268,27 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
    */
   std::set<KX_GameObject *> m_groupGameObjects;
 
+  /**
+   * Dormant replicas of inactive objects, reused by AddReplicaObject instead of creating
+   * new replicas. Each dormant replica is owned by its pool, see PreallocateObjects.
+   */
+  std::map<KX_GameObject *, std::vector<KX_GameObject *>> m_replicaPools;
+  /// The original object of all the replicas belonging to a pool, active or dormant.
+  std::map<KX_GameObject *, KX_GameObject *> m_pooledReplicas;
+
+  /// Active object known by the network transport.
+  struct NetworkObject {
+    KX_GameObject *object;
+    /// Replica added during the game, see KX_NetworkTransport::Object.
+    bool spawned;
+  };
+  /// Last network id given to an object of the scene.
+  unsigned int m_lastNetworkId;
+  /// Active objects by the network id given by the scene, the ids a server sends.
+  std::map<unsigned int, NetworkObject> m_networkObjects;
+  /// Objects of a client by the network id given by the server, receiving its properties.
+  std::map<unsigned int, NetworkObject> m_remoteNetworkObjects;
+
   /**
    * Pointer to system variable passed in in constructor
    * only used in constructor so we do not need to keep it
@@ -255,6 +307,19 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
    */
   bool m_activityCulling;
 
+  /// Animation level of detail: the actions far from the cameras are updated less often.
+  bool m_animationLod;
+  /// Only update the actions time of the objects outside of all the camera frustums.
+  bool m_animationLodCulling;
+  /// Squared camera distances and the update rate divisor used from them, sorted by distance.
+  std::vector<std::pair<float, unsigned short>> m_animationLodLevels;
+  /// Number of animation updates, used with the object phase to spread the divided updates.
+  unsigned int m_animationFrame;
+  /// Phase given to the next animated object.
+  unsigned short m_animationNextPhase;
+  /// Statistics of the last animation update.
+  AnimationStats m_animationStats;
+
   /**
    * Toggle to enable or disable culling via DBVT broadphase of Bullet.
    */
@@ -387,6 +452,7 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
    */
   static bool KX_ScenegraphUpdateFunc(SG_Node *node, void *gameobj, void *scene);
   static bool KX_ScenegraphRescheduleFunc(SG_Node *node, void *gameobj, void *scene);
+  static bool KX_ScenegraphRenderFunc(SG_Node *node, void *gameobj, void *scene);
   void UpdateParents(double curtime);
 
   /* Warning: This is different from upbge dupli instances
@@ -399,9 +465,28 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
             m_groupGameObjects.find(gameobj) != m_groupGameObjects.end());
   }
   void AddObjectDebugProperties(KX_GameObject *gameobj);
+  /**
+   * Create dormant replicas of an inactive object, used by the next AddReplicaObject
+   * calls for this object. The removed replicas return in the pool.
+   * \return False if the replicas of this object can't be pooled.
+   */
+  bool PreallocateObjects(KX_GameObject *gameobj, unsigned int count);
+  /// Add a replica of an object, reusing a dormant replica when the object has a pool.
   KX_GameObject *AddReplicaObject(KX_GameObject *gameobj,
                                   KX_GameObject *locationobj,
                                   float lifespan = 0.0f);
+  KX_GameObject *NewReplicaObject(KX_GameObject *gameobj,
+                                  KX_GameObject *locationobj,
+                                  float lifespan);
+  KX_GameObject *ReuseReplicaObject(KX_GameObject *gameobj,
+                                    KX_GameObject *locationobj,
+                                    float lifespan);
+  /// Put a removed replica back in its pool, return false if the object must be destructed.
+  bool RecycleReplicaObject(KX_GameObject *gameobj);
+  /// Free the dormant replicas of an object.
+  void FreeReplicaPool(KX_GameObject *gameobj);
+  /// Exclude a replica from its pool, used when its state can't be reset to the original one.
+  void UnpoolReplicaObject(KX_GameObject *gameobj);
   KX_GameObject *AddNodeReplicaObject(SG_Node *node, KX_GameObject *gameobj);
 
   void RemoveNodeDestructObject(SG_Node *node, KX_GameObject *gameobj);
@@ -410,6 +495,8 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   void DelayedRemoveObject(KX_GameObject *gameobj);
 
   bool NewRemoveObject(KX_GameObject *gameobj);
+  /// Remove the logic bricks and the timer properties of an object from the managers.
+  void UnregisterObjectLogic(KX_GameObject *gameobj);
   void ReplaceMesh(KX_GameObject *gameobj, RAS_MeshObject *mesh, bool use_gfx, bool use_phys);
 
   void AddAnimatedObject(KX_GameObject *gameobj);
@@ -421,6 +508,12 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   void LogicBeginFrame(double curtime, double framestep);
   void LogicUpdateFrame(double curtime);
   void UpdateAnimations(double curtime);
+  /// Update the actions with the animation level of detail.
+  void UpdateAnimationsLod(double curtime);
+  /// Evaluate the armature poses deferred by the action updates, in parallel when possible.
+  void UpdateArmaturePoses();
+
+  const AnimationStats &GetAnimationStats() const;
 
   void LogicEndFrame();
 
@@ -479,6 +572,26 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   void SetNetworkMessageScene(KX_NetworkMessageScene *newScene);
   KX_NetworkMessageScene *GetNetworkMessageScene();
 
+  /** Give a new network id to an active object. The ids given by a server are sent to the
+   * clients with the name of the objects, see BindNetworkObject.
+   * \param spawned The object is a replica added during the game.
+   */
+  void RegisterNetworkObject(KX_GameObject *gameobj, bool spawned = false);
+  void UnregisterNetworkObject(KX_GameObject *gameobj);
+  /** Bind an object of a client to the network id given by the server. A spawned object is a
+   * new replica of the inactive object of the same name, else the first active object of the
+   * same name not bound yet.
+   */
+  void BindNetworkObject(unsigned int id, const std::string &name, bool spawned);
+  /// Unbind an object removed by the server, the replicas added for the server are removed.
+  void UnbindNetworkObject(unsigned int id);
+
+  /// Queue the replicated game properties of the objects in the network transport of a server.
+  void ReplicateNetworkProperties();
+  /// Apply the properties received by the network transport of a client to the replicated
+  /// properties of the objects.
+  void ApplyNetworkProperties();
+
   /// \section Debug draw.
   void RenderDebugProperties(RAS_DebugDraw &debugDraw,
                              int xindent,
@@ -570,6 +683,7 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   /* --------------------------------------------------------------------- */
 
   EXP_PYMETHOD_DOC(KX_Scene, addObject);
+  EXP_PYMETHOD_DOC(KX_Scene, preallocate);
   EXP_PYMETHOD_DOC(KX_Scene, end);
   EXP_PYMETHOD_DOC(KX_Scene, restart);
   EXP_PYMETHOD_DOC(KX_Scene, replace);
@@ -583,6 +697,7 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   EXP_PYMETHOD_DOC(KX_Scene, addOverlayCollection);
   EXP_PYMETHOD_DOC(KX_Scene, removeOverlayCollection);
   EXP_PYMETHOD_DOC(KX_Scene, getGameObjectFromObject);
+  EXP_PYMETHOD_DOC(KX_Scene, rayCastBatch);
 
   /* attributes */
   static PyObject *pyattr_get_name(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
@@ -616,6 +731,13 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
   static int pyattr_set_remove_callback(EXP_PyObjectPlus *self_v,
                                         const EXP_PYATTRIBUTE_DEF *attrdef,
                                         PyObject *value);
+  static PyObject *pyattr_get_animation_lod_levels(EXP_PyObjectPlus *self_v,
+                                                   const EXP_PYATTRIBUTE_DEF *attrdef);
+  static int pyattr_set_animation_lod_levels(EXP_PyObjectPlus *self_v,
+                                             const EXP_PYATTRIBUTE_DEF *attrdef,
+                                             PyObject *value);
+  static PyObject *pyattr_get_animation_stats(EXP_PyObjectPlus *self_v,
+                                              const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_gravity(EXP_PyObjectPlus *self_v,
                                       const EXP_PYATTRIBUTE_DEF *attrdef);
   static int pyattr_set_gravity(EXP_PyObjectPlus *self_v,
@@ -641,7 +763,18 @@ class KX_Scene : public KX_PythonProxy, public SCA_IScene {
     return m_blenderScene;
   }
 
+  /** Merge an other scene, its objects and logic are moved to this scene and it must be
+   * deleted after.
+   * \return False if the scenes can't be merged.
+   */
   bool MergeScene(KX_Scene *other);
+  /** Merge the object hierarchies of an other scene until the time budget is exhausted, at
+   * least one hierarchy is merged per call. The hierarchies using rigid body constraints and the
+   * scene data are left to \see MergeScene which must be called to finish the merge.
+   * \param budget The time budget in seconds.
+   * \return True when all the hierarchies which can be merged incrementally are merged.
+   */
+  bool MergeSceneObjects(KX_Scene *other, double budget);
 
   // void PrintStats(int verbose_level) {
   //	m_bucketmanager->PrintStats(verbose_level)
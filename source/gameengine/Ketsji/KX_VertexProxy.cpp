@@ -39,6 +39,7 @@
 #  include "KX_PyMath.h"
 #  include "RAS_IDisplayArray.h"
 #  include "RAS_IVertex.h"
+#  include "RAS_MeshObject.h"
 
 using namespace blender;
 
@@ -114,6 +115,7 @@ PyAttributeDef KX_VertexProxy::Attributes[] = {
     EXP_PYATTRIBUTE_RO_FUNCTION("color", KX_VertexProxy, pyattr_get_color),
     EXP_PYATTRIBUTE_RO_FUNCTION("colors", KX_VertexProxy, pyattr_get_colors),
     EXP_PYATTRIBUTE_RO_FUNCTION("normal", KX_VertexProxy, pyattr_get_normal),
+    EXP_PYATTRIBUTE_RO_FUNCTION("tangent", KX_VertexProxy, pyattr_get_tangent),
 
     EXP_PYATTRIBUTE_NULL  // Sentinel
 };
@@ -305,8 +307,17 @@ PyObject *KX_VertexProxy::pyattr_get_normal(EXP_PyObjectPlus *self_v,
   return PyObjectFrom(MT_Vector3(self->m_vertex->getNormal()));
 }
 
-KX_VertexProxy::KX_VertexProxy(RAS_IDisplayArray *array, RAS_IVertex *vertex)
-    : m_vertex(vertex), m_array(array)
+PyObject *KX_VertexProxy::pyattr_get_tangent(EXP_PyObjectPlus *self_v,
+                                             const EXP_PYATTRIBUTE_DEF *attrdef)
+{
+  KX_VertexProxy *self = static_cast<KX_VertexProxy *>(self_v);
+  // The tangents are only computed for the meshes asking for them.
+  self->m_mesh->EnsureTangents();
+  return PyObjectFrom(MT_Vector4(self->m_vertex->getTangent()));
+}
+
+KX_VertexProxy::KX_VertexProxy(RAS_MeshObject *mesh, RAS_IDisplayArray *array, RAS_IVertex *vertex)
+    : m_vertex(vertex), m_array(array), m_mesh(mesh)
 {
 }
 
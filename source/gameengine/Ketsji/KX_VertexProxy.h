@@ -37,15 +37,18 @@
 
 class RAS_IVertex;
 class RAS_IDisplayArray;
+class RAS_MeshObject;
 
 class KX_VertexProxy : public EXP_Value {
   Py_Header
 
       protected : RAS_IVertex *m_vertex;
   RAS_IDisplayArray *m_array;
+  /// The mesh owning the display array, asked to compute the tangents on access.
+  RAS_MeshObject *m_mesh;
 
  public:
-  KX_VertexProxy(RAS_IDisplayArray *array, RAS_IVertex *vertex);
+  KX_VertexProxy(RAS_MeshObject *mesh, RAS_IDisplayArray *array, RAS_IVertex *vertex);
   virtual ~KX_VertexProxy();
 
   RAS_IVertex *GetVertex();
@@ -70,6 +73,8 @@ class KX_VertexProxy : public EXP_Value {
   static PyObject *pyattr_get_color(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_colors(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_normal(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
+  static PyObject *pyattr_get_tangent(EXP_PyObjectPlus *self_v,
+                                      const EXP_PYATTRIBUTE_DEF *attrdef);
   static PyObject *pyattr_get_uvs(EXP_PyObjectPlus *self_v, const EXP_PYATTRIBUTE_DEF *attrdef);
 
   EXP_PYMETHOD_NOARGS(KX_VertexProxy, GetXYZ);
@@ -30,6 +30,8 @@
 
 #include "LA_Launcher.h"
 
+#include <algorithm>
+
 #include "BKE_main.hh"
 #include "BKE_sound.hh"
 #include "DNA_scene_types.h"
@@ -103,7 +105,8 @@ LA_Launcher::LA_Launcher(GHOST_ISystem *system,
       m_stereoMode(stereoMode),
       m_argc(argc),
       m_argv(argv),
-      m_audioDeviceIsInitialized(false)
+      m_audioDeviceIsInitialized(false),
+      m_headlessMode(HEADLESS_NONE)
 {
   m_pythonConsole.use = false;
 }
@@ -134,6 +137,17 @@ const std::string &LA_Launcher::GetExitString()
   return m_exitString;
 }
 
+LA_Launcher::HeadlessMode LA_Launcher::GetHeadlessMode()
+{
+  const int mode = SYS_GetCommandLineInt(SYS_GetSystem(), "headless", HEADLESS_NONE);
+  if (mode < HEADLESS_NONE || mode > HEADLESS_FAST) {
+    CM_Warning("invalid headless mode " << mode << ", expected 0, 1 or 2: headless disabled");
+    return HEADLESS_NONE;
+  }
+
+  return (HeadlessMode)mode;
+}
+
 void LA_Launcher::InitEngine()
 {
 #ifdef WIN32
@@ -157,6 +171,15 @@ void LA_Launcher::InitEngine()
   bool frameRate = (SYS_GetCommandLineInt(syshandle, "show_framerate", 0) != 0);
   bool nodepwarnings = (SYS_GetCommandLineInt(syshandle, "ignore_deprecation_warnings", 1) != 0);
   bool restrictAnimFPS = (gm.flag & GAME_RESTRICT_ANIM_UPDATES) != 0;
+  bool parallelScenes = (gm.flag & GAME_USE_PARALLEL_SCENES) != 0;
+
+  const bool headless = (m_headlessMode != HEADLESS_NONE);
+  /* Without rendering nothing limits the frame rate, when not paced the clock is advanced of one
+   * logic frame per engine frame instead of following the real time. */
+  const bool externalClock = (m_headlessMode == HEADLESS_FAST);
+  if (externalClock) {
+    fixed_framerate = false;
+  }
 
   // Setup python console keys used as shortcut.
   for (unsigned short i = 0; i < 4; ++i) {
@@ -170,8 +193,11 @@ void LA_Launcher::InitEngine()
       (KX_KetsjiEngine::FlagType)((fixed_framerate ? KX_KetsjiEngine::FIXED_FRAMERATE : 0) |
                                   (frameRate ? KX_KetsjiEngine::SHOW_FRAMERATE : 0) |
                                   (restrictAnimFPS ? KX_KetsjiEngine::RESTRICT_ANIMATION : 0) |
+                                  (parallelScenes ? KX_KetsjiEngine::PARALLEL_SCENES : 0) |
                                   (properties ? KX_KetsjiEngine::SHOW_DEBUG_PROPERTIES : 0) |
-                                  (profile ? KX_KetsjiEngine::SHOW_PROFILE : 0));
+                                  (profile ? KX_KetsjiEngine::SHOW_PROFILE : 0) |
+                                  (headless ? KX_KetsjiEngine::HEADLESS : 0) |
+                                  (externalClock ? KX_KetsjiEngine::USE_EXTERNAL_CLOCK : 0));
 
   m_rasterizer = new RAS_Rasterizer();
 
@@ -198,7 +224,7 @@ void LA_Launcher::InitEngine()
   m_canvas->Init();
 
   const char *backend = GHOST_ISystem::getSystemBackend();
-  const bool is_wayland = backend && (strcmp(backend, "WAYLAND") == 0);
+  const bool is_wayland = !headless && backend && (strcmp(backend, "WAYLAND") == 0);
 
   if (is_wayland) {
     WM_cursor_grab_enable(CTX_wm_window(m_context), WM_CURSOR_WRAP_XY, nullptr, false);
@@ -253,12 +279,19 @@ void LA_Launcher::InitEngine()
   m_ketsjiEngine->SetTicRate(gm.ticrate);
   m_ketsjiEngine->SetMaxLogicFrame(gm.maxlogicstep);
   m_ketsjiEngine->SetMaxPhysicsFrame(gm.maxphystep);
+  m_ketsjiEngine->SetPhysicsShapeCache((e_PhysicsShapeCache)std::clamp(
+      SYS_GetCommandLineInt(syshandle, "physics_cache", 0),
+      (int)ShapeCacheNone,
+      (int)ShapeCacheUserDirectory));
   m_ketsjiEngine->SetTimeScale(gm.timeScale);
 
   // Set the global settings (carried over if restart/load new files).
   m_ketsjiEngine->SetGlobalSettings(m_globalSettings);
 
-  m_rasterizer->Init(m_canvas);
+  // The rasterizer is kept for its settings and debug draw but never initializes the GPU state.
+  if (!headless) {
+    m_rasterizer->Init(m_canvas);
+  }
   InitCamera();
 
 #ifdef WITH_PYTHON
@@ -348,7 +381,8 @@ void LA_Launcher::ExitEngine()
     m_canvas->SetMouseState(RAS_ICanvas::MOUSE_NORMAL);
   }
   const char *backend = GHOST_ISystem::getSystemBackend();
-  const bool is_wayland = backend && (strcmp(backend, "WAYLAND") == 0);
+  const bool is_wayland = (m_headlessMode == HEADLESS_NONE) && backend &&
+                          (strcmp(backend, "WAYLAND") == 0);
 
   if (is_wayland) {
     WM_cursor_grab_disable(CTX_wm_window(m_context), nullptr);
@@ -509,6 +543,12 @@ bool LA_Launcher::EngineNextFrame()
   // Check if we can create a python console debugging.
   HandlePythonConsole();
 #endif
+  if (m_headlessMode == HEADLESS_FAST) {
+    // Advance the clock of exactly one logic frame.
+    m_ketsjiEngine->SetClockTime(m_ketsjiEngine->GetClockTime() +
+                                 1.0 / m_ketsjiEngine->GetTicRate());
+  }
+
   // Kick the engine.
   bool renderFrame = m_ketsjiEngine->NextFrame();
 
@@ -45,6 +45,16 @@ namespace blender { struct Scene; }
 namespace blender { struct Main; }
 
 class LA_Launcher {
+ public:
+  /// Runtime without window nor GPU context, set by the "headless" command line option.
+  enum HeadlessMode {
+    HEADLESS_NONE = 0,
+    /// The logic frames are paced to the tic rate.
+    HEADLESS_PACED,
+    /// The logic frames are proceeded as fast as possible with a fixed time step.
+    HEADLESS_FAST
+  };
+
  protected:
   /// \section The game data.
   std::string m_startSceneName;
@@ -97,6 +107,8 @@ class LA_Launcher {
   /// avoid to run audaspace code if audio device fails to initialize
   bool m_audioDeviceIsInitialized;
 
+  HeadlessMode m_headlessMode;
+
   /// Saved data to restore at the game end.
   struct SavedData {
     int vsync;
@@ -144,6 +156,11 @@ class LA_Launcher {
               int shadingTypeRuntime);
   virtual ~LA_Launcher();
 
+  /** Parse the "headless" command line option, invalid values are reported and ignored. Must be
+   * used to know if the player needs a window, the mode is then passed to the player launcher.
+   */
+  static HeadlessMode GetHeadlessMode();
+
 #ifdef WITH_PYTHON
   /// Setup python global dictionnary, used outside constructor to compile without python.
   void SetPythonGlobalDict(PyObject *globalDict);
@@ -58,7 +58,8 @@ LA_PlayerLauncher::LA_PlayerLauncher(GHOST_ISystem *system,
                                      const std::string &pythonMainLoop,
                                      blender::bContext *C,
                                      bool useViewportRender,
-                                     int shadingTypeRuntime)
+                                     int shadingTypeRuntime,
+                                     HeadlessMode headlessMode)
     : LA_Launcher(system,
                   maggie,
                   scene,
@@ -73,6 +74,7 @@ LA_PlayerLauncher::LA_PlayerLauncher(GHOST_ISystem *system,
       m_mainWindow(window),
       m_pythonMainLoop(pythonMainLoop)
 {
+  m_headlessMode = headlessMode;
 }
 
 LA_PlayerLauncher::~LA_PlayerLauncher()
@@ -140,7 +142,9 @@ void LA_PlayerLauncher::InitEngine()
   BKE_sound_init(m_maggie);
   LA_Launcher::InitEngine();
 
-  m_rasterizer->PrintHardwareInfo();
+  if (m_headlessMode == HEADLESS_NONE) {
+    m_rasterizer->PrintHardwareInfo();
+  }
 }
 
 void LA_PlayerLauncher::ExitEngine()
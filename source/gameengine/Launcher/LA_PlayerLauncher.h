@@ -70,7 +70,8 @@ class LA_PlayerLauncher : public LA_Launcher {
                     const std::string &pythonMainLoop,
                     blender::bContext *C,
                     bool useViewportRender,
-                    int shadingTypeRuntime);
+                    int shadingTypeRuntime,
+                    HeadlessMode headlessMode);
   virtual ~LA_PlayerLauncher();
 
   virtual void InitEngine();
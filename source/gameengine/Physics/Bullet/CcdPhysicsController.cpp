@@ -372,7 +372,7 @@ bool CcdPhysicsController::CreateSoftbody()
   }
 
   btSoftBody *psb = nullptr;
-  btSoftBodyWorldInfo &worldInfo = m_cci.m_physicsEnv->GetDynamicsWorld()->getWorldInfo();
+  btSoftBodyWorldInfo &worldInfo = m_cci.m_physicsEnv->GetSoftBodyWorldInfo();
 
   if (m_cci.m_collisionShape->getShapeType() ==
       CONVEX_HULL_SHAPE_PROXYTYPE) {  // Disabled in upbge 0.3
@@ -759,9 +759,12 @@ bool CcdPhysicsController::ReplaceControllerShape(btCollisionShape *newShape)
 
   btSoftBody *softBody = GetSoftBody();
   if (softBody) {
-    btSoftRigidDynamicsWorld *world = GetPhysicsEnvironment()->GetDynamicsWorld();
+    // nullptr while the soft body waits for the serial world.
+    btSoftRigidDynamicsWorld *world = GetPhysicsEnvironment()->GetSoftDynamicsWorld();
     // remove the old softBody
-    world->removeSoftBody(softBody);
+    if (world) {
+      world->removeSoftBody(softBody);
+    }
 
     KX_GameObject *gameobj = KX_GameObject::GetClientObject(
         (KX_ClientObjectInfo *)GetNewClientInfo());
@@ -792,7 +795,9 @@ bool CcdPhysicsController::ReplaceControllerShape(btCollisionShape *newShape)
     // set the user
     newSoftBody->setUserPointer(this);
     // add the new softbody
-    world->addSoftBody(newSoftBody);
+    if (world) {
+      world->addSoftBody(newSoftBody);
+    }
   }
 
   if (m_characterController) {
@@ -1227,7 +1232,7 @@ void CcdPhysicsController::RefreshCollisions()
   if (IsPhysicsSuspended())
     return;
 
-  btSoftRigidDynamicsWorld *dw = GetPhysicsEnvironment()->GetDynamicsWorld();
+  btDiscreteDynamicsWorld *dw = GetPhysicsEnvironment()->GetDynamicsWorld();
   btBroadphaseProxy *proxy = m_object->getBroadphaseHandle();
   btDispatcher *dispatcher = dw->getDispatcher();
   btOverlappingPairCache *pairCache = dw->getPairCache();
@@ -1998,12 +2003,47 @@ bool CcdPhysicsController::ReplacePhysicsShape(PHY_IPhysicsController *phyctrl)
   return true;
 }
 
+/** Refit the BVH of a triangle mesh shape after a topology preserving update, only the subtrees
+ * overlapping the moved vertices are refit when they stay in the quantization bounds of the BVH.
+ */
+static void refit_triangle_mesh_shape(btBvhTriangleMeshShape *shape,
+                                      const CcdShapeConstructionInfo *shapeInfo)
+{
+  btVector3 modifiedMin, modifiedMax;
+  if (!shapeInfo->GetModifiedAabb(modifiedMin, modifiedMax)) {
+    return;
+  }
+
+  btOptimizedBvh *bvh = shape->getOptimizedBvh();
+  if (bvh && bvh->isQuantized()) {
+    /* Bullet requires the partial region strictly inside the quantization bounds, use the first
+     * quantized values inside the bounds to avoid rounding issues. */
+    const unsigned short quantizedMin[3] = {1, 1, 1};
+    const unsigned short quantizedMax[3] = {65532, 65532, 65532};
+    const btVector3 boundsMin = bvh->unQuantize(quantizedMin);
+    const btVector3 boundsMax = bvh->unQuantize(quantizedMax);
+    if (modifiedMin.x() > boundsMin.x() && modifiedMin.y() > boundsMin.y() &&
+        modifiedMin.z() > boundsMin.z() && modifiedMax.x() < boundsMax.x() &&
+        modifiedMax.y() < boundsMax.y() && modifiedMax.z() < boundsMax.z())
+    {
+      shape->partialRefitTree(modifiedMin, modifiedMax);
+      return;
+    }
+  }
+
+  // The vertices left the quantization bounds, refit the whole tree with new bounds.
+  btVector3 aabbMin, aabbMax;
+  shapeInfo->GetVertexAabb(aabbMin, aabbMax);
+  shape->refitTree(aabbMin, aabbMax);
+}
+
 void CcdPhysicsController::UpdateShapeFromShapeInfo(CcdShapeConstructionInfo *shapeInfo)
 {
   if (!shapeInfo || !m_object)
     return;
 
-  /* For now only called for gpu animated meshes, else old path (ReplaceControllerShape + RefreshCcdPhysicsController) */
+  /* Topology preserving update: refit the existing shape over the moved vertices, else old path
+   * (ReplaceControllerShape + RefreshCcdPhysicsController) */
   if (shapeInfo->GetTriangleIndexVertexArray() && !shapeInfo->GetForceReInstance()) {
     shapeInfo->updateIndexedMeshVertexBase();
 
@@ -2011,32 +2051,18 @@ void CcdPhysicsController::UpdateShapeFromShapeInfo(CcdShapeConstructionInfo *sh
     if (!shape)
       return;
 
-    KX_GameObject *gameobj = KX_GameObject::GetClientObject(
-        (KX_ClientObjectInfo *)GetNewClientInfo());
-    Object *blenderobj = gameobj->GetBlenderObject();
-    Mesh *mesh = (Mesh *)blenderobj->data;
-    bContext *C = KX_GetActiveEngine()->GetContext();
-    Depsgraph *depsgraph = CTX_data_depsgraph_on_load(C);
-    Object *ob_eval = DEG_get_evaluated(depsgraph, blenderobj);
-    Mesh *mesh_eval = (Mesh *)ob_eval->data;
-    const std::optional<Bounds<float3>> bounds = mesh_eval->runtime->bounds_cache.data();
-    btVector3 aabbMin(btVector3(bounds->min.x, bounds->min.y, bounds->min.z));
-    btVector3 aabbMax(btVector3(bounds->max.x, bounds->max.y, bounds->max.z));
-
     switch (shape->getShapeType()) {
       case SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE: {
         btScaledBvhTriangleMeshShape *scaled = (btScaledBvhTriangleMeshShape *)shape;
         btBvhTriangleMeshShape *unscaled = scaled->getChildShape();
         if (unscaled) {
-          unscaled->refitTree(aabbMin, aabbMax);
-          unscaled->recalcLocalAabb();
+          refit_triangle_mesh_shape(unscaled, shapeInfo);
         }
         break;
       }
       case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
         btBvhTriangleMeshShape *trimesh = (btBvhTriangleMeshShape *)shape;
-        trimesh->refitTree(aabbMin, aabbMax);
-        trimesh->recalcLocalAabb();
+        refit_triangle_mesh_shape(trimesh, shapeInfo);
         break;
       }
       case GIMPACT_SHAPE_PROXYTYPE: {
@@ -2165,7 +2191,10 @@ void CcdShapeConstructionInfo::ProcessReplica()
   m_userData = nullptr;
   m_meshObject = nullptr;
   m_triangleIndexVertexArray = nullptr;
+  m_cachedBvh = nullptr;
   m_forceReInstance = false;
+  m_modifiedAabbMin.setValue(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+  m_modifiedAabbMax.setValue(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
   m_shapeProxy = nullptr;
   m_vertexArray.clear();
   m_polygonIndexArray.clear();
@@ -2706,6 +2735,15 @@ bool CcdShapeConstructionInfo::UpdateMesh(class KX_GameObject *from_gameobj,
 
   bool gpu_reinstance = !from_meshobj && evaluatedMesh && from_gameobj && me && me->is_running_gpu_animation_playback;
 
+  /* Keep the previous triangles and vertices to detect topology preserving updates, which only
+   * refit the BVH of the existing shapes over the moved vertices. */
+  std::vector<int> prevTriFaceArray;
+  btAlignedObjectArray<btScalar> prevVertexArray;
+  if (m_triangleIndexVertexArray) {
+    prevTriFaceArray = m_triFaceArray;
+    prevVertexArray = m_vertexArray;
+  }
+
   if (me && meshobj) {
     if (me->vert_positions().size() == 0) {
       m_shapeType = PHY_SHAPE_NONE;
@@ -2764,7 +2802,7 @@ bool CcdShapeConstructionInfo::UpdateMesh(class KX_GameObject *from_gameobj,
 
     // Tag verts we're using
     numpolys = meshobj->NumPolygons();
-    numverts = meshobj->m_sharedvertex_map.size();
+    numverts = meshobj->GetSharedVertexMap().size();
     const float *xyz;
 
     std::vector<bool> vert_tag_array(numverts, false);
@@ -2856,19 +2894,13 @@ bool CcdShapeConstructionInfo::UpdateMesh(class KX_GameObject *from_gameobj,
 	}
 #endif
 
-  /* force recreation of the m_triangleIndexVertexArray.
-   * If this has multiple users we cant delete */
+  /* force recreation of the m_triangleIndexVertexArray when the topology changed, else only the
+   * BVH of the shapes is refit. If this has multiple users we cant delete */
   if (m_triangleIndexVertexArray) {
-    m_forceReInstance = true;
-    /* Don't force reinstance for gpu animated meshes (no topology change) or when topology hasn't changed */
     if (me) {
-      /* Basic topology check (imprecise) */
-      /* Sample-based quick signature (cheap). If initial signature exists and matches, avoid reinstance. */
+      /* Sample-based quick signature (cheap), only used to detect the need of a new decimation. */
       unsigned int sample_sig = hash_topology(me, 32);
-      if (m_topologySignature != 0u && sample_sig == m_topologySignature) {
-        m_forceReInstance = false;
-      }
-      else {
+      if (m_topologySignature == 0u || sample_sig != m_topologySignature) {
         /* update stored signature for future comparisons */
         m_topologySignature = sample_sig;
         /* Even if lastCollapseFactor did not change, if there is a decimated mesh,
@@ -2876,11 +2908,28 @@ bool CcdShapeConstructionInfo::UpdateMesh(class KX_GameObject *from_gameobj,
         if (m_decimatedMesh) {
           DecimateMesh(me, m_lastCollapseFactor, true);
         }
-        m_forceReInstance = true;
       }
     }
-    if (gpu_reinstance) {
-      m_forceReInstance = false;
+
+    /* The sampled signature can miss topology changes or report false ones, use an exact
+     * comparison of the triangles to choose between a refit and a full rebuild. */
+    m_forceReInstance = (m_triFaceArray != prevTriFaceArray) ||
+                        (m_vertexArray.size() != prevVertexArray.size());
+
+    m_modifiedAabbMin.setValue(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+    m_modifiedAabbMax.setValue(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+    if (!m_forceReInstance) {
+      for (int i = 0, size = m_vertexArray.size(); i < size; i += 3) {
+        const btVector3 prevPos(
+            prevVertexArray[i], prevVertexArray[i + 1], prevVertexArray[i + 2]);
+        const btVector3 pos(m_vertexArray[i], m_vertexArray[i + 1], m_vertexArray[i + 2]);
+        if (pos != prevPos) {
+          m_modifiedAabbMin.setMin(prevPos);
+          m_modifiedAabbMin.setMin(pos);
+          m_modifiedAabbMax.setMax(prevPos);
+          m_modifiedAabbMax.setMax(pos);
+        }
+      }
     }
   }
 
@@ -2898,6 +2947,28 @@ bool CcdShapeConstructionInfo::UpdateMesh(class KX_GameObject *from_gameobj,
   return true;
 }
 
+bool CcdShapeConstructionInfo::GetModifiedAabb(btVector3 &aabbMin, btVector3 &aabbMax) const
+{
+  if (m_modifiedAabbMin.x() > m_modifiedAabbMax.x()) {
+    return false;
+  }
+
+  aabbMin = m_modifiedAabbMin;
+  aabbMax = m_modifiedAabbMax;
+  return true;
+}
+
+void CcdShapeConstructionInfo::GetVertexAabb(btVector3 &aabbMin, btVector3 &aabbMax) const
+{
+  aabbMin.setValue(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+  aabbMax.setValue(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+  for (int i = 0, size = m_vertexArray.size(); i < size; i += 3) {
+    const btVector3 pos(m_vertexArray[i], m_vertexArray[i + 1], m_vertexArray[i + 2]);
+    aabbMin.setMin(pos);
+    aabbMax.setMax(pos);
+  }
+}
+
 bool CcdShapeConstructionInfo::SetProxy(CcdShapeConstructionInfo *shapeInfo)
 {
   if (shapeInfo == nullptr)
@@ -2985,7 +3056,15 @@ btCollisionShape *CcdShapeConstructionInfo::CreateBulletShape(btScalar margin,
         collisionShape = gimpactShape;
       }
       else {
+        /* Only the BVH of the original mesh is cached, the reinstanced meshes are deformed or
+         * modified at runtime. */
+        const bool useCache = (useBvh && !m_triangleIndexVertexArray &&
+                               0.0f == m_weldingThreshold1);
         if (!m_triangleIndexVertexArray || m_forceReInstance) {
+          if (m_cachedBvh) {
+            delete m_cachedBvh;
+            m_cachedBvh = nullptr;
+          }
           /// enable welding, only for the objects that need it (such as soft bodies)
           if (0.0f != m_weldingThreshold1) {
             btTriangleMesh *collisionMeshData = new btTriangleMesh(true, false);
@@ -3016,10 +3095,21 @@ btCollisionShape *CcdShapeConstructionInfo::CreateBulletShape(btScalar margin,
           }
 
           m_forceReInstance = false;
+
+          if (useCache) {
+            m_cachedBvh = CcdShapeCache::GetBvh(
+                m_triangleIndexVertexArray, m_vertexArray, m_triFaceArray, margin);
+          }
         }
 
-        btBvhTriangleMeshShape *unscaledShape = new btBvhTriangleMeshShape(
-            m_triangleIndexVertexArray, true, useBvh);
+        btBvhTriangleMeshShape *unscaledShape;
+        if (useBvh && m_cachedBvh) {
+          unscaledShape = new btBvhTriangleMeshShape(m_triangleIndexVertexArray, true, false);
+          unscaledShape->setOptimizedBvh(m_cachedBvh->GetBvh());
+        }
+        else {
+          unscaledShape = new btBvhTriangleMeshShape(m_triangleIndexVertexArray, true, useBvh);
+        }
         unscaledShape->setMargin(margin);
         collisionShape = new btScaledBvhTriangleMeshShape(unscaledShape,
                                                           btVector3(1.0f, 1.0f, 1.0f));
@@ -3077,6 +3167,8 @@ CcdShapeConstructionInfo::~CcdShapeConstructionInfo()
 
   if (m_triangleIndexVertexArray)
     delete m_triangleIndexVertexArray;
+  if (m_cachedBvh)
+    delete m_cachedBvh;
   m_vertexArray.clear();
   if (m_shapeType == PHY_SHAPE_MESH && m_meshObject != nullptr) {
     std::map<RAS_MeshObject *, CcdShapeConstructionInfo *>::iterator mit = m_meshShapeMap.find(
@@ -33,6 +33,7 @@
 
 #include "CM_RefCount.h"
 #include "CcdMathUtils.h"
+#include "CcdShapeCache.h"
 #include "PHY_ICharacter.h"
 #include "PHY_IMotionState.h"
 #include "PHY_IPhysicsController.h"
@@ -83,7 +84,10 @@ class CcdShapeConstructionInfo : public CM_RefCount<CcdShapeConstructionInfo> {
         m_userData(nullptr),
         m_meshObject(nullptr),
         m_triangleIndexVertexArray(nullptr),
+        m_cachedBvh(nullptr),
         m_forceReInstance(false),
+        m_modifiedAabbMin(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT),
+        m_modifiedAabbMax(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT),
         m_weldingThreshold1(0.0f),
         m_shapeProxy(nullptr),
         m_decimatedMesh(nullptr),
@@ -167,6 +171,13 @@ class CcdShapeConstructionInfo : public CM_RefCount<CcdShapeConstructionInfo> {
   {
     return m_triangleIndexVertexArray;
   }
+  /** Return the bounds of the old and new positions of the vertices moved by the last topology
+   * preserving UpdateMesh.
+   * \return False if no vertex moved.
+   */
+  bool GetModifiedAabb(btVector3 &aabbMin, btVector3 &aabbMax) const;
+  /// Return the bounds of all the vertices.
+  void GetVertexAabb(btVector3 &aabbMin, btVector3 &aabbMax) const;
   /**********************/
 
   /* Generates a decimated Mesh * from non decimated Mesh * to update physics shape */
@@ -228,6 +239,8 @@ class CcdShapeConstructionInfo : public CM_RefCount<CcdShapeConstructionInfo> {
   RAS_MeshObject *m_meshObject;
   /// The list of vertexes and indexes for the triangle mesh, shared between Bullet shape.
   btTriangleIndexVertexArray *m_triangleIndexVertexArray;
+  /// The BVH of the triangle mesh loaded from the shape cache, shared between Bullet shape.
+  CcdShapeCache::Bvh *m_cachedBvh;
   /// for compound shapes
   std::vector<CcdShapeConstructionInfo *> m_shapeArray;
   /// use gimpact for concave dynamic/moving collision detection
@@ -236,6 +249,9 @@ class CcdShapeConstructionInfo : public CM_RefCount<CcdShapeConstructionInfo> {
   /// (ReplaceControllerShape) when the mesh is updated (topology change). If topology does'nt
   /// change, it is possible to update without recreating everything (UpdateShapeFromShapeInfo)
   bool m_forceReInstance;
+  /// Bounds of the vertices moved by the last UpdateMesh, empty when min is greater than max.
+  btVector3 m_modifiedAabbMin;
+  btVector3 m_modifiedAabbMax;
   /// welding closeby vertices together can improve softbody stability etc.
   float m_weldingThreshold1;
   /// only used for PHY_SHAPE_PROXY, pointer to actual shape info
@@ -23,13 +23,18 @@
 
 #include "BKE_object.hh"
 #include "BLI_bounds.hh"
+#include "BLI_task_c.hh"
 #include "DNA_object_force_types.h"
 #include "DNA_scene_types.h"
+#include "PRF_profile.hh"
 
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
 #include "BulletCollision/CollisionDispatch/btGhostObject.h"
 #include "BulletCollision/Gimpact/btGImpactCollisionAlgorithm.h"
 #include "BulletCollision/NarrowPhaseCollision/btRaycastCallback.h"
 #include "BulletDynamics/ConstraintSolver/btNNCGConstraintSolver.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
 #include "BulletSoftBody/btSoftBodyRigidBodyCollisionConfiguration.h"
 #include "BulletSoftBody/btSoftRigidDynamicsWorld.h"
 
@@ -49,6 +54,126 @@ using namespace blender;
 
 static btRaycastVehicle::btVehicleTuning gTuning;
 
+// Defined in btThreads.cpp but not exposed in its header.
+void btPushThreadsAreRunning();
+void btPopThreadsAreRunning();
+
+/** Bullet task scheduler used by the multithreaded world, it runs the parallel loops on the
+ * Blender task scheduler instead of spawning Bullet own worker threads.
+ */
+class BlenderTaskScheduler : public btITaskScheduler {
+ private:
+  int m_numThreads;
+
+  struct LoopData {
+    const btIParallelForBody *forBody;
+    const btIParallelSumBody *sumBody;
+    int begin;
+    int end;
+    int grainSize;
+  };
+
+  /// Each iteration of the Blender parallel range processes a whole grain of the Bullet loop.
+  static void ForTask(void *__restrict userdata,
+                      const int iter,
+                      const TaskParallelTLS *__restrict /*tls*/)
+  {
+    const LoopData *data = (const LoopData *)userdata;
+    const int begin = data->begin + iter * data->grainSize;
+    data->forBody->forLoop(begin, std::min(begin + data->grainSize, data->end));
+  }
+
+  static void SumTask(void *__restrict userdata,
+                      const int iter,
+                      const TaskParallelTLS *__restrict tls)
+  {
+    const LoopData *data = (const LoopData *)userdata;
+    const int begin = data->begin + iter * data->grainSize;
+    *(btScalar *)tls->userdata_chunk += data->sumBody->sumLoop(
+        begin, std::min(begin + data->grainSize, data->end));
+  }
+
+  static void SumReduce(const void *__restrict /*userdata*/,
+                        void *__restrict chunk_join,
+                        void *__restrict chunk)
+  {
+    *(btScalar *)chunk_join += *(btScalar *)chunk;
+  }
+
+  void RunLoop(LoopData &data, TaskParallelRangeFunc func, TaskParallelSettings &settings)
+  {
+    data.grainSize = std::max(data.grainSize, 1);
+    const int numGrains = (data.end - data.begin + data.grainSize - 1) / data.grainSize;
+    settings.use_threading = (numGrains > 1);
+
+    btPushThreadsAreRunning();
+    BLI_task_parallel_range(0, numGrains, &data, func, &settings);
+    btPopThreadsAreRunning();
+  }
+
+ public:
+  BlenderTaskScheduler()
+      : btITaskScheduler("Blender"),
+        // Reserve an index for the main thread in addition to the worker threads.
+        m_numThreads(std::min(BLI_task_scheduler_num_threads() + 1, (int)BT_MAX_THREAD_COUNT))
+  {
+  }
+
+  virtual int getMaxNumThreads() const
+  {
+    return BT_MAX_THREAD_COUNT;
+  }
+
+  virtual int getNumThreads() const
+  {
+    return m_numThreads;
+  }
+
+  virtual void setNumThreads(int numThreads)
+  {
+    m_numThreads = std::clamp(numThreads, 1, (int)BT_MAX_THREAD_COUNT);
+  }
+
+  virtual void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody &body)
+  {
+    LoopData data = {&body, nullptr, iBegin, iEnd, grainSize};
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    RunLoop(data, ForTask, settings);
+  }
+
+  virtual btScalar parallelSum(int iBegin,
+                               int iEnd,
+                               int grainSize,
+                               const btIParallelSumBody &body)
+  {
+    LoopData data = {nullptr, &body, iBegin, iEnd, grainSize};
+    btScalar sum = 0.0f;
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.userdata_chunk = &sum;
+    settings.userdata_chunk_size = sizeof(btScalar);
+    settings.func_reduce = SumReduce;
+    RunLoop(data, SumTask, settings);
+
+    return sum;
+  }
+};
+
+/** Multithreaded collision dispatcher storing the manifolds created by any thread. The manifold
+ * lists are indexed by btGetCurrentThreadIndex which numbers all the threads calling Bullet, as
+ * the task threads stepping the physics of independent scenes, not only the scheduler threads.
+ */
+class CcdCollisionDispatcherMt : public btCollisionDispatcherMt {
+ public:
+  CcdCollisionDispatcherMt(btCollisionConfiguration *config) : btCollisionDispatcherMt(config)
+  {
+    m_batchManifoldsPtr.resize(BT_MAX_THREAD_COUNT);
+  }
+};
+
 #ifdef WIN32
 void DrawRasterizerLine(const float *from, const float *to, int color);
 #endif
@@ -113,6 +238,12 @@ class BlenderVehicleRaycaster : public btDefaultVehicleRaycaster {
   {
   }
 
+  /// Change the world used for the ray casts, btDefaultVehicleRaycaster one is never used.
+  void SetDynamicsWorld(btDynamicsWorld *world)
+  {
+    m_dynamicsWorld = world;
+  }
+
   virtual void *castRay(const btVector3 &from,
                         const btVector3 &to,
                         btVehicleRaycasterResult &result)
@@ -186,6 +317,11 @@ class WrapperVehicle : public PHY_IVehicle {
     return m_chassis;
   }
 
+  void SetDynamicsWorld(btDynamicsWorld *world)
+  {
+    m_raycaster->SetDynamicsWorld(world);
+  }
+
   virtual void AddWheel(PHY_IMotionState *motionState,
                         MT_Vector3 connectionPoint,
                         MT_Vector3 downDirection,
@@ -366,15 +502,21 @@ void CcdPhysicsEnvironment::SetDebugDrawer(btIDebugDraw *debugDrawer)
   m_debugDrawer = debugDrawer;
 }
 
-CcdPhysicsEnvironment::CcdPhysicsEnvironment(PHY_SolverType solverType)
+CcdPhysicsEnvironment::CcdPhysicsEnvironment(PHY_SolverType solverType,
+                                             PHY_WorldType worldType)
     : //m_numIterations(10),
       m_numTimeSubSteps(1),
-      m_solverType(PHY_SOLVER_NONE),
+      m_solverType(solverType),
+      m_worldType(worldType),
       m_deactivationTime(2.0f),
       m_linearDeactivationThreshold(0.8f),
       m_angularDeactivationThreshold(1.0f),
       m_contactBreakingThreshold(0.02f),
+      m_dynamicsWorld(nullptr),
+      m_softDynamicsWorld(nullptr),
+      m_pendingSoftBodyWorldInfo(nullptr),
       m_solver(nullptr),
+      m_solverMt(nullptr),
       m_filterCallback(nullptr),
       m_ghostPairCallback(nullptr),
       m_ownDispatcher(nullptr)
@@ -385,10 +527,6 @@ CcdPhysicsEnvironment::CcdPhysicsEnvironment(PHY_SolverType solverType)
 
   m_collisionConfiguration = new btSoftBodyRigidBodyCollisionConfiguration();
 
-  btCollisionDispatcher *dispatcher = new btCollisionDispatcher(m_collisionConfiguration);
-  btGImpactCollisionAlgorithm::registerAlgorithm(dispatcher);
-  m_ownDispatcher = dispatcher;
-
   m_broadphase = new btDbvtBroadphase();
 
   m_filterCallback = new CcdOverlapFilterCallBack(this);
@@ -396,23 +534,203 @@ CcdPhysicsEnvironment::CcdPhysicsEnvironment(PHY_SolverType solverType)
   m_broadphase->getOverlappingPairCache()->setOverlapFilterCallback(m_filterCallback);
   m_broadphase->getOverlappingPairCache()->setInternalGhostPairCallback(m_ghostPairCallback);
 
-  SetSolverType(solverType);  // issues with quickstep and memory allocations
-  //	m_dynamicsWorld = new
-  // btDiscreteDynamicsWorld(dispatcher,m_broadphase,m_solver,m_collisionConfiguration);
-  m_dynamicsWorld = new btSoftRigidDynamicsWorld(
-      dispatcher, m_broadphase, m_solver, m_collisionConfiguration);
-  m_dynamicsWorld->setInternalTickCallback(&CcdPhysicsEnvironment::StaticSimulationSubtickCallback,
-                                           this);
+  m_debugDrawer = nullptr;
+  CreateDynamicsWorld();
   // m_dynamicsWorld->getSolverInfo().m_linearSlop = 0.01f;
   // m_dynamicsWorld->getSolverInfo().m_solverMode=	SOLVER_USE_WARMSTARTING +
   // SOLVER_USE_2_FRICTION_DIRECTIONS +	SOLVER_RANDMIZE_ORDER +	SOLVER_USE_FRICTION_WARMSTARTING;
 
-  m_debugDrawer = nullptr;
   SetGravity(0.0f, 0.0f, -9.81f);
 }
 
+btConstraintSolver *CcdPhysicsEnvironment::NewConstraintSolver() const
+{
+  switch (m_solverType) {
+    case PHY_SOLVER_SEQUENTIAL: {
+      return new btSequentialImpulseConstraintSolver();
+    }
+    case PHY_SOLVER_NNCG: {
+      return new btNNCGConstraintSolver();
+    }
+    default: {
+      BLI_assert(false);
+      return nullptr;
+    }
+  }
+}
+
+btConstraintSolver *CcdPhysicsEnvironment::NewWorldConstraintSolver() const
+{
+  if (m_worldType != PHY_WORLD_MULTITHREAD) {
+    return NewConstraintSolver();
+  }
+
+  // The islands are solved in parallel, one solver per thread.
+  const int numSolvers = btGetTaskScheduler()->getNumThreads();
+  std::vector<btConstraintSolver *> solvers(numSolvers);
+  for (btConstraintSolver *&solver : solvers) {
+    solver = NewConstraintSolver();
+  }
+
+  return new btConstraintSolverPoolMt(solvers.data(), numSolvers);
+}
+
+btConstraintSolver *CcdPhysicsEnvironment::NewLargeIslandConstraintSolver() const
+{
+  switch (m_solverType) {
+    case PHY_SOLVER_SEQUENTIAL: {
+      return new btSequentialImpulseConstraintSolverMt();
+    }
+    default: {
+      CM_Warning("the constraint solver has no multithreaded variant, "
+                 "the large islands are solved by a single thread");
+      return NewConstraintSolver();
+    }
+  }
+}
+
+void CcdPhysicsEnvironment::CreateDynamicsWorld()
+{
+  btCollisionDispatcher *dispatcher;
+  if (m_worldType == PHY_WORLD_MULTITHREAD) {
+    // The task scheduler must be set before the creation of any multithreaded Bullet class.
+    static BlenderTaskScheduler taskScheduler;
+    if (btGetTaskScheduler() != &taskScheduler) {
+      btSetTaskScheduler(&taskScheduler);
+    }
+    dispatcher = new CcdCollisionDispatcherMt(m_collisionConfiguration);
+  }
+  else {
+    dispatcher = new btCollisionDispatcher(m_collisionConfiguration);
+  }
+  btGImpactCollisionAlgorithm::registerAlgorithm(dispatcher);
+  m_ownDispatcher = dispatcher;
+
+  m_solver = NewWorldConstraintSolver();
+
+  if (m_worldType == PHY_WORLD_MULTITHREAD) {
+    // The large islands are split in batches and solved by a multithreaded solver.
+    m_solverMt = NewLargeIslandConstraintSolver();
+    m_dynamicsWorld = new btDiscreteDynamicsWorldMt(dispatcher,
+                                                    m_broadphase,
+                                                    (btConstraintSolverPoolMt *)m_solver,
+                                                    m_solverMt,
+                                                    m_collisionConfiguration);
+    m_softDynamicsWorld = nullptr;
+  }
+  else {
+    m_softDynamicsWorld = new btSoftRigidDynamicsWorld(
+        dispatcher, m_broadphase, m_solver, m_collisionConfiguration);
+    m_dynamicsWorld = m_softDynamicsWorld;
+  }
+
+  m_dynamicsWorld->setInternalTickCallback(&CcdPhysicsEnvironment::StaticSimulationSubtickCallback,
+                                           this);
+  if (m_debugDrawer) {
+    m_dynamicsWorld->setDebugDrawer(m_debugDrawer);
+  }
+}
+
+void CcdPhysicsEnvironment::DeleteDynamicsWorld()
+{
+  // first delete scene, then dispatcher, because pairs have to release manifolds on the dispatcher
+  delete m_dynamicsWorld;
+  m_dynamicsWorld = nullptr;
+  m_softDynamicsWorld = nullptr;
+
+  delete m_ownDispatcher;
+  m_ownDispatcher = nullptr;
+
+  delete m_solver;
+  m_solver = nullptr;
+
+  delete m_solverMt;
+  m_solverMt = nullptr;
+}
+
+void CcdPhysicsEnvironment::RebuildDynamicsWorld()
+{
+  /* The controllers only restore the constraints between two controllers, remove all the
+   * constraints from the world and add them back once the controllers are added. */
+  std::vector<btTypedConstraint *> constraints(m_dynamicsWorld->getNumConstraints());
+  for (unsigned int i = 0, size = constraints.size(); i < size; ++i) {
+    constraints[i] = m_dynamicsWorld->getConstraint(i);
+  }
+  for (btTypedConstraint *con : constraints) {
+    ((CcdConstraint *)con->getUserConstraintPtr())->SetActive(false);
+    m_dynamicsWorld->removeConstraint(con);
+  }
+
+  // Copy the controllers as they are erased from m_controllers when removed.
+  const std::set<CcdPhysicsController *> controllers = m_controllers;
+  for (CcdPhysicsController *ctrl : controllers) {
+    RemoveCcdPhysicsController(ctrl, false);
+  }
+
+  const btContactSolverInfo solverInfo = m_dynamicsWorld->getSolverInfo();
+
+  DeleteDynamicsWorld();
+  CreateDynamicsWorld();
+
+  m_dynamicsWorld->getSolverInfo() = solverInfo;
+  SetGravity(m_gravity.x(), m_gravity.y(), m_gravity.z());
+
+  for (WrapperVehicle *vehicle : m_wrapperVehicles) {
+    vehicle->SetDynamicsWorld(m_dynamicsWorld);
+  }
+
+  for (CcdPhysicsController *ctrl : controllers) {
+    AddCcdPhysicsController(ctrl);
+  }
+
+  // Add the soft bodies waiting for this world, they wait again if it's not a serial world.
+  const std::vector<CcdPhysicsController *> softBodies = std::move(m_pendingSoftBodies);
+  m_pendingSoftBodies.clear();
+  for (CcdPhysicsController *ctrl : softBodies) {
+    AddCcdPhysicsController(ctrl);
+  }
+
+  for (btTypedConstraint *con : constraints) {
+    CcdConstraint *userData = (CcdConstraint *)con->getUserConstraintPtr();
+    if (!userData->GetActive()) {
+      userData->SetActive(true);
+      m_dynamicsWorld->addConstraint(con, userData->GetDisableCollision());
+    }
+  }
+}
+
+void CcdPhysicsEnvironment::AddPendingSoftBodies()
+{
+  if (!m_pendingSoftBodies.empty()) {
+    SetWorldType(PHY_WORLD_SERIAL);
+  }
+}
+
+btSoftBodyWorldInfo &CcdPhysicsEnvironment::GetSoftBodyWorldInfo()
+{
+  if (m_softDynamicsWorld) {
+    return m_softDynamicsWorld->getWorldInfo();
+  }
+
+  if (!m_pendingSoftBodyWorldInfo) {
+    m_pendingSoftBodyWorldInfo = new btSoftBodyWorldInfo();
+  }
+  return *m_pendingSoftBodyWorldInfo;
+}
+
 void CcdPhysicsEnvironment::AddCcdPhysicsController(CcdPhysicsController *ctrl)
 {
+  /* Rebuilding the world now would move the controllers during the add, the serial world
+   * replaces the multithreaded world at the next simulation step. */
+  if (ctrl->GetSoftBody() && !m_softDynamicsWorld) {
+    if (m_pendingSoftBodies.empty()) {
+      CM_Warning("soft bodies are not supported by the multithreaded physics world, "
+                 "falling back to the serial world");
+    }
+    CM_ListAddIfNotFound(m_pendingSoftBodies, ctrl);
+    return;
+  }
+
   // the controller is already added we do nothing
   if (!m_controllers.insert(ctrl).second) {
     return;
@@ -447,7 +765,9 @@ void CcdPhysicsEnvironment::AddCcdPhysicsController(CcdPhysicsController *ctrl)
   else {
     if (ctrl->GetSoftBody()) {
       btSoftBody *softBody = ctrl->GetSoftBody();
-      m_dynamicsWorld->addSoftBody(softBody);
+      // The soft body could be created with another world info, see GetSoftBodyWorldInfo.
+      softBody->m_worldInfo = &m_softDynamicsWorld->getWorldInfo();
+      m_softDynamicsWorld->addSoftBody(softBody);
     }
     else {
       if (obj->getCollisionShape()) {
@@ -530,21 +850,13 @@ void CcdPhysicsEnvironment::RestoreConstraint(CcdPhysicsController *ctrl, btType
     return;
   }
 
-  btRigidBody &rbA = con->getRigidBodyA();
-  btRigidBody &rbB = con->getRigidBodyB();
-
-  CcdPhysicsController *other = nullptr;
-
-  if (rbA.getUserPointer() && rbB.getUserPointer()) {
-    CcdPhysicsController *ctrl0 = (CcdPhysicsController *)rbA.getUserPointer();
-    CcdPhysicsController *ctrl1 = (CcdPhysicsController *)rbB.getUserPointer();
-    other = (ctrl0 != ctrl) ? ctrl0 : ctrl1;
-  }
-
-  BLI_assert(other != nullptr);
+  CcdPhysicsController *ctrl0 = (CcdPhysicsController *)con->getRigidBodyA().getUserPointer();
+  CcdPhysicsController *ctrl1 = (CcdPhysicsController *)con->getRigidBodyB().getUserPointer();
+  // nullptr for a constraint to the fixed body of the world.
+  CcdPhysicsController *other = (ctrl0 != ctrl) ? ctrl0 : ctrl1;
 
   // Avoid add constraint if one of the objects are not available.
-  if (IsActiveCcdPhysicsController(other)) {
+  if (!other || IsActiveCcdPhysicsController(other)) {
     userData->SetActive(true);
     m_dynamicsWorld->addConstraint(con, userData->GetDisableCollision());
   }
@@ -553,6 +865,11 @@ void CcdPhysicsEnvironment::RestoreConstraint(CcdPhysicsController *ctrl, btType
 bool CcdPhysicsEnvironment::RemoveCcdPhysicsController(CcdPhysicsController *ctrl,
                                                        bool freeConstraints)
 {
+  // A soft body waiting for the serial world isn't in the world.
+  if (CM_ListRemoveIfFound(m_pendingSoftBodies, ctrl)) {
+    return true;
+  }
+
   // if the physics controller is already removed we do nothing
   if (!m_controllers.erase(ctrl)) {
     return false;
@@ -580,7 +897,7 @@ bool CcdPhysicsEnvironment::RemoveCcdPhysicsController(CcdPhysicsController *ctr
   else {
     // if a softbody
     if (ctrl->GetSoftBody()) {
-      m_dynamicsWorld->removeSoftBody(ctrl->GetSoftBody());
+      m_softDynamicsWorld->removeSoftBody(ctrl->GetSoftBody());
     }
     else {
       m_dynamicsWorld->removeCollisionObject(ctrl->GetCollisionObject());
@@ -618,7 +935,7 @@ void CcdPhysicsEnvironment::UpdateCcdPhysicsController(CcdPhysicsController *ctr
       m_dynamicsWorld->addRigidBody(body, newCollisionGroup, newCollisionMask);
     }
     else if (softBody) {
-      m_dynamicsWorld->addSoftBody(softBody);
+      m_softDynamicsWorld->addSoftBody(softBody);
     }
     else {
       m_dynamicsWorld->addCollisionObject(obj, newCollisionGroup, newCollisionMask);
@@ -685,12 +1002,12 @@ void CcdPhysicsEnvironment::SimulationSubtickCallback(btScalar timeStep)
 
 bool CcdPhysicsEnvironment::ProceedDeltaTime(double curTime, float timeStep, float interval)
 {
+  PRF_scope(ProfileCategory::GameEngine);
   std::set<CcdPhysicsController *>::iterator it;
   int i;
 
-  // Update Bullet global variables.
-  gDeactivationTime = m_deactivationTime;
-  gContactBreakingThreshold = m_contactBreakingThreshold;
+  ApplyGlobalSettings();
+  AddPendingSoftBodies();
 
   for (it = m_controllers.begin(); it != m_controllers.end(); it++) {
     (*it)->SynchronizeMotionStates(timeStep);
@@ -727,6 +1044,37 @@ void CcdPhysicsEnvironment::UpdateSoftBodiesRenderedMesh()
   }
 }
 
+bool CcdPhysicsEnvironment::IsParallelStepCompatible(PHY_IPhysicsEnvironment *other) const
+{
+  CcdPhysicsEnvironment *otherEnv = dynamic_cast<CcdPhysicsEnvironment *>(other);
+  if (!otherEnv) {
+    return true;
+  }
+
+  /* The multithreaded world already uses all the threads and Bullet thread indices are global,
+   * step it alone. */
+  if (m_worldType == PHY_WORLD_MULTITHREAD || otherEnv->m_worldType == PHY_WORLD_MULTITHREAD) {
+    return false;
+  }
+
+  /* gDeactivationTime and gContactBreakingThreshold are Bullet global variables set
+   * at each ProceedDeltaTime, the environments can't run concurrently with different values. */
+  return (m_deactivationTime == otherEnv->m_deactivationTime &&
+          m_contactBreakingThreshold == otherEnv->m_contactBreakingThreshold);
+}
+
+void CcdPhysicsEnvironment::ApplyGlobalSettings()
+{
+  /* Only write the Bullet global variables when they change, the environments stepped in
+   * parallel share the same values already set from the main thread. */
+  if (gDeactivationTime != m_deactivationTime) {
+    gDeactivationTime = m_deactivationTime;
+  }
+  if (gContactBreakingThreshold != m_contactBreakingThreshold) {
+    gContactBreakingThreshold = m_contactBreakingThreshold;
+  }
+}
+
 class ClosestRayResultCallbackNotMe : public btCollisionWorld::ClosestRayResultCallback {
   btCollisionObject *m_owner;
   btCollisionObject *m_parent;
@@ -994,21 +1342,43 @@ void CcdPhysicsEnvironment::SetSolverType(PHY_SolverType solverType)
     return;
   }
 
-  switch (solverType) {
-    case PHY_SOLVER_SEQUENTIAL: {
-      m_solver = new btSequentialImpulseConstraintSolver();
-      break;
-    }
+  m_solverType = solverType;
 
-    case PHY_SOLVER_NNCG: {
-      m_solver = new btNNCGConstraintSolver();
-      break;
-    }
-    default: {
-      BLI_assert(false);
+  // The solver of the large islands can't be replaced in the multithreaded world.
+  if (m_worldType == PHY_WORLD_MULTITHREAD) {
+    RebuildDynamicsWorld();
+    return;
+  }
+
+  btConstraintSolver *solver = NewWorldConstraintSolver();
+  m_dynamicsWorld->setConstraintSolver(solver);
+  delete m_solver;
+  m_solver = solver;
+}
+
+void CcdPhysicsEnvironment::SetWorldType(PHY_WorldType worldType)
+{
+  if (m_worldType == worldType) {
+    return;
+  }
+
+  if (worldType == PHY_WORLD_MULTITHREAD) {
+    for (CcdPhysicsController *ctrl : m_controllers) {
+      if (ctrl->GetSoftBody()) {
+        CM_Warning("soft bodies are not supported by the multithreaded physics world, "
+                   "keeping the serial world");
+        return;
+      }
     }
-  };
-  m_solverType = solverType;
+  }
+
+  m_worldType = worldType;
+  RebuildDynamicsWorld();
+}
+
+PHY_WorldType CcdPhysicsEnvironment::GetWorldType() const
+{
+  return m_worldType;
 }
 
 void CcdPhysicsEnvironment::GetGravity(MT_Vector3 &grav)
@@ -1023,7 +1393,9 @@ void CcdPhysicsEnvironment::SetGravity(float x, float y, float z)
 {
   m_gravity = btVector3(x, y, z);
   m_dynamicsWorld->setGravity(m_gravity);
-  m_dynamicsWorld->getWorldInfo().m_gravity.setValue(x, y, z);
+  if (m_softDynamicsWorld) {
+    m_softDynamicsWorld->getWorldInfo().m_gravity.setValue(x, y, z);
+  }
 }
 
 static int gConstraintUid = 1;
@@ -1302,6 +1674,86 @@ PHY_IPhysicsController *CcdPhysicsEnvironment::RayTest(PHY_IRayCastFilterCallbac
   return result.m_controller;
 }
 
+/// Closest ray callback ignoring the sensors and the controllers out of a collision group mask.
+struct MaskClosestRayResultCallback : public btCollisionWorld::ClosestRayResultCallback {
+  unsigned short m_groupMask;
+
+  MaskClosestRayResultCallback(const btVector3 &rayFrom,
+                               const btVector3 &rayTo,
+                               unsigned short groupMask)
+      : btCollisionWorld::ClosestRayResultCallback(rayFrom, rayTo), m_groupMask(groupMask)
+  {
+    m_collisionFilterMask = CcdConstructionInfo::AllFilter ^ CcdConstructionInfo::SensorFilter;
+    m_flags |= btTriangleRaycastCallback::kF_UseSubSimplexConvexCastRaytest;
+  }
+
+  virtual bool needsCollision(btBroadphaseProxy *proxy0) const
+  {
+    if (!ClosestRayResultCallback::needsCollision(proxy0)) {
+      return false;
+    }
+    btCollisionObject *object = (btCollisionObject *)proxy0->m_clientObject;
+    CcdPhysicsController *phyCtrl = static_cast<CcdPhysicsController *>(object->getUserPointer());
+    return (phyCtrl && (phyCtrl->GetCollisionGroup() & m_groupMask));
+  }
+};
+
+struct RayTestBatchTaskData {
+  const btCollisionWorld *world;
+  const MT_Vector3 *from;
+  const MT_Vector3 *to;
+  unsigned short mask;
+  PHY_RayCastBatchResult *results;
+};
+
+static void ray_test_batch_task_func(void *__restrict userdata,
+                                     const int iter,
+                                     const TaskParallelTLS *__restrict /*tls*/)
+{
+  const RayTestBatchTaskData *data = (const RayTestBatchTaskData *)userdata;
+  const btVector3 rayFrom = ToBullet(data->from[iter]);
+  const btVector3 rayTo = ToBullet(data->to[iter]);
+  PHY_RayCastBatchResult &result = data->results[iter];
+
+  MaskClosestRayResultCallback rayCallback(rayFrom, rayTo, data->mask);
+  data->world->rayTest(rayFrom, rayTo, rayCallback);
+
+  if (!rayCallback.hasHit()) {
+    result = PHY_RayCastBatchResult();
+    return;
+  }
+
+  btVector3 &normal = rayCallback.m_hitNormalWorld;
+  if (normal.length2() > (SIMD_EPSILON * SIMD_EPSILON)) {
+    normal.normalize();
+  }
+  else {
+    normal.setValue(1.0f, 0.0f, 0.0f);
+  }
+
+  result.m_controller = static_cast<CcdPhysicsController *>(
+      rayCallback.m_collisionObject->getUserPointer());
+  result.m_hitPoint = ToMoto(rayCallback.m_hitPointWorld);
+  result.m_hitNormal = ToMoto(normal);
+  result.m_distance = rayCallback.m_closestHitFraction * rayFrom.distance(rayTo);
+}
+
+void CcdPhysicsEnvironment::RayTestBatch(const MT_Vector3 *from,
+                                         const MT_Vector3 *to,
+                                         unsigned int count,
+                                         unsigned short mask,
+                                         PHY_RayCastBatchResult *results)
+{
+  RayTestBatchTaskData data = {m_dynamicsWorld, from, to, mask, results};
+
+  /* The ray tests only read the world, the broadphase uses a stack per call when Bullet is
+   * thread safe. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 16;
+  BLI_task_parallel_range(0, count, &data, ray_test_batch_task_func, &settings);
+}
+
 int CcdPhysicsEnvironment::GetNumContactPoints()
 {
   return 0;
@@ -1339,6 +1791,12 @@ void CcdPhysicsEnvironment::MergeEnvironment(PHY_IPhysicsEnvironment *other_env)
     other->RemoveCcdPhysicsController(ctrl, true);
     this->AddCcdPhysicsController(ctrl);
   }
+
+  while (!other->m_pendingSoftBodies.empty()) {
+    CcdPhysicsController *ctrl = other->m_pendingSoftBodies.back();
+    other->RemoveCcdPhysicsController(ctrl, true);
+    this->AddCcdPhysicsController(ctrl);
+  }
 }
 
 CcdPhysicsEnvironment::~CcdPhysicsEnvironment()
@@ -1348,15 +1806,8 @@ CcdPhysicsEnvironment::~CcdPhysicsEnvironment()
   // m_broadphase->DestroyScene();
   // delete broadphase ? release reference on broadphase ?
 
-  // first delete scene, then dispatcher, because pairs have to release manifolds on the dispatcher
-  // delete m_dispatcher;
-  delete m_dynamicsWorld;
-
-  if (nullptr != m_ownDispatcher)
-    delete m_ownDispatcher;
-
-  if (nullptr != m_solver)
-    delete m_solver;
+  DeleteDynamicsWorld();
+  delete m_pendingSoftBodyWorldInfo;
 
   if (nullptr != m_debugDrawer)
     delete m_debugDrawer;
@@ -1423,6 +1874,9 @@ bool CcdPhysicsEnvironment::RequestCollisionCallback(PHY_IPhysicsController *ctr
 
 void CcdPhysicsEnvironment::CallbackTriggers()
 {
+  // The data reported during the previous tick were consumed by the logic since.
+  m_collDataArena.clear();
+
   if (!m_triggerCallbacks[PHY_OBJECT_RESPONSE]) {
     return;
   }
@@ -1430,7 +1884,11 @@ void CcdPhysicsEnvironment::CallbackTriggers()
   // Walk over all overlapping pairs, and if one of the involved bodies is registered for trigger
   // callback, perform callback
   btDispatcher *dispatcher = m_dynamicsWorld->getDispatcher();
-  for (unsigned int i = 0, numManifolds = dispatcher->getNumManifolds(); i < numManifolds; i++) {
+  const unsigned int numManifolds = dispatcher->getNumManifolds();
+  /* At most one data per manifold, reserving them all ensures that the arena is never
+   * reallocated while the reported data are referenced. */
+  m_collDataArena.reserve(numManifolds);
+  for (unsigned int i = 0; i < numManifolds; i++) {
     btPersistentManifold *manifold = dispatcher->getManifoldByIndexInternal(i);
     if (manifold->getNumContacts() == 0) {
       continue;
@@ -1465,7 +1923,8 @@ void CcdPhysicsEnvironment::CallbackTriggers()
       manifold->clearManifold();  // refreshContactPoints(rb0->getCenterOfMassTransform(),rb1->getCenterOfMassTransform());
     }
 
-    const CcdCollData *coll_data = new CcdCollData(manifold);
+    m_collDataArena.emplace_back(manifold);
+    const CcdCollData *coll_data = &m_collDataArena.back();
     m_triggerCallbacks[PHY_OBJECT_RESPONSE](m_triggerCallbacksUserPtrs[PHY_OBJECT_RESPONSE], ctrl0, ctrl1, coll_data, first);
   }
 }
@@ -2106,8 +2565,12 @@ CcdPhysicsEnvironment *CcdPhysicsEnvironment::Create(blender::Scene *blenderscen
       PHY_SOLVER_SEQUENTIAL,  // GAME_SOLVER_SEQUENTIAL
       PHY_SOLVER_NNCG,        // GAME_SOLVER_NNGC
   };
+  static const PHY_WorldType worldTypeTable[] = {
+      PHY_WORLD_SERIAL,       // GAME_PHYSICS_WORLD_SERIAL
+      PHY_WORLD_MULTITHREAD,  // GAME_PHYSICS_WORLD_MULTITHREAD
+  };
   CcdPhysicsEnvironment *ccdPhysEnv = new CcdPhysicsEnvironment(
-      solverTypeTable[blenderscene->gm.solverType]);
+      solverTypeTable[blenderscene->gm.solverType], worldTypeTable[blenderscene->gm.physicsWorld]);
   ccdPhysEnv->SetDebugDrawer(new BlenderDebugDraw());
   ccdPhysEnv->SetDeactivationLinearTreshold(blenderscene->gm.lineardeactthreshold);
   ccdPhysEnv->SetDeactivationAngularTreshold(blenderscene->gm.angulardeactthreshold);
@@ -49,6 +49,24 @@ class PHY_IVehicle;
 class CcdOverlapFilterCallBack;
 class CcdShapeConstructionInfo;
 
+class CcdCollData : public PHY_ICollData {
+  const btPersistentManifold *m_manifoldPoint;
+
+ public:
+  CcdCollData(const btPersistentManifold *manifoldPoint);
+  virtual ~CcdCollData();
+
+  virtual unsigned int GetNumContacts() const;
+  virtual MT_Vector3 GetLocalPointA(unsigned int index, bool first) const;
+  virtual MT_Vector3 GetLocalPointB(unsigned int index, bool first) const;
+  virtual MT_Vector3 GetWorldPoint(unsigned int index, bool first) const;
+  virtual MT_Vector3 GetNormal(unsigned int index, bool first) const;
+  virtual float GetCombinedFriction(unsigned int index, bool first) const;
+  virtual float GetCombinedRollingFriction(unsigned int index, bool first) const;
+  virtual float GetCombinedRestitution(unsigned int index, bool first) const;
+  virtual float GetAppliedImpulse(unsigned int index, bool first) const;
+};
+
 /** CcdPhysicsEnvironment is an experimental mainloop for physics simulation using optional
  * continuous collision detection. Physics Environment takes care of stepping the simulation and is
  * a container for physics entities. It stores rigidbodies,constraints, materials etc. A derived
@@ -64,7 +82,7 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
   void RemoveVehicle(WrapperVehicle *vehicle, bool free);
   /// Remove vehicle wrapper used by a physics controller used as chassis.
   void RemoveVehicle(CcdPhysicsController *ctrl, bool free);
-  /// Restore the constraint if the owner and target are presents.
+  /// Restore the constraint if the owner and the target, when not the world, are presents.
   void RestoreConstraint(CcdPhysicsController *ctrl, btTypedConstraint *con);
 
  protected:
@@ -81,6 +99,7 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
   int m_numTimeSubSteps;
 
   PHY_SolverType m_solverType;
+  PHY_WorldType m_worldType;
 
   float m_deactivationTime;
   float m_linearDeactivationThreshold;
@@ -89,8 +108,26 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
 
   void ProcessFhSprings(double curTime, float timeStep);
 
+  /// Create a single constraint solver matching m_solverType.
+  class btConstraintSolver *NewConstraintSolver() const;
+  /// Create the constraint solver used by the world, a solver pool for the multithreaded world.
+  class btConstraintSolver *NewWorldConstraintSolver() const;
+  /** Create the solver of the large islands of the multithreaded world, the solvers without
+   * multithreaded variant solve these islands in a single thread.
+   */
+  class btConstraintSolver *NewLargeIslandConstraintSolver() const;
+  /// Create the dispatcher, the solvers and the dynamics world matching m_worldType.
+  void CreateDynamicsWorld();
+  void DeleteDynamicsWorld();
+  /** Recreate the dynamics world after a world or solver type change, all the physics
+   * controllers, constraints and vehicles are moved into the new world.
+   */
+  void RebuildDynamicsWorld();
+  /// Switch to the serial world if soft bodies were added to the multithreaded world.
+  void AddPendingSoftBodies();
+
  public:
-  CcdPhysicsEnvironment(PHY_SolverType solverType);
+  CcdPhysicsEnvironment(PHY_SolverType solverType, PHY_WorldType worldType);
 
   virtual ~CcdPhysicsEnvironment();
 
@@ -115,6 +152,8 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
   virtual void SetCFM(float cfm);
   virtual void SetContactBreakingTreshold(float contactBreakingTreshold);
   virtual void SetSolverType(PHY_SolverType solverType);
+  virtual void SetWorldType(PHY_WorldType worldType);
+  virtual PHY_WorldType GetWorldType() const;
   virtual void SetSolverSorConstant(float sor);
   virtual void SetSolverTau(float tau);
   virtual void SetSolverDamping(float damping);
@@ -124,12 +163,20 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
     return m_numTimeSubSteps;
   }
 
+  virtual unsigned int GetNumCollisions() const
+  {
+    return m_collDataArena.size();
+  }
+
   /// Perform an integration step of duration 'timeStep'.
   virtual bool ProceedDeltaTime(double curTime, float timeStep, float interval);
 
   /// Update SoftBodies rendered mesh from bullet softbody simulation.
   virtual void UpdateSoftBodiesRenderedMesh();
 
+  virtual bool IsParallelStepCompatible(PHY_IPhysicsEnvironment *other) const;
+  virtual void ApplyGlobalSettings();
+
   /**
    * Called by Bullet for every physical simulation (sub)tick.
    * Our constructor registers this callback to Bullet, which stores a pointer to 'this' in
@@ -196,6 +243,11 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
                                           float toX,
                                           float toY,
                                           float toZ);
+  virtual void RayTestBatch(const MT_Vector3 *from,
+                            const MT_Vector3 *to,
+                            unsigned int count,
+                            unsigned short mask,
+                            PHY_RayCastBatchResult *results);
 
   // Methods for gamelogic collision/physics callbacks
   virtual void AddSensor(PHY_IPhysicsController *ctrl);
@@ -254,11 +306,22 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
 
   void SyncMotionStates(float timeStep);
 
-  class btSoftRigidDynamicsWorld *GetDynamicsWorld()
+  class btDiscreteDynamicsWorld *GetDynamicsWorld()
   {
     return m_dynamicsWorld;
   }
 
+  /// Return the soft body world, nullptr when the multithreaded world is used.
+  class btSoftRigidDynamicsWorld *GetSoftDynamicsWorld()
+  {
+    return m_softDynamicsWorld;
+  }
+
+  /** Return the world info to create the soft bodies with. With the multithreaded world it's a
+   * placeholder, the soft bodies use the world info of the serial world once added to it.
+   */
+  struct btSoftBodyWorldInfo &GetSoftBodyWorldInfo();
+
   class btConstraintSolver *GetConstraintSolver();
 
   void MergeEnvironment(PHY_IPhysicsEnvironment *other_env);
@@ -287,6 +350,11 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
   PHY_ResponseCallback m_triggerCallbacks[PHY_NUM_RESPONSE];
   void *m_triggerCallbacksUserPtrs[PHY_NUM_RESPONSE];
 
+  /** Collision data of the manifolds reported to the collision callbacks during the last tick.
+   * The storage is reused by the next tick, the reported data are valid until then.
+   */
+  std::vector<CcdCollData> m_collDataArena;
+
   std::vector<WrapperVehicle *> m_wrapperVehicles;
 
   /** use explicit btSoftRigidDynamicsWorld/btDiscreteDynamicsWorld* so that we have access to
@@ -296,9 +364,19 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
    * Ideally we would like to have access to this function from the btDynamicsWorld interface
    */
   // class btDynamicsWorld *m_dynamicsWorld;
-  class btSoftRigidDynamicsWorld *m_dynamicsWorld;
+  class btDiscreteDynamicsWorld *m_dynamicsWorld;
+  /// Same as m_dynamicsWorld for the serial world, nullptr for the multithreaded world.
+  class btSoftRigidDynamicsWorld *m_softDynamicsWorld;
+  /** Soft body controllers added to the multithreaded world, added to the serial world
+   * replacing it at the next simulation step, see AddPendingSoftBodies.
+   */
+  std::vector<CcdPhysicsController *> m_pendingSoftBodies;
+  /// World info of the soft bodies created before the serial world, see GetSoftBodyWorldInfo.
+  struct btSoftBodyWorldInfo *m_pendingSoftBodyWorldInfo;
 
   class btConstraintSolver *m_solver;
+  /// Solver used for large islands by the multithreaded world.
+  class btConstraintSolver *m_solverMt;
 
   class CcdOverlapFilterCallBack *m_filterCallback;
 
@@ -308,21 +386,3 @@ class CcdPhysicsEnvironment : public PHY_IPhysicsEnvironment {
 
   virtual void ExportFile(const std::string &filename);
 };
-
-class CcdCollData : public PHY_ICollData {
-  const btPersistentManifold *m_manifoldPoint;
-
- public:
-  CcdCollData(const btPersistentManifold *manifoldPoint);
-  virtual ~CcdCollData();
-
-  virtual unsigned int GetNumContacts() const;
-  virtual MT_Vector3 GetLocalPointA(unsigned int index, bool first) const;
-  virtual MT_Vector3 GetLocalPointB(unsigned int index, bool first) const;
-  virtual MT_Vector3 GetWorldPoint(unsigned int index, bool first) const;
-  virtual MT_Vector3 GetNormal(unsigned int index, bool first) const;
-  virtual float GetCombinedFriction(unsigned int index, bool first) const;
-  virtual float GetCombinedRollingFriction(unsigned int index, bool first) const;
-  virtual float GetCombinedRestitution(unsigned int index, bool first) const;
-  virtual float GetAppliedImpulse(unsigned int index, bool first) const;
-};
@@ -0,0 +1,222 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file CcdShapeCache.cpp
+ *  \ingroup physbullet
+ */
+
+#include "CcdShapeCache.h"
+
+#include <cstring>
+
+#include "BKE_appdir.hh"
+#include "BLI_fileops.hh"
+#include "BLI_hash_md5.hh"
+#include "BLI_path_utils.hh"
+
+#include "BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "BulletCollision/CollisionShapes/btOptimizedBvh.h"
+
+#include "CM_Message.h"
+#include "KX_Globals.h"
+#include "KX_KetsjiEngine.h"
+
+using namespace blender;
+
+/// Version of the file layout, to increase when it changes.
+static const unsigned int CACHE_VERSION = 1;
+static const char CACHE_MAGIC[8] = {'B', 'G', 'E', 'B', 'V', 'H', '\0', '\0'};
+/// Alignment needed by the in place deserialization of the BVH.
+static const unsigned int CACHE_ALIGNMENT = 16;
+
+/** Header of a cache file followed by the BVH data size, digest and data. The header is
+ * also hashed to name the file, its padding is zeroed.
+ */
+struct CacheHeader {
+  char magic[8];
+  unsigned int version;
+  unsigned int scalarSize;
+  unsigned int bulletVersion;
+  unsigned int numVertices;
+  unsigned int numTriangles;
+  unsigned int quantized;
+  double margin;
+  unsigned char vertexDigest[16];
+  unsigned char triangleDigest[16];
+};
+
+struct CacheData {
+  unsigned int size;
+  unsigned char digest[16];
+};
+
+CcdShapeCache::Bvh::Bvh(void *buffer, btOptimizedBvh *bvh) : m_buffer(buffer), m_bvh(bvh)
+{
+}
+
+CcdShapeCache::Bvh::~Bvh()
+{
+  // The BVH was constructed in the buffer and doesn't own its nodes.
+  m_bvh->~btOptimizedBvh();
+  btAlignedFree(m_buffer);
+}
+
+btOptimizedBvh *CcdShapeCache::Bvh::GetBvh() const
+{
+  return m_bvh;
+}
+
+std::string CcdShapeCache::GetDirectory()
+{
+  char dir[FILE_MAX] = "";
+  switch (KX_GetActiveEngine()->GetPhysicsShapeCache()) {
+    case ShapeCacheNone: {
+      return "";
+    }
+    case ShapeCacheBlendDirectory: {
+      BLI_path_split_dir_part(KX_GetMainPath().c_str(), dir, sizeof(dir));
+      break;
+    }
+    case ShapeCacheUserDirectory: {
+      BKE_appdir_folder_caches(dir, sizeof(dir));
+      break;
+    }
+  }
+
+  if (dir[0] == '\0') {
+    return "";
+  }
+
+  char path[FILE_MAX];
+  BLI_path_join(path, sizeof(path), dir, "bge_cache", "physics");
+  return path;
+}
+
+static CcdShapeCache::Bvh *load_bvh(const char *filepath, const CacheHeader &header)
+{
+  FILE *file = BLI_fopen(filepath, "rb");
+  if (!file) {
+    return nullptr;
+  }
+
+  CacheHeader fileHeader;
+  CacheData data;
+  void *buffer = nullptr;
+  if (fread(&fileHeader, sizeof(CacheHeader), 1, file) == 1 &&
+      memcmp(&fileHeader, &header, sizeof(CacheHeader)) == 0 &&
+      fread(&data, sizeof(CacheData), 1, file) == 1 && data.size > 0)
+  {
+    buffer = btAlignedAlloc(data.size, CACHE_ALIGNMENT);
+    unsigned char digest[16];
+    if (fread(buffer, data.size, 1, file) != 1 ||
+        memcmp(BLI_hash_md5_buffer((const char *)buffer, data.size, digest), data.digest, 16) !=
+            0)
+    {
+      btAlignedFree(buffer);
+      buffer = nullptr;
+    }
+  }
+  fclose(file);
+
+  btOptimizedBvh *bvh = buffer ? btOptimizedBvh::deSerializeInPlace(buffer, data.size, false) :
+                                 nullptr;
+  if (!bvh) {
+    if (buffer) {
+      btAlignedFree(buffer);
+    }
+    CM_Warning("stale physics cache entry \"" << filepath << "\", rebuilding it");
+    return nullptr;
+  }
+
+  return new CcdShapeCache::Bvh(buffer, bvh);
+}
+
+static CcdShapeCache::Bvh *build_bvh(const std::string &directory,
+                                     const char *filepath,
+                                     const CacheHeader &header,
+                                     btStridingMeshInterface *meshInterface)
+{
+  btBvhTriangleMeshShape shape(meshInterface, header.quantized, true);
+  const btOptimizedBvh *built = shape.getOptimizedBvh();
+
+  CacheData data;
+  data.size = built->calculateSerializeBufferSize();
+  void *buffer = btAlignedAlloc(data.size, CACHE_ALIGNMENT);
+  if (!built->serialize(buffer, data.size, false)) {
+    btAlignedFree(buffer);
+    return nullptr;
+  }
+  BLI_hash_md5_buffer((const char *)buffer, data.size, data.digest);
+
+  /* Write in a temporary file renamed once complete, a partially written entry is never read,
+   * even by an other engine instance. */
+  const std::string tmppath = std::string(filepath) + "." +
+                              std::to_string((unsigned long long)buffer) + ".tmp";
+  bool written = false;
+  if (BLI_dir_create_recursive(directory.c_str())) {
+    FILE *file = BLI_fopen(tmppath.c_str(), "wb");
+    if (file) {
+      written = (fwrite(&header, sizeof(CacheHeader), 1, file) == 1 &&
+                 fwrite(&data, sizeof(CacheData), 1, file) == 1 &&
+                 fwrite(buffer, data.size, 1, file) == 1);
+      written = (fclose(file) == 0) && written;
+      written = written && (BLI_rename_overwrite(tmppath.c_str(), filepath) == 0);
+      if (!written) {
+        BLI_delete(tmppath.c_str(), false, false);
+      }
+    }
+  }
+  if (!written) {
+    CM_Warning("failed to write physics cache entry \"" << filepath << "\"");
+  }
+
+  // Use the serialized copy as the shape BVH is freed with the shape.
+  btOptimizedBvh *bvh = btOptimizedBvh::deSerializeInPlace(buffer, data.size, false);
+  return new CcdShapeCache::Bvh(buffer, bvh);
+}
+
+CcdShapeCache::Bvh *CcdShapeCache::GetBvh(btStridingMeshInterface *meshInterface,
+                                          const btAlignedObjectArray<btScalar> &vertices,
+                                          const std::vector<int> &triangles,
+                                          btScalar margin)
+{
+  const unsigned int numTriangles = triangles.size() / 3;
+  if (numTriangles < MIN_TRIANGLES) {
+    return nullptr;
+  }
+
+  const std::string directory = GetDirectory();
+  if (directory.empty()) {
+    return nullptr;
+  }
+
+  CacheHeader header;
+  memset(&header, 0, sizeof(CacheHeader));
+  memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+  header.version = CACHE_VERSION;
+  header.scalarSize = sizeof(btScalar);
+  header.bulletVersion = BT_BULLET_VERSION;
+  header.numVertices = vertices.size() / 3;
+  header.numTriangles = numTriangles;
+  header.quantized = 1;
+  header.margin = margin;
+  BLI_hash_md5_buffer(
+      (const char *)&vertices[0], vertices.size() * sizeof(btScalar), header.vertexDigest);
+  BLI_hash_md5_buffer(
+      (const char *)triangles.data(), triangles.size() * sizeof(int), header.triangleDigest);
+
+  unsigned char digest[16];
+  char name[33 + 4];
+  BLI_hash_md5_to_hexdigest(
+      BLI_hash_md5_buffer((const char *)&header, sizeof(CacheHeader), digest), name);
+  strcat(name, ".bvh");
+
+  char filepath[FILE_MAX];
+  BLI_path_join(filepath, sizeof(filepath), directory.c_str(), name);
+
+  Bvh *bvh = load_bvh(filepath, header);
+  if (!bvh) {
+    bvh = build_bvh(directory, filepath, header, meshInterface);
+  }
+
+  return bvh;
+}
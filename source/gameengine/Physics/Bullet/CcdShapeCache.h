@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file CcdShapeCache.h
+ *  \ingroup physbullet
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "LinearMath/btAlignedObjectArray.h"
+#include "LinearMath/btScalar.h"
+
+class btOptimizedBvh;
+class btStridingMeshInterface;
+
+/** On disk cache of the triangle mesh BVHs. The files are named by a hash of the mesh vertices,
+ * triangles and shape parameters, and their header is compared to the mesh before use to detect
+ * stale or corrupted entries, which are rebuilt.
+ */
+class CcdShapeCache {
+ public:
+  /// BVH loaded from the cache, owning the memory of the BVH shared by the mesh shapes.
+  class Bvh {
+   private:
+    void *m_buffer;
+    btOptimizedBvh *m_bvh;
+
+   public:
+    Bvh(void *buffer, btOptimizedBvh *bvh);
+    ~Bvh();
+
+    btOptimizedBvh *GetBvh() const;
+  };
+
+  /// Minimum number of triangles of a cached mesh, smaller meshes are faster to build than load.
+  static constexpr int MIN_TRIANGLES = 4096;
+
+  /** Return the BVH of a triangle mesh, loaded from the cache or built and stored.
+   * \param meshInterface The mesh interface of the vertices and triangles.
+   * \param margin The margin of the shape.
+   * \return The BVH or nullptr if the cache is disabled or failed.
+   */
+  static Bvh *GetBvh(btStridingMeshInterface *meshInterface,
+                     const btAlignedObjectArray<btScalar> &vertices,
+                     const std::vector<int> &triangles,
+                     btScalar margin);
+
+ private:
+  /// Return the cache directory for the current engine settings, empty if disabled.
+  static std::string GetDirectory();
+};
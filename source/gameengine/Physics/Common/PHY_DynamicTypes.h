@@ -100,3 +100,9 @@ typedef enum PHY_SolverType {
   PHY_SOLVER_SEQUENTIAL,
   PHY_SOLVER_NNCG,
 } PHY_SolverType;
+
+typedef enum PHY_WorldType {
+  PHY_WORLD_NONE,
+  PHY_WORLD_SERIAL,
+  PHY_WORLD_MULTITHREAD,
+} PHY_WorldType;
@@ -78,6 +78,24 @@ struct PHY_RayCastResult {
   }
 };
 
+/**
+ * pass back information from RayTestBatch, for one ray
+ */
+struct PHY_RayCastBatchResult {
+  PHY_IPhysicsController *m_controller;  // nullptr if the ray didn't hit anything
+  MT_Vector3 m_hitPoint;
+  MT_Vector3 m_hitNormal;
+  float m_distance;  // distance from the ray origin to the hit point
+
+  PHY_RayCastBatchResult()
+      : m_controller(nullptr),
+        m_hitPoint(0.0f, 0.0f, 0.0f),
+        m_hitNormal(0.0f, 0.0f, 0.0f),
+        m_distance(0.0f)
+  {
+  }
+};
+
 
 /**
  * This class replaces the ignoreController parameter of rayTest function.
@@ -126,6 +144,21 @@ class PHY_IPhysicsEnvironment {
   /// Update SoftBodies rendered mesh from bullet softbody simulation.
   virtual void UpdateSoftBodiesRenderedMesh() = 0;
 
+  /** Return true if this environment can proceed at the same time as \a other in an other
+   * thread, false if they share a global state (e.g Bullet global settings).
+   */
+  virtual bool IsParallelStepCompatible(PHY_IPhysicsEnvironment *other) const
+  {
+    return true;
+  }
+
+  /** Copy the settings of this environment to the global state shared by all the environments.
+   * Called from the main thread before proceeding environments in parallel.
+   */
+  virtual void ApplyGlobalSettings()
+  {
+  }
+
   /// draw debug lines (make sure to call this during the render phase, otherwise lines are not
   /// drawn properly)
   virtual void DebugDrawWorld()
@@ -154,6 +187,11 @@ class PHY_IPhysicsEnvironment {
   {
     return 0;
   }
+  /// Return the number of collisions reported to the collision callbacks during the last tick.
+  virtual unsigned int GetNumCollisions() const
+  {
+    return 0;
+  }
   /// setDeactivationTime sets the minimum time that an objects has to stay within the velocity
   /// thresholds until it gets fully deactivated
   virtual void SetDeactivationTime(float dTime)
@@ -194,6 +232,14 @@ class PHY_IPhysicsEnvironment {
   virtual void SetSolverType(PHY_SolverType solverType)
   {
   }
+  /// setWorldType chooses between the serial and the multithreaded simulation world
+  virtual void SetWorldType(PHY_WorldType worldType)
+  {
+  }
+  virtual PHY_WorldType GetWorldType() const
+  {
+    return PHY_WORLD_NONE;
+  }
   /// setTau sets the spring constant of a penalty based solver
   virtual void SetSolverTau(float tau)
   {
@@ -242,6 +288,16 @@ class PHY_IPhysicsEnvironment {
                                           float toX,
                                           float toY,
                                           float toZ) = 0;
+  /** Cast \a count rays, from \a from[i] to \a to[i], and store the closest hit of each ray in
+   * \a results[i]. Only the controllers with a collision group in \a mask are tested, the rays go
+   * through the other ones. The rays can be cast in parallel, the world must not be modified
+   * during the call.
+   */
+  virtual void RayTestBatch(const MT_Vector3 *from,
+                            const MT_Vector3 *to,
+                            unsigned int count,
+                            unsigned short mask,
+                            PHY_RayCastBatchResult *results) = 0;
 
   // Methods for gamelogic collision/physics callbacks
   virtual void AddSensor(PHY_IPhysicsController *ctrl) = 0;
@@ -124,3 +124,14 @@ PHY_IPhysicsController *DummyPhysicsEnvironment::RayTest(
   // collision detection / raytesting
   return nullptr;
 }
+
+void DummyPhysicsEnvironment::RayTestBatch(const MT_Vector3 *from,
+                                           const MT_Vector3 *to,
+                                           unsigned int count,
+                                           unsigned short mask,
+                                           PHY_RayCastBatchResult *results)
+{
+  for (unsigned int i = 0; i < count; ++i) {
+    results[i] = PHY_RayCastBatchResult();
+  }
+}
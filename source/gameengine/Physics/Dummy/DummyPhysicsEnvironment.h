@@ -98,6 +98,11 @@ class DummyPhysicsEnvironment : public PHY_IPhysicsEnvironment {
                                           float toX,
                                           float toY,
                                           float toZ);
+  virtual void RayTestBatch(const MT_Vector3 *from,
+                            const MT_Vector3 *to,
+                            unsigned int count,
+                            unsigned short mask,
+                            PHY_RayCastBatchResult *results);
 
   // gamelogic callbacks
   virtual void AddSensor(PHY_IPhysicsController *ctrl)
@@ -48,7 +48,9 @@ RAS_MeshObject::RAS_MeshObject(blender::Mesh *mesh,
       m_layersInfo(layersInfo),
       m_mesh(mesh),
       m_conversionTotverts(conversionTotverts),
-      m_originalOb(originalOb)
+      m_originalOb(originalOb),
+      m_displayArraysBuilt(true),
+      m_tangentsBuilt(true)
 {
 }
 
@@ -100,11 +102,13 @@ RAS_MeshMaterial *RAS_MeshObject::GetMeshMaterialBlenderIndex(unsigned int index
 
 int RAS_MeshObject::NumPolygons()
 {
+  EnsureDisplayArrays();
   return m_polygons.size();
 }
 
 RAS_Polygon *RAS_MeshObject::GetPolygon(int num)
 {
+  EnsureDisplayArrays();
   return &m_polygons[num];
 }
 
@@ -209,8 +213,60 @@ unsigned int RAS_MeshObject::AddVertex(RAS_MeshMaterial *meshmat,
   return offset;
 }
 
-RAS_IDisplayArray *RAS_MeshObject::GetDisplayArray(unsigned int matid) const
+void RAS_MeshObject::SetBuilder(Builder *builder)
 {
+  m_builder.reset(builder);
+  m_displayArraysBuilt = (builder == nullptr);
+  m_tangentsBuilt = (builder == nullptr);
+}
+
+void RAS_MeshObject::EnsureDisplayArrays()
+{
+  if (m_displayArraysBuilt) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_buildMutex);
+  if (m_displayArraysBuilt) {
+    return;
+  }
+
+  m_sharedvertex_map.resize(m_conversionTotverts);
+  m_builder->BuildDisplayArrays(this);
+  EndConversion();
+
+  m_displayArraysBuilt = true;
+}
+
+bool RAS_MeshObject::HasDisplayArrays() const
+{
+  return m_displayArraysBuilt;
+}
+
+void RAS_MeshObject::EnsureTangents()
+{
+  EnsureDisplayArrays();
+
+  std::lock_guard<std::mutex> lock(m_buildMutex);
+  if (m_tangentsBuilt) {
+    return;
+  }
+
+  m_builder->BuildTangents(this);
+  m_tangentsBuilt = true;
+  // Nothing else to build, release the data used by the builder.
+  m_builder.reset();
+}
+
+bool RAS_MeshObject::HasTangents() const
+{
+  return m_tangentsBuilt;
+}
+
+RAS_IDisplayArray *RAS_MeshObject::GetDisplayArray(unsigned int matid)
+{
+  EnsureDisplayArrays();
+
   RAS_MeshMaterial *mmat = GetMeshMaterial(matid);
 
   if (!mmat)
@@ -234,11 +290,19 @@ RAS_IVertex *RAS_MeshObject::GetVertex(unsigned int matid, unsigned int index)
 
 const float *RAS_MeshObject::GetVertexLocation(unsigned int orig_index)
 {
+  EnsureDisplayArrays();
+
   std::vector<SharedVertex> &sharedmap = m_sharedvertex_map[orig_index];
   std::vector<SharedVertex>::iterator it = sharedmap.begin();
   return it->m_darray->GetVertex(it->m_offset)->getXYZ();
 }
 
+const RAS_MeshObject::SharedVertexMap &RAS_MeshObject::GetSharedVertexMap()
+{
+  EnsureDisplayArrays();
+  return m_sharedvertex_map;
+}
+
 void RAS_MeshObject::EndConversion()
 {
 #if 0
@@ -36,7 +36,10 @@
 #  pragma warning(disable : 4786)
 #endif
 
+#include <atomic>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -83,6 +86,27 @@ class RAS_MeshObject {
     unsigned short activeUv;
   };
 
+  /** Fill the vertices and polygons of the mesh on first use. Rendering doesn't use the
+   * display arrays, only the physics shapes, ray casts and python mesh access do.
+   */
+  class Builder {
+   public:
+    virtual ~Builder() = default;
+
+    /// Add the vertices and polygons of the mesh to its display arrays.
+    virtual void BuildDisplayArrays(RAS_MeshObject *meshobj) = 0;
+    /// Set the tangents of the vertices in the built display arrays.
+    virtual void BuildTangents(RAS_MeshObject *meshobj) = 0;
+  };
+
+  // for construction to find shared vertices
+  struct SharedVertex {
+    RAS_IDisplayArray *m_darray;
+    int m_offset;
+  };
+
+  using SharedVertexMap = std::vector<std::vector<SharedVertex>>;
+
  private:
   std::string m_name;
 
@@ -90,6 +114,17 @@ class RAS_MeshObject {
 
   std::vector<RAS_Polygon> m_polygons;
 
+  SharedVertexMap m_sharedvertex_map;
+
+  std::unique_ptr<Builder> m_builder;
+  /// Protect the build of the display arrays and tangents called from any thread.
+  std::mutex m_buildMutex;
+  std::atomic<bool> m_displayArraysBuilt;
+  std::atomic<bool> m_tangentsBuilt;
+
+  /// Construct the vertex caches once the display arrays are filled.
+  void EndConversion();
+
  protected:
   RAS_MeshMaterialList m_materials;
   blender::Mesh *m_mesh;
@@ -140,26 +175,31 @@ class RAS_MeshObject {
                                  const bool flat,
                                  const unsigned int origindex);
 
+  /** Set the builder of the display arrays, without builder the display arrays are
+   * considered filled.
+   */
+  void SetBuilder(Builder *builder);
+
+  /// Build the display arrays if not already done, called by the vertex and polygon access.
+  void EnsureDisplayArrays();
+  bool HasDisplayArrays() const;
+
+  /// Set the vertex tangents, computed on demand as only the python vertex access use them.
+  void EnsureTangents();
+  bool HasTangents() const;
+
   // vertex and polygon acces
-  RAS_IDisplayArray *GetDisplayArray(unsigned int matid) const;
+  RAS_IDisplayArray *GetDisplayArray(unsigned int matid);
   RAS_IVertex *GetVertex(unsigned int matid, unsigned int index);
   const float *GetVertexLocation(unsigned int orig_index);
+  /// Return the display array vertices of each blender vertex.
+  const SharedVertexMap &GetSharedVertexMap();
 
   int NumPolygons();
   RAS_Polygon *GetPolygon(int num);
 
-  void EndConversion();
-
   /// Return the list of blender's layers.
   const LayersInfo &GetLayersInfo() const;
 
   blender::Object *GetOriginalObject();
-
-  // for construction to find shared vertices
-  struct SharedVertex {
-    RAS_IDisplayArray *m_darray;
-    int m_offset;
-  };
-
-  std::vector<std::vector<SharedVertex>> m_sharedvertex_map;
 };
@@ -15,6 +15,10 @@ using namespace blender;
 
 static CM_ThreadMutex scheduleMutex;
 static CM_ThreadMutex transformMutex;
+static CM_ThreadMutex renderMutex;
+
+/// Callbacks collected instead of called by the thread running UpdateWorldDataDeferred.
+static thread_local SG_DeferredCallbacks *deferredCallbacks = nullptr;
 
 SG_Node::SG_Node(void *clientobj, void *clientinfo, SG_Callbacks &callbacks)
     : SG_QList(),
@@ -30,6 +34,7 @@ SG_Node::SG_Node(void *clientobj, void *clientinfo, SG_Callbacks &callbacks)
       m_worldScaling(1.0f, 1.0f, 1.0f),
       m_parent_relation(nullptr),
       m_familly(new SG_Familly()),
+      m_renderLink(this),
       m_modified(true),
       m_dirty(DIRTY_NONE)
 {
@@ -50,12 +55,17 @@ SG_Node::SG_Node(const SG_Node &other)
       m_worldScaling(other.m_worldScaling),
       m_parent_relation(other.m_parent_relation->NewCopy()),
       m_familly(new SG_Familly()),
+      m_renderLink(this),
       m_dirty(DIRTY_NONE)
 {
 }
 
 SG_Node::~SG_Node()
 {
+  renderMutex.Lock();
+  m_renderLink.Delink();
+  renderMutex.Unlock();
+
   SGControllerList::iterator contit;
 
   for (contit = m_SGcontrollers.begin(); contit != m_SGcontrollers.end(); ++contit) {
@@ -250,6 +260,51 @@ void SG_Node::UpdateWorldDataThreadSchedule(double time, bool parentUpdated)
   }
 }
 
+void SG_Node::UpdateWorldDataDeferred(SG_Node *const *nodes,
+                                      unsigned int count,
+                                      double time,
+                                      SG_DeferredCallbacks &callbacks)
+{
+  deferredCallbacks = &callbacks;
+
+  /* The list is local to the calling thread, put the top parents in front as Schedule does
+   * so that a child updated by its parent leaves the list before its turn. */
+  SG_QList head;
+  for (unsigned int i = 0; i < count; ++i) {
+    SG_Node *node = nodes[i];
+    if (node->m_SGparent) {
+      head.AddBack(node);
+    }
+    else {
+      head.AddFront(node);
+    }
+  }
+
+  SG_Node *node;
+  while ((node = static_cast<SG_Node *>(head.Remove())) != nullptr) {
+    node->UpdateWorldData(time);
+  }
+
+  deferredCallbacks = nullptr;
+}
+
+void SG_Node::FlushDeferredCallbacks(SG_DeferredCallbacks &callbacks)
+{
+  for (SG_Node *node : callbacks.m_transformed) {
+    node->ActivateUpdateTransformCallback();
+  }
+  for (SG_Node *node : callbacks.m_scheduled) {
+    node->ActivateScheduleUpdateCallback();
+  }
+  for (SG_Node *node : callbacks.m_rendered) {
+    node->ActivateRenderUpdateCallback();
+  }
+
+  callbacks.m_transformed.clear();
+  callbacks.m_scheduled.clear();
+  callbacks.m_rendered.clear();
+}
+
 void SG_Node::SetSimulatedTime(double time, bool recurse)
 {
   // update the controllers of this node.
@@ -318,6 +373,44 @@ SG_Node *SG_Node::GetNextRescheduled(SG_QList &head)
   return result;
 }
 
+void SG_Node::Unschedule()
+{
+  scheduleMutex.Lock();
+  Delink();
+  QDelink();
+  scheduleMutex.Unlock();
+
+  renderMutex.Lock();
+  m_renderLink.Delink();
+  renderMutex.Unlock();
+}
+
+bool SG_Node::ScheduleRender(SG_DList &head)
+{
+  renderMutex.Lock();
+  const bool result = head.AddBack(&m_renderLink);
+  renderMutex.Unlock();
+
+  return result;
+}
+
+void SG_Node::RequestRenderUpdate()
+{
+  ActivateRenderUpdateCallback();
+}
+
+SG_Node *SG_Node::GetFirstRender(SG_DList &head)
+{
+  SG_DList *link = head.Peek();
+  return (link == head.Self()) ? nullptr : static_cast<SG_NodeLink *>(link)->GetNode();
+}
+
+SG_Node *SG_Node::GetNextRender(SG_DList &head)
+{
+  SG_DList *link = m_renderLink.Peek();
+  return (link == head.Self()) ? nullptr : static_cast<SG_NodeLink *>(link)->GetNode();
+}
+
 void SG_Node::AddSGController(SG_Controller *cont)
 {
   m_SGcontrollers.push_back(cont);
@@ -362,6 +455,15 @@ void *SG_Node::GetSGClientInfo() const
 void SG_Node::SetSGClientInfo(void *clientInfo)
 {
   m_SGclientInfo = clientInfo;
+
+  // The render list is owned by the client, move the node to the new client list.
+  renderMutex.Lock();
+  const bool scheduled = m_renderLink.Delink();
+  renderMutex.Unlock();
+
+  if (scheduled) {
+    ActivateRenderUpdateCallback();
+  }
 }
 
 void SG_Node::SetControllerTime(double time)
@@ -375,6 +477,7 @@ void SG_Node::ClearModified()
 {
   m_modified = false;
   m_dirty = DIRTY_ALL;
+  ActivateRenderUpdateCallback();
 }
 
 void SG_Node::SetModified()
@@ -386,6 +489,12 @@ void SG_Node::SetModified()
 void SG_Node::ClearDirty(DirtyFlag flag)
 {
   m_dirty &= ~flag;
+
+  if (flag & DIRTY_RENDER) {
+    renderMutex.Lock();
+    m_renderLink.Delink();
+    renderMutex.Unlock();
+  }
 }
 
 void SG_Node::SetParentRelation(SG_ParentRelation *relation)
@@ -613,6 +722,10 @@ void SG_Node::ActivateDestructionCallback()
 void SG_Node::ActivateUpdateTransformCallback()
 {
   if (m_callbacks.m_updatefunc) {
+    if (deferredCallbacks) {
+      deferredCallbacks->m_transformed.push_back(this);
+      return;
+    }
     // Call client provided update func.
     transformMutex.Lock();
     m_callbacks.m_updatefunc(this, m_SGclientObject, m_SGclientInfo);
@@ -622,6 +735,16 @@ void SG_Node::ActivateUpdateTransformCallback()
 
 bool SG_Node::ActivateScheduleUpdateCallback()
 {
+  /* The nodes of a deferred update are only in the list local to the updating thread,
+   * the same early check is done without lock. */
+  if (deferredCallbacks) {
+    if (!Empty()) {
+      return false;
+    }
+    deferredCallbacks->m_scheduled.push_back(this);
+    return true;
+  }
+
   // HACK, this check assumes that the scheduled nodes are put on a DList (see SG_Node.h)
   // The early check on Empty() allows up to avoid calling the callback function
   // when the node is already scheduled for update.
@@ -643,3 +766,20 @@ void SG_Node::ActivateRecheduleUpdateCallback()
     m_callbacks.m_reschedulefunc(this, m_SGclientObject, m_SGclientInfo);
   }
 }
+
+void SG_Node::ActivateRenderUpdateCallback()
+{
+  if (deferredCallbacks) {
+    deferredCallbacks->m_rendered.push_back(this);
+    return;
+  }
+
+  // Same early check as in ActivateScheduleUpdateCallback to skip nodes already in the list.
+  renderMutex.Lock();
+  const bool empty = m_renderLink.Empty();
+  renderMutex.Unlock();
+
+  if (empty && m_callbacks.m_renderfunc) {
+    m_callbacks.m_renderfunc(this, m_SGclientObject, m_SGclientInfo);
+  }
+}
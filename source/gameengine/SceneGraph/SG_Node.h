@@ -26,6 +26,7 @@ typedef void *(*SG_DestructionNewCallback)(SG_Node *sgnode, void *clientobj, voi
 typedef void (*SG_UpdateTransformCallback)(SG_Node *sgnode, void *clientobj, void *clientinfo);
 typedef bool (*SG_ScheduleUpdateCallback)(SG_Node *sgnode, void *clientobj, void *clientinfo);
 typedef bool (*SG_RescheduleUpdateCallback)(SG_Node *sgnode, void *clientobj, void *clientinfo);
+typedef bool (*SG_RenderUpdateCallback)(SG_Node *sgnode, void *clientobj, void *clientinfo);
 
 /**
  * SG_Callbacks hold 2 call backs to the outside world.
@@ -48,7 +49,8 @@ struct SG_Callbacks {
         m_destructionfunc(nullptr),
         m_updatefunc(nullptr),
         m_schedulefunc(nullptr),
-        m_reschedulefunc(nullptr)
+        m_reschedulefunc(nullptr),
+        m_renderfunc(nullptr)
   {
   }
 
@@ -56,12 +58,14 @@ struct SG_Callbacks {
                SG_DestructionNewCallback destructfunc,
                SG_UpdateTransformCallback updatefunc,
                SG_ScheduleUpdateCallback schedulefunc,
-               SG_RescheduleUpdateCallback reschedulefunc)
+               SG_RescheduleUpdateCallback reschedulefunc,
+               SG_RenderUpdateCallback renderfunc)
       : m_replicafunc(repfunc),
         m_destructionfunc(destructfunc),
         m_updatefunc(updatefunc),
         m_schedulefunc(schedulefunc),
-        m_reschedulefunc(reschedulefunc)
+        m_reschedulefunc(reschedulefunc),
+        m_renderfunc(renderfunc)
   {
   }
 
@@ -70,10 +74,40 @@ struct SG_Callbacks {
   SG_UpdateTransformCallback m_updatefunc;
   SG_ScheduleUpdateCallback m_schedulefunc;
   SG_RescheduleUpdateCallback m_reschedulefunc;
+  SG_RenderUpdateCallback m_renderfunc;
 };
 
 typedef std::vector<SG_Node *> NodeList;
 
+/**
+ * Nodes whose client callbacks were requested during SG_Node::UpdateWorldDataDeferred,
+ * the callbacks are called later by SG_Node::FlushDeferredCallbacks.
+ */
+struct SG_DeferredCallbacks {
+  NodeList m_transformed;
+  NodeList m_scheduled;
+  NodeList m_rendered;
+};
+
+/**
+ * Link of a node in an intrusive list other than the update schedule one,
+ * used for the list of nodes to synchronize with the renderer.
+ */
+class SG_NodeLink : public SG_DList {
+ private:
+  SG_Node *m_node;
+
+ public:
+  SG_NodeLink(SG_Node *node) : m_node(node)
+  {
+  }
+
+  SG_Node *GetNode() const
+  {
+    return m_node;
+  }
+};
+
 /**
  * Scenegraph node.
  */
@@ -193,6 +227,46 @@ class SG_Node : public SG_QList {
    */
   static SG_Node *GetNextRescheduled(SG_QList &head);
 
+  /**
+   * Update the world data of scheduled nodes already removed from the scene list without
+   * taking the global locks. The nodes must be all the scheduled nodes of their families and
+   * no other thread may update these families. The client callbacks requested during the
+   * update are collected in \a callbacks.
+   */
+  static void UpdateWorldDataDeferred(SG_Node *const *nodes,
+                                      unsigned int count,
+                                      double time,
+                                      SG_DeferredCallbacks &callbacks);
+
+  /**
+   * Call the client callbacks collected by UpdateWorldDataDeferred, from a single thread,
+   * and clear them.
+   */
+  static void FlushDeferredCallbacks(SG_DeferredCallbacks &callbacks);
+
+  /**
+   * Remove this node from the update, reschedule and render lists.
+   */
+  void Unschedule();
+
+  /**
+   * Put this node in the list of nodes to synchronize with the renderer.
+   * The node leaves the list when DIRTY_RENDER is cleared.
+   */
+  bool ScheduleRender(SG_DList &head);
+
+  /**
+   * Request a render synchronization of this node without changing its dirty flags.
+   */
+  void RequestRenderUpdate();
+
+  /**
+   * Used to iterate over a list filled by ScheduleRender, the next node must
+   * be fetched before the current one leaves the list.
+   */
+  static SG_Node *GetFirstRender(SG_DList &head);
+  SG_Node *GetNextRender(SG_DList &head);
+
   /**
    * Node replication functions.
    */
@@ -335,6 +409,7 @@ class SG_Node : public SG_QList {
   void ActivateUpdateTransformCallback();
   bool ActivateScheduleUpdateCallback();
   void ActivateRecheduleUpdateCallback();
+  void ActivateRenderUpdateCallback();
 
   /**
    * Update the world coordinates of this spatial node. This also informs
@@ -375,6 +450,9 @@ class SG_Node : public SG_QList {
   std::shared_ptr<SG_Familly> m_familly;
   CM_ThreadMutex m_mutex;
 
+  /// Link in the list of nodes to synchronize with the renderer.
+  SG_NodeLink m_renderLink;
+
   bool m_modified;
   unsigned short m_dirty;
 };
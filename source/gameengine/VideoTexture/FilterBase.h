@@ -54,6 +54,18 @@ class FilterBase {
     return filter(src, x, y, size, pixSize, convertPrevious(src, x, y, size, pixSize));
   }
 
+  /** convert a row of pixels to dst, return false if a filter of the chain can't filter rows
+   * the row starts at x = 0, src points to its first pixel */
+  template<class SRC>
+  bool convertRow(
+      SRC src, short y, short *size, unsigned int pixSize, unsigned int *dst, short count)
+  {
+    if (m_previous != nullptr &&
+        !m_previous->m_filter->convertRow(src, y, size, pixSize, dst, count))
+      return false;
+    return filterRow(src, y, size, pixSize, dst, count);
+  }
+
   /// get previous filter
   PyFilter *getPrevious(void)
   {
@@ -98,12 +110,53 @@ class FilterBase {
     return val;
   }
 
+  /** filter a row of pixels, dst holds the values converted by the previous filters
+   * return false if the filter can only be used per pixel */
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return false;
+  }
+  /// filter a row of pixels, source int buffer
+  virtual bool filterRow(unsigned int *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return false;
+  }
+  /// filter a row of pixels, source float buffer
+  virtual bool filterRow(float *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return false;
+  }
+
   /// get source pixel size
   virtual unsigned int getPixelSize(void)
   {
     return 1;
   }
 
+  /// get source pixels of a row in dst if there is no previous filter, as convertPrevious
+  template<class SRC>
+  void convertPreviousRow(SRC src, unsigned int pixSize, unsigned int *dst, short count)
+  {
+    if (m_previous == nullptr)
+      for (short x = 0; x < count; ++x, src += pixSize)
+        dst[x] = *src;
+  }
+
   /// get converted pixel from previous filters
   template<class SRC>
   unsigned int convertPrevious(SRC src, short x, short y, short *size, unsigned int pixSize)
@@ -53,6 +53,38 @@ class FilterGray : public FilterBase {
   {
     return tFilter(src, x, y, size, pixSize, val);
   }
+
+  /// filter row template, the filter only depends on the previous value
+  template<class SRC>
+  bool tFilterRow(
+      SRC src, short y, short *size, unsigned int pixSize, unsigned int *dst, short count)
+  {
+    convertPreviousRow(src, pixSize, dst, count);
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = tFilter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
+  /// filter a row of pixels, source int buffer
+  virtual bool filterRow(unsigned int *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
 };
 
 /// type for color matrix
@@ -117,6 +149,38 @@ class FilterColor : public FilterBase {
   {
     return tFilter(src, x, y, size, pixSize, val);
   }
+
+  /// filter row template, the filter only depends on the previous value
+  template<class SRC>
+  bool tFilterRow(
+      SRC src, short y, short *size, unsigned int pixSize, unsigned int *dst, short count)
+  {
+    convertPreviousRow(src, pixSize, dst, count);
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = tFilter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
+  /// filter a row of pixels, source int buffer
+  virtual bool filterRow(unsigned int *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
 };
 
 /// type for color levels
@@ -184,4 +248,36 @@ class FilterLevel : public FilterBase {
   {
     return tFilter(src, x, y, size, pixSize, val);
   }
+
+  /// filter row template, the filter only depends on the previous value
+  template<class SRC>
+  bool tFilterRow(
+      SRC src, short y, short *size, unsigned int pixSize, unsigned int *dst, short count)
+  {
+    convertPreviousRow(src, pixSize, dst, count);
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = tFilter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
+  /// filter a row of pixels, source int buffer
+  virtual bool filterRow(unsigned int *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    return tFilterRow(src, y, size, pixSize, dst, count);
+  }
 };
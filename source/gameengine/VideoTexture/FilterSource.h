@@ -7,6 +7,10 @@
 
 #pragma once
 
+#include <cstring>
+
+#include "BLI_simd.hh"
+
 #include "Common.h"
 #include "FilterBase.h"
 
@@ -36,6 +40,19 @@ class FilterRGB24 : public FilterBase {
     VT_RGBA(val, src[0], src[1], src[2], 0xFF);
     return val;
   }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = FilterRGB24::filter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
 };
 
 /// class for RGBA32 conversion
@@ -68,6 +85,24 @@ class FilterRGBA32 : public FilterBase {
       return val;
     }
   }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    // packed pixels are already in the destination format
+    if (pixSize == 4) {
+      memcpy(dst, src, count * sizeof(unsigned int));
+      return true;
+    }
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = FilterRGBA32::filter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
 };
 
 /// class for BGRA32 conversion
@@ -96,6 +131,33 @@ class FilterBGRA32 : public FilterBase {
     VT_RGBA(val, src[2], src[1], src[0], src[3]);
     return val;
   }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    short x = 0;
+#if BLI_HAVE_SSE2 && !defined(__BIG_ENDIAN__)
+    if (pixSize == 4) {
+      // swap blue and red of 4 packed pixels at once, as VT_SWAPBR
+      const __m128i maskGA = _mm_set1_epi32(int(0xFF00FF00));
+      const __m128i maskR = _mm_set1_epi32(0xFF);
+      for (; x + 4 <= count; x += 4, src += 16) {
+        const __m128i pix = _mm_loadu_si128((const __m128i *)src);
+        const __m128i br = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pix, maskR), 16),
+                                        _mm_and_si128(_mm_srli_epi32(pix, 16), maskR));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_or_si128(_mm_and_si128(pix, maskGA), br));
+      }
+    }
+#endif
+    for (; x < count; ++x, src += pixSize)
+      dst[x] = FilterBGRA32::filter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
 };
 
 /// class for BGR24 conversion
@@ -124,6 +186,19 @@ class FilterBGR24 : public FilterBase {
     VT_RGBA(val, src[2], src[1], src[0], 0xFF);
     return val;
   }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = FilterBGR24::filter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
 };
 
 /// class for Z_buffer conversion
@@ -379,4 +454,17 @@ class FilterYV12 : public FilterBase {
     VT_RGBA(val, red, green, blue, 0xFF);
     return val;
   }
+
+  /// filter a row of pixels, source byte buffer
+  virtual bool filterRow(unsigned char *src,
+                         short y,
+                         short *size,
+                         unsigned int pixSize,
+                         unsigned int *dst,
+                         short count)
+  {
+    for (short x = 0; x < count; ++x, src += pixSize)
+      dst[x] = FilterYV12::filter(src, x, y, size, pixSize, dst[x]);
+    return true;
+  }
 };
@@ -9,6 +9,8 @@
 
 #include <vector>
 
+#include "BLI_task_c.hh"
+
 #include "Common.h"
 #include "EXP_PyObjectPlus.h"
 #include "FilterBase.h"
@@ -178,6 +180,57 @@ class ImageBase {
   /// perform loop detection
   bool loopDetect(ImageBase *img);
 
+  /// data of the task converting image rows
+  template<class FLT, class SRC> struct ConvRowsTaskData {
+    ImageBase *m_image;
+    FLT *m_filter;
+    SRC m_srcBuff;
+    short *m_srcSize;
+    unsigned int m_pixSize;
+  };
+
+  /// convert one row of a not scaled image
+  template<class FLT, class SRC>
+  bool convImageRow(FLT &filter, SRC srcBuff, short *srcSize, unsigned int pixSize, short y)
+  {
+    // rows are stored from the bottom when flipping
+    short dstY = m_flip ? m_size[1] - 1 - y : y;
+    return filter.convertRow(srcBuff + y * srcSize[0] * pixSize,
+                             y,
+                             srcSize,
+                             pixSize,
+                             m_pixelsData + dstY * m_size[0],
+                             m_size[0]);
+  }
+
+  template<class FLT, class SRC>
+  static void convImageRowFunc(void *__restrict userdata,
+                               const int iter,
+                               const blender::TaskParallelTLS *__restrict /*tls*/)
+  {
+    ConvRowsTaskData<FLT, SRC> *data = static_cast<ConvRowsTaskData<FLT, SRC> *>(userdata);
+    data->m_image->convImageRow(
+        *data->m_filter, data->m_srcBuff, data->m_srcSize, data->m_pixSize, iter + 1);
+  }
+
+  /** convert a not scaled image by rows in parallel
+   * return false if a filter of the chain only converts single pixels */
+  template<class FLT, class SRC>
+  bool convImageRows(FLT &filter, SRC srcBuff, short *srcSize, unsigned int pixSize)
+  {
+    // the first row tells if the chain supports rows, it is always the same for the next
+    if (m_size[1] == 0 || !convImageRow(filter, srcBuff, srcSize, pixSize, 0))
+      return false;
+
+    ConvRowsTaskData<FLT, SRC> data = {this, &filter, srcBuff, srcSize, pixSize};
+    blender::TaskParallelSettings settings;
+    blender::BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 16;
+    blender::BLI_task_parallel_range(
+        0, m_size[1] - 1, &data, convImageRowFunc<FLT, SRC>, &settings);
+    return true;
+  }
+
   /// template for image conversion
   template<class FLT, class SRC> void convImage(FLT &filter, SRC srcBuff, short *srcSize)
   {
@@ -187,8 +240,11 @@ class ImageBase {
     unsigned int pixSize = filter.firstPixelSize();
     // if no scaling is needed
     if (srcSize[0] == m_size[0] && srcSize[1] == m_size[1])
+      // convert whole rows if the filter chain allows it
+      if (convImageRows(filter, srcBuff, srcSize, pixSize))
+        return;
       // if flipping isn't required
-      if (!m_flip)
+      else if (!m_flip)
         // copy bitmap
         for (short y = 0; y < m_size[1]; ++y)
           for (short x = 0; x < m_size[0]; ++x, ++dstBuff, srcBuff += pixSize)
@@ -23,6 +23,7 @@
 #include "CM_Message.h"
 #include "EXP_PythonCallBack.h"
 #include "KX_Globals.h"
+#include "KX_KetsjiEngine.h"
 #include "RAS_IPolygonMaterial.h"
 #include "Texture.h"
 
@@ -442,6 +443,12 @@ static int ImageRender_init(PyObject *pySelf, PyObject *args, PyObject *kwds)
   // camera object
   PyObject *camera;
 
+  // The render needs off screens and a GPU context.
+  if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+    PyErr_SetString(PyExc_RuntimeError, "ImageRender is not available in headless mode");
+    return -1;
+  }
+
   RAS_ICanvas *canvas = KX_GetActiveEngine()->GetCanvas();
   int width = canvas->GetWidth();
   int height = canvas->GetHeight();
@@ -724,6 +731,12 @@ static int ImageMirror_init(PyObject *pySelf, PyObject *args, PyObject *kwds)
   // material of the mirror
   short materialID = 0;
 
+  // The render needs off screens and a GPU context.
+  if (KX_GetActiveEngine()->GetFlag(KX_KetsjiEngine::HEADLESS)) {
+    PyErr_SetString(PyExc_RuntimeError, "ImageMirror is not available in headless mode");
+    return -1;
+  }
+
   RAS_ICanvas *canvas = KX_GetActiveEngine()->GetCanvas();
   int width = canvas->GetWidth();
   int height = canvas->GetHeight();